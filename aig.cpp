@@ -0,0 +1,1148 @@
+//================================================================
+//Filename:		And-Inverter Graph Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for Aig: the conversion of
+//					the gates, the cut enumeration and rewriting, and
+//					the word-wide simulation kernel.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <map>
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "truthTable.h"
+#include "aig.h"
+
+using namespace std;
+
+// Literals at or above this stand for ANDs a dry run would have to make.
+#define AIG_VIRTUAL		(1 << 29)
+
+// A truth table over four leaves, and each leaf's own.
+#define AIG_ALL			0xFFFFu
+
+static const unsigned	aigVar[AIG_LEAVES] = {0xAAAAu, 0xCCCCu, 0xF0F0u, 0xFF00u};
+
+//========================
+//Cofactor
+//========================
+//Parameters:
+//	unsigned	tt	-	a truth table over four leaves
+//	int			j	-	the leaf to fix
+//	int			val	-	the value to fix it to
+//Summary:
+//	Gives tt with leaf j fixed at val, as a table where leaf j no longer
+//		matters.
+//Returns:
+//	unsigned	-	the cofactor
+//========================
+static unsigned cofactor(unsigned tt, int j, int val)
+{
+	int s = 1 << j;
+
+	if (val)
+	{
+		unsigned h = tt & aigVar[j];
+
+		return (h | (h >> s)) & AIG_ALL;
+	}
+
+	unsigned l = tt & ~aigVar[j] & AIG_ALL;
+
+	return (l | (l << s)) & AIG_ALL;
+}
+
+//========================
+//Support
+//========================
+//Parameters:
+//	unsigned	tt	-	a truth table over four leaves
+//Summary:
+//	Counts the leaves tt depends on.
+//Returns:
+//	int	-	the count
+//========================
+static int support(unsigned tt)
+{
+	int n = 0;
+
+	for (int j = 0; j < AIG_LEAVES; j++)
+	{
+		if (cofactor(tt, j, 0) != cofactor(tt, j, 1))
+			n++;
+	}
+
+	return n;
+}
+
+//========================
+//Stretch
+//========================
+//Parameters:
+//	unsigned	tt		-	a truth table over the leaves from
+//	int			*from	-	nf node numbers, in order
+//	int			nf		-	how many
+//	int			*to		-	node numbers, in order, holding all of from
+//Summary:
+//	Gives the same function as a table over the leaves to.
+//Returns:
+//	unsigned	-	the stretched table
+//========================
+static unsigned stretch(unsigned tt, int *from, int nf, int *to)
+{
+	int			pos[AIG_LEAVES];
+	unsigned	r = 0;
+
+	for (int i = 0, j = 0; i < nf; i++)
+	{
+		while (to[j] != from[i])
+			j++;
+
+		pos[i] = j;
+	}
+
+	for (int m = 0; m < 16; m++)
+	{
+		int idx = 0;
+
+		for (int i = 0; i < nf; i++)
+		{
+			if ((m >> pos[i]) & 1)
+				idx |= 1 << i;
+		}
+
+		if ((tt >> idx) & 1)
+			r |= 1u << m;
+	}
+
+	return r;
+}
+
+//========================
+//Swap Leaves
+//========================
+//Parameters:
+//	unsigned	tt	-	a truth table over four leaves
+//	int			i	-	a leaf
+//	int			j	-	another
+//Summary:
+//	Gives the same function with leaves i and j trading places.
+//Returns:
+//	unsigned	-	the table
+//========================
+static unsigned swapLeaves(unsigned tt, int i, int j)
+{
+	unsigned r = 0;
+
+	for (int m = 0; m < 16; m++)
+	{
+		int bi = (m >> i) & 1;
+		int bj = (m >> j) & 1;
+		int m2 = (m & ~((1 << i) | (1 << j))) | (bi << j) | (bj << i);
+
+		if ((tt >> m) & 1)
+			r |= 1u << m2;
+	}
+
+	return r;
+}
+
+//========================
+//Aig Constructor
+//========================
+//Parameters:
+//	Netlist	*n	-	the circuit, without feedback
+//Summary:
+//	Builds the graph gate by gate in level order, then drops ANDs no
+//		output reads. The netlist must outlive the Aig.
+//========================
+Aig::Aig(Netlist *n) throw (NullPointerException, BasicException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	if (n->getPathDelay() < 0)
+		throw BasicException("The AIG needs a circuit without feedback.");
+
+	net = n;
+	nIn = n->cntiPads();
+	fan = new vector<int>(2 * (nIn + 1), -1);
+	outs = new vector<int>();
+	strash = new map<long long, int>();
+
+	vector<int>				lit(n->cntWires(), -1);
+	vector<pair<int, int> >	lv;
+	int						cost = 0;
+
+	for (int ip = 0; ip < nIn; ip++)
+		lit[n->getiPadWire(ip)] = 2 * (ip + 1);
+
+	for (int g = 0; g < n->cntGates(); g++)
+		lv.push_back(make_pair(n->getLevel(g), g));
+
+	sort(lv.begin(), lv.end());
+
+	for (int k = 0; k < lv.size(); k++)
+	{
+		int			g = lv[k].second;
+		gateType	type = n->getType(g);
+		vector<int>	in;
+		int			v;
+
+		for (int i = 0; i < n->cntInputs(g); i++)
+		{
+			int w = n->getInput(g, i);
+
+			if (lit[w] < 0)
+				throw BasicException("The AIG found a wire nothing drives.");
+
+			in.push_back(lit[w]);
+		}
+
+		if (type == gLUT)
+		{
+			int step = 1;
+
+			for (int i = 1; i < in.size(); i++)
+				step *= 3;
+
+			v = lut(g, in, in.size() - 1, 0, step);
+		}
+		else
+		{
+			v = in[0];
+
+			for (int i = 1; i < in.size(); i++)
+			{
+				if ((type == gAND) || (type == gNAND))
+					v = conj(v, in[i], false, cost);
+				else if ((type == gOR) || (type == gNOR))
+					v = disj(v, in[i], false, cost);
+				else
+					v = exor(v, in[i], false, cost);
+			}
+
+			if ((type == gNOT) || (type == gNAND) || (type == gNOR) || (type == gXNOR))
+				v ^= 1;
+		}
+
+		lit[n->getOutput(g)] = v;
+	}
+
+	for (int op = 0; op < n->cntoPads(); op++)
+	{
+		int w = n->getoPadWire(op);
+
+		if (lit[w] < 0)
+			throw BasicException("The AIG found a wire nothing drives.");
+
+		outs->push_back(lit[w]);
+	}
+
+	cleanup();
+}
+
+//========================
+//Aig Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the graph.
+//========================
+Aig::~Aig()
+{
+	delete fan;
+	delete outs;
+	delete strash;
+}
+
+//========================
+//Aig Count Inputs
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Counts the input pads, nodes 1 through cntInputs().
+//Returns:
+//	int	-	the count
+//========================
+int			Aig::cntInputs()
+{
+	return nIn;
+}
+
+//========================
+//Aig Count Outputs
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Counts the output pads.
+//Returns:
+//	int	-	the count
+//========================
+int			Aig::cntOutputs()
+{
+	return outs->size();
+}
+
+//========================
+//Aig Count Nodes
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Counts every node: constant 0, the inputs and the ANDs.
+//Returns:
+//	int	-	the count
+//========================
+int			Aig::cntNodes()
+{
+	return fan->size() / 2;
+}
+
+//========================
+//Aig Count ANDs
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Counts the AND nodes.
+//Returns:
+//	int	-	the count
+//========================
+int			Aig::cntAnds()
+{
+	return cntNodes() - nIn - 1;
+}
+
+//========================
+//Aig Get Depth
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Finds the most ANDs on any path from an input to an output.
+//Returns:
+//	int	-	the depth
+//========================
+int			Aig::getDepth()
+{
+	vector<int>	level(cntNodes(), 0);
+	int			depth = 0;
+
+	for (int n = nIn + 1; n < cntNodes(); n++)
+		level[n] = 1 + max(level[(*fan)[2 * n] >> 1], level[(*fan)[2 * n + 1] >> 1]);
+
+	for (int op = 0; op < outs->size(); op++)
+		depth = max(depth, level[(*outs)[op] >> 1]);
+
+	return depth;
+}
+
+//========================
+//Aig Count Bytes
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Measures the graph's fan-ins and outputs, what simulation reads.
+//Returns:
+//	long	-	the bytes
+//========================
+long		Aig::cntBytes()
+{
+	return (long) (fan->size() + outs->size()) * sizeof(int);
+}
+
+//========================
+//Aig Get Output
+//========================
+//Parameters:
+//	int	op	-	an output pad
+//Summary:
+//	Gives the literal the pad reads.
+//Returns:
+//	int	-	the literal
+//========================
+int			Aig::getOutput(int op)
+{
+	return (*outs)[op];
+}
+
+//========================
+//Aig Conjunction
+//========================
+//Parameters:
+//	int		a		-	a literal
+//	int		b		-	another
+//	bool	dry		-	only count what would be made
+//	int		&cost	-	counts the ANDs made, or that would be
+//Summary:
+//	Gives the AND of two literals: folded if it is constant or one of
+//		them, the hashed node if there is one, or a new node. A dry run
+//		makes nothing, giving a stand-in literal above AIG_VIRTUAL
+//		instead; ANDs of stand-ins are always new.
+//Returns:
+//	int	-	the literal
+//========================
+int			Aig::conj(int a, int b, bool dry, int &cost)
+{
+	if (a > b)
+		swap(a, b);
+
+	if ((a == 0) || (a == (b ^ 1)))
+		return 0;
+
+	if ((a == 1) || (a == b))
+		return b;
+
+	if (b >= AIG_VIRTUAL)
+	{
+		cost++;
+
+		return AIG_VIRTUAL + 2 * cost;
+	}
+
+	long long							key = ((long long) a << 32) | b;
+	map<long long, int>::iterator	it = strash->find(key);
+
+	if (it != strash->end())
+		return 2 * it->second;
+
+	cost++;
+
+	if (dry)
+		return AIG_VIRTUAL + 2 * cost;
+
+	int n = cntNodes();
+
+	fan->push_back(a);
+	fan->push_back(b);
+	(*strash)[key] = n;
+
+	return 2 * n;
+}
+
+//========================
+//Aig Disjunction
+//========================
+//Parameters:
+//	as for conj
+//Summary:
+//	Gives the OR of two literals, an AND with every edge inverted.
+//Returns:
+//	int	-	the literal
+//========================
+int			Aig::disj(int a, int b, bool dry, int &cost)
+{
+	return conj(a ^ 1, b ^ 1, dry, cost) ^ 1;
+}
+
+//========================
+//Aig Exclusive Or
+//========================
+//Parameters:
+//	as for conj
+//Summary:
+//	Gives the XOR of two literals, the OR of a AND NOT b and NOT a AND b.
+//Returns:
+//	int	-	the literal
+//========================
+int			Aig::exor(int a, int b, bool dry, int &cost)
+{
+	int x = conj(a, b ^ 1, dry, cost);
+	int y = conj(a ^ 1, b, dry, cost);
+
+	return disj(x, y, dry, cost);
+}
+
+//========================
+//Aig Lookup Table
+//========================
+//Parameters:
+//	int			g		-	a gLUT gate
+//	vector<int>	&in		-	its inputs' literals
+//	int			k		-	the last input not yet fixed
+//	int			idx		-	the table index of the inputs fixed so far
+//	int			step	-	3 to the k, input k's weight in the index
+//Summary:
+//	Builds the gate's function of its binary rows, splitting on input k
+//		and then on the ones below it.
+//Returns:
+//	int	-	the literal
+//========================
+int			Aig::lut(int g, vector<int> &in, int k, int idx, int step)
+{
+	if (k < 0)
+		return (net->getLUT(g, idx) == high) ? 1 : 0;
+
+	int hi = lut(g, in, k - 1, idx + step, step / 3);
+	int lo = lut(g, in, k - 1, idx, step / 3);
+	int cost = 0;
+
+	if (hi == lo)
+		return hi;
+
+	return disj(conj(in[k], hi, false, cost), conj(in[k] ^ 1, lo, false, cost), false, cost);
+}
+
+//========================
+//Aig Synthesize
+//========================
+//Parameters:
+//	unsigned	tt		-	a truth table over four leaves
+//	int			*leaf	-	the leaves' literals
+//	bool		dry		-	only count what would be made
+//	int			&cost	-	counts the ANDs made, or that would be
+//Summary:
+//	Builds tt from its leaves, splitting on one it depends on: an AND or
+//		OR if a cofactor is constant, an XOR if they are each other's
+//		inverse, or else a multiplexer. The leaf split on is one giving
+//		such a simple split, or else the one leaving the cofactors the
+//		fewest leaves.
+//Returns:
+//	int	-	the literal
+//========================
+int			Aig::synth(unsigned tt, int *leaf, bool dry, int &cost)
+{
+	tt &= AIG_ALL;
+
+	if (tt == 0)
+		return 0;
+
+	if (tt == AIG_ALL)
+		return 1;
+
+	for (int j = 0; j < AIG_LEAVES; j++)
+	{
+		if (tt == aigVar[j])
+			return leaf[j];
+
+		if (tt == (aigVar[j] ^ AIG_ALL))
+			return leaf[j] ^ 1;
+	}
+
+	int best = -1;
+	int score = 0;
+
+	for (int j = 0; j < AIG_LEAVES; j++)
+	{
+		unsigned	f0 = cofactor(tt, j, 0);
+		unsigned	f1 = cofactor(tt, j, 1);
+		int			s;
+
+		if (f0 == f1)
+			continue;
+
+		if ((f0 == 0) || (f1 == 0) || (f0 == AIG_ALL) || (f1 == AIG_ALL) || (f0 == (f1 ^ AIG_ALL)))
+			s = 0;
+		else
+			s = support(f0) + support(f1);
+
+		if ((best < 0) || (s < score))
+		{
+			best = j;
+			score = s;
+		}
+	}
+
+	unsigned	f0 = cofactor(tt, best, 0);
+	unsigned	f1 = cofactor(tt, best, 1);
+	int			x = leaf[best];
+
+	if (f0 == 0)
+		return conj(x, synth(f1, leaf, dry, cost), dry, cost);
+
+	if (f1 == 0)
+		return conj(x ^ 1, synth(f0, leaf, dry, cost), dry, cost);
+
+	if (f0 == AIG_ALL)
+		return conj(x, synth(f1 ^ AIG_ALL, leaf, dry, cost), dry, cost) ^ 1;
+
+	if (f1 == AIG_ALL)
+		return conj(x ^ 1, synth(f0 ^ AIG_ALL, leaf, dry, cost), dry, cost) ^ 1;
+
+	if (f0 == (f1 ^ AIG_ALL))
+		return exor(x, synth(f0, leaf, dry, cost), dry, cost);
+
+	int h1 = synth(f1, leaf, dry, cost);
+	int h0 = synth(f0, leaf, dry, cost);
+
+	return disj(conj(x, h1, dry, cost), conj(x ^ 1, h0, dry, cost), dry, cost);
+}
+
+//========================
+//Aig Cuts
+//========================
+//Parameters:
+//	vector<int>			&leaf	-	receives AIG_LEAVES node numbers per cut, in
+//									order, then -1s
+//	vector<unsigned>	&tt		-	receives each cut's truth table
+//	vector<int>			&cnt	-	receives each node's cut count
+//Summary:
+//	Lists up to AIG_CUTS cuts of each node, AIG_CUTS slots apart: first
+//		the node by itself, then the smallest of those made by joining a
+//		cut of each fan-in, skipping any that hold another kept one.
+//Returns:
+//	n/a
+//========================
+void		Aig::cuts(vector<int> &leaf, vector<unsigned> &tt, vector<int> &cnt)
+{
+	int nN = cntNodes();
+
+	leaf.assign((long) nN * AIG_CUTS * AIG_LEAVES, -1);
+	tt.assign((long) nN * AIG_CUTS, 0);
+	cnt.assign(nN, 1);
+
+	for (int n = 1; n < nN; n++)
+	{
+		int* self = &leaf[(long) n * AIG_CUTS * AIG_LEAVES];
+
+		self[0] = n;
+		tt[(long) n * AIG_CUTS] = aigVar[0];
+
+		if (n <= nIn)
+			continue;
+
+		vector<pair<int, int> >		order;	// (size, candidate)
+		vector<vector<int> >		cand;
+		vector<unsigned>			ctt;
+		int							f[2] = {(*fan)[2 * n], (*fan)[2 * n + 1]};
+		int*						base[2];
+		int							size[2];
+
+		for (int c0 = 0; c0 < cnt[f[0] >> 1]; c0++)
+		{
+			for (int c1 = 0; c1 < cnt[f[1] >> 1]; c1++)
+			{
+				int c[2] = {c0, c1};
+
+				for (int s = 0; s < 2; s++)
+				{
+					base[s] = &leaf[((long) (f[s] >> 1) * AIG_CUTS + c[s]) * AIG_LEAVES];
+
+					for (size[s] = 0; (size[s] < AIG_LEAVES) && (base[s][size[s]] >= 0); size[s]++);
+				}
+
+				vector<int> u(base[0], base[0] + size[0]);
+
+				u.insert(u.end(), base[1], base[1] + size[1]);
+				sort(u.begin(), u.end());
+				u.erase(unique(u.begin(), u.end()), u.end());
+
+				if (u.size() > AIG_LEAVES)
+					continue;
+
+				unsigned t = AIG_ALL;
+
+				for (int s = 0; s < 2; s++)
+				{
+					unsigned ft = tt[(long) (f[s] >> 1) * AIG_CUTS + c[s]];
+
+					if (f[s] & 1)
+						ft ^= AIG_ALL;
+
+					t &= stretch(ft, base[s], size[s], &u[0]);
+				}
+
+				order.push_back(make_pair(u.size(), cand.size()));
+				cand.push_back(u);
+				ctt.push_back(t);
+			}
+		}
+
+		sort(order.begin(), order.end());
+
+		for (int k = 0; (k < order.size()) && (cnt[n] < AIG_CUTS); k++)
+		{
+			vector<int>	&u = cand[order[k].second];
+			bool		held = false;
+
+			for (int c = 1; (c < cnt[n]) && !held; c++)
+			{
+				int*	kept = &self[c * AIG_LEAVES];
+				int		ks;
+
+				for (ks = 0; (ks < AIG_LEAVES) && (kept[ks] >= 0); ks++);
+
+				held = includes(u.begin(), u.end(), kept, kept + ks);
+			}
+
+			if (held)
+				continue;
+
+			copy(u.begin(), u.end(), &self[cnt[n] * AIG_LEAVES]);
+			tt[(long) n * AIG_CUTS + cnt[n]] = ctt[order[k].second];
+			cnt[n]++;
+		}
+	}
+}
+
+//========================
+//Aig Maximum Fanout-Free Cone
+//========================
+//Parameters:
+//	vector<int>	&f		-	the graph's fan-ins
+//	int			n		-	an AND node
+//	int			*leaf	-	a cut of it
+//	int			k		-	the cut's size
+//	vector<int>	&refs	-	each node's readers, left as found
+//Summary:
+//	Counts the ANDs from n down to the cut that nothing else reads, those
+//		dropped if n is built some other way.
+//Returns:
+//	int	-	the count
+//========================
+int			Aig::mffc(vector<int> &f, int n, int *leaf, int k, vector<int> &refs)
+{
+	int size = 0;
+
+	deref(f, n, leaf, k, refs, size);
+	reref(f, n, leaf, k, refs);
+
+	return size;
+}
+
+//========================
+//Aig Dereference
+//========================
+//Parameters:
+//	as for mffc, and
+//	int	&size	-	counts the nodes freed
+//Summary:
+//	Takes away n's reads of its fan-ins, freeing in turn any that no
+//		longer have a reader, down to the cut.
+//Returns:
+//	n/a
+//========================
+void		Aig::deref(vector<int> &f, int n, int *leaf, int k, vector<int> &refs, int &size)
+{
+	size++;
+
+	for (int s = 0; s < 2; s++)
+	{
+		int c = f[2 * n + s] >> 1;
+
+		if ((c <= nIn) || (find(leaf, leaf + k, c) != leaf + k))
+			continue;
+
+		if (--refs[c] == 0)
+			deref(f, c, leaf, k, refs, size);
+	}
+}
+
+//========================
+//Aig Rereference
+//========================
+//Parameters:
+//	as for mffc
+//Summary:
+//	Puts back what deref took away.
+//Returns:
+//	n/a
+//========================
+void		Aig::reref(vector<int> &f, int n, int *leaf, int k, vector<int> &refs)
+{
+	for (int s = 0; s < 2; s++)
+	{
+		int c = f[2 * n + s] >> 1;
+
+		if ((c <= nIn) || (find(leaf, leaf + k, c) != leaf + k))
+			continue;
+
+		if (refs[c]++ == 0)
+			reref(f, c, leaf, k, refs);
+	}
+}
+
+//========================
+//Aig Pass
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Rebuilds the graph node by node from its cuts. A node whose function
+//		of some cut is constant or one of the cut's leaves becomes that;
+//		failing that, one whose function of a cut's new nodes matches a
+//		node already rebuilt becomes it. Failing that, if its AND is not
+//		already in the new graph, each cut's function is synthesized
+//		over the new leaves, and the one needing the fewest new ANDs,
+//		if that is fewer than the cut frees, is kept. A pass that does
+//		not shrink the graph is undone.
+//Returns:
+//	bool	-	whether the graph shrank
+//========================
+bool		Aig::pass()
+{
+	int					nOld = cntNodes();
+	vector<int>			oFan(*fan);
+	vector<int>			oOuts(*outs);
+	vector<int>			leaf;
+	vector<unsigned>	tt;
+	vector<int>			cnt;
+	vector<int>			refs(nOld, 0);
+	vector<int>			m(nOld, 0);
+	map<vector<int>, int>	funcs;
+
+	cuts(leaf, tt, cnt);
+
+	for (int n = nIn + 1; n < nOld; n++)
+	{
+		refs[oFan[2 * n] >> 1]++;
+		refs[oFan[2 * n + 1] >> 1]++;
+	}
+
+	for (int op = 0; op < oOuts.size(); op++)
+		refs[oOuts[op] >> 1]++;
+
+	fan->assign(2 * (nIn + 1), -1);
+	strash->clear();
+
+	for (int n = 1; n <= nIn; n++)
+		m[n] = 2 * n;
+
+	for (int n = nIn + 1; n < nOld; n++)
+	{
+		int						lit = -1;
+		vector<vector<int> >	keys;
+		vector<int>				phase;
+
+		for (int c = 1; (c < cnt[n]) && (lit < 0); c++)
+		{
+			int*		l = &leaf[((long) n * AIG_CUTS + c) * AIG_LEAVES];
+			unsigned	t = tt[(long) n * AIG_CUTS + c];
+			int			k;
+
+			for (k = 0; (k < AIG_LEAVES) && (l[k] >= 0); k++);
+
+			if ((t == 0) || (t == AIG_ALL))
+			{
+				lit = (t == 0) ? 0 : 1;
+				break;
+			}
+
+			for (int j = 0; (j < k) && (lit < 0); j++)
+			{
+				if (t == aigVar[j])
+					lit = m[l[j]];
+				else if (t == (aigVar[j] ^ AIG_ALL))
+					lit = m[l[j]] ^ 1;
+			}
+
+			if (lit >= 0)
+				break;
+
+			// The same function of the same new nodes, leaves in order.
+			int			nd[AIG_LEAVES];
+			bool		ok = true;
+
+			for (int j = 0; j < k; j++)
+			{
+				nd[j] = m[l[j]] >> 1;
+				ok = ok && (nd[j] != 0);
+
+				if (m[l[j]] & 1)
+					t = ((cofactor(t, j, 1) & ~aigVar[j]) | (cofactor(t, j, 0) & aigVar[j])) & AIG_ALL;
+			}
+
+			for (int a = 0; a < k; a++)
+			{
+				for (int b = 0; b + 1 < k - a; b++)
+				{
+					if (nd[b] > nd[b + 1])
+					{
+						swap(nd[b], nd[b + 1]);
+						t = swapLeaves(t, b, b + 1);
+					}
+				}
+			}
+
+			for (int j = 0; j + 1 < k; j++)
+				ok = ok && (nd[j] != nd[j + 1]);
+
+			if (!ok)
+				continue;
+
+			int ph = t & 1;
+			vector<int> key(nd, nd + k);
+
+			key.push_back(ph ? (t ^ AIG_ALL) : t);
+
+			map<vector<int>, int>::iterator it = funcs.find(key);
+
+			if (it != funcs.end())
+				lit = it->second ^ ph;
+			else
+			{
+				keys.push_back(key);
+				phase.push_back(ph);
+			}
+		}
+
+		if (lit < 0)
+		{
+			int a = m[oFan[2 * n] >> 1] ^ (oFan[2 * n] & 1);
+			int b = m[oFan[2 * n + 1] >> 1] ^ (oFan[2 * n + 1] & 1);
+			int cost = 0;
+			int best = -1;
+			int gain = 0;
+			int nl[AIG_LEAVES];
+
+			conj(a, b, true, cost);
+
+			for (int c = 1; (c < cnt[n]) && (cost > 0); c++)
+			{
+				int*	l = &leaf[((long) n * AIG_CUTS + c) * AIG_LEAVES];
+				int		k;
+				int		need = 0;
+
+				for (k = 0; (k < AIG_LEAVES) && (l[k] >= 0); k++)
+					nl[k] = m[l[k]];
+
+				for (int j = k; j < AIG_LEAVES; j++)
+					nl[j] = 0;
+
+				int freed = mffc(oFan, n, l, k, refs);
+
+				if (freed < 2)
+					continue;
+
+				synth(tt[(long) n * AIG_CUTS + c], nl, true, need);
+
+				if (freed - need > gain)
+				{
+					best = c;
+					gain = freed - need;
+				}
+			}
+
+			if (best < 0)
+				lit = conj(a, b, false, cost);
+			else
+			{
+				int* l = &leaf[((long) n * AIG_CUTS + best) * AIG_LEAVES];
+
+				for (int k = 0; k < AIG_LEAVES; k++)
+					nl[k] = (l[k] >= 0) ? m[l[k]] : 0;
+
+				lit = synth(tt[(long) n * AIG_CUTS + best], nl, false, cost);
+			}
+		}
+
+		for (int k = 0; k < keys.size(); k++)
+			funcs.insert(make_pair(keys[k], lit ^ phase[k]));
+
+		m[n] = lit;
+	}
+
+	for (int op = 0; op < outs->size(); op++)
+		(*outs)[op] = m[oOuts[op] >> 1] ^ (oOuts[op] & 1);
+
+	cleanup();
+
+	if (cntNodes() < nOld)
+		return true;
+
+	*fan = oFan;
+	*outs = oOuts;
+	strash->clear();
+
+	for (int n = nIn + 1; n < nOld; n++)
+		(*strash)[((long long) oFan[2 * n] << 32) | oFan[2 * n + 1]] = n;
+
+	return false;
+}
+
+//========================
+//Aig Cleanup
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Rebuilds the graph from just the ANDs some output reads, keeping
+//		their order.
+//Returns:
+//	n/a
+//========================
+void		Aig::cleanup()
+{
+	int				nN = cntNodes();
+	vector<bool>	live(nN, false);
+	vector<int>		m(nN, 0);
+	vector<int>		old(*fan);
+	int				cost = 0;
+
+	for (int op = 0; op < outs->size(); op++)
+		live[(*outs)[op] >> 1] = true;
+
+	for (int n = nN - 1; n > nIn; n--)
+	{
+		if (live[n])
+			live[old[2 * n] >> 1] = live[old[2 * n + 1] >> 1] = true;
+	}
+
+	fan->assign(2 * (nIn + 1), -1);
+	strash->clear();
+
+	for (int n = 1; n <= nIn; n++)
+		m[n] = 2 * n;
+
+	for (int n = nIn + 1; n < nN; n++)
+	{
+		if (live[n])
+			m[n] = conj(m[old[2 * n] >> 1] ^ (old[2 * n] & 1), m[old[2 * n + 1] >> 1] ^ (old[2 * n + 1] & 1), false, cost);
+	}
+
+	for (int op = 0; op < outs->size(); op++)
+		(*outs)[op] = m[(*outs)[op] >> 1] ^ ((*outs)[op] & 1);
+}
+
+//========================
+//Aig Rewrite
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Runs rewriting passes, at most AIG_PASSES, while the graph shrinks.
+//Returns:
+//	int	-	the ANDs removed
+//========================
+int			Aig::rewrite()
+{
+	int before = cntAnds();
+
+	for (int p = 0; (p < AIG_PASSES) && pass(); p++);
+
+	return before - cntAnds();
+}
+
+//========================
+//Aig Simulate
+//========================
+//Parameters:
+//	lanes	*v		-	words per node, node after node, the inputs' set
+//	int		words	-	words per node
+//Summary:
+//	Fills in constant 0 and every AND, words at a time. An inverted edge
+//		is an XOR with its inversion bit spread across the word, so the
+//		loop has no branches.
+//Returns:
+//	n/a
+//========================
+void		Aig::simulate(lanes *v, int words)
+{
+	int			nN = cntNodes();
+	const int*	f = &(*fan)[0];
+
+	for (int w = 0; w < words; w++)
+		v[w] = 0;
+
+	for (int n = nIn + 1; n < nN; n++)
+	{
+		int				a = f[2 * n];
+		int				b = f[2 * n + 1];
+		const lanes*	x = v + (long) (a >> 1) * words;
+		const lanes*	y = v + (long) (b >> 1) * words;
+		lanes			ma = 0ULL - (lanes) (a & 1);
+		lanes			mb = 0ULL - (lanes) (b & 1);
+		lanes*			z = v + (long) n * words;
+
+		for (int w = 0; w < words; w++)
+			z[w] = (x[w] ^ ma) & (y[w] ^ mb);
+	}
+}
+
+//========================
+//Aig Run
+//========================
+//Parameters:
+//	Vector	*v		-	the vector whose PadStates drive and record the run
+//	int		tEnd	-	the last time increment to simulate
+//Summary:
+//	Simulates times 0 through tEnd, one bit of a word per nanosecond and
+//		AIG_WORDS words per pass, and records each output's settled value
+//		in its oPadState. A time where any input is X, or not given,
+//		is X at every output. PadStates are matched to pads by name.
+//Returns:
+//	n/a
+//========================
+void		Aig::run(Vector *v, int tEnd) throw (BasicException)
+{
+	if (v == NULL)
+		throw NullPointerException();
+
+	if (tEnd < 1)
+		throw BasicException("Time to run is zero or negative. INVALID!");
+
+	vector<int>			iIdx;
+	vector<PadState*>	iPS;
+	vector<int>			oIdx;
+	vector<PadState*>	oPS;
+
+	net->matchPads(v, iIdx, iPS, oIdx, oPS);
+
+	vector<PadState*>	in(nIn, (PadState*) NULL);
+	vector<lanes>		val((long) cntNodes() * AIG_WORDS);
+	lanes				known[AIG_WORDS];
+
+	for (int ip = 0; ip < iPS.size(); ip++)
+		in[iIdx[ip]] = iPS[ip];
+
+	for (int t0 = 0; t0 <= tEnd; t0 += 64 * AIG_WORDS)
+	{
+		for (int w = 0; w < AIG_WORDS; w++)
+			known[w] = ~0ULL;
+
+		for (int i = 0; i < nIn; i++)
+		{
+			lanes* x = &val[(long) (i + 1) * AIG_WORDS];
+
+			for (int w = 0; w < AIG_WORDS; w++)
+				x[w] = 0;
+
+			for (int b = 0; b < 64 * AIG_WORDS; b++)
+			{
+				int		ct = t0 + b;
+				state	s = indet;
+
+				if ((ct <= tEnd) && (in[i] != NULL) && (in[i]->cntStates() > 0))
+					s = in[i]->getState(ct);
+
+				if (s == high)
+					x[b >> 6] |= 1ULL << (b & 63);
+				else if (s != low)
+					known[b >> 6] &= ~(1ULL << (b & 63));
+			}
+		}
+
+		simulate(&val[0], AIG_WORDS);
+
+		for (int op = 0; op < oPS.size(); op++)
+		{
+			int				o = (*outs)[oIdx[op]];
+			const lanes*	x = &val[(long) (o >> 1) * AIG_WORDS];
+			lanes			mo = 0ULL - (lanes) (o & 1);
+
+			for (int b = 0; (b < 64 * AIG_WORDS) && (t0 + b <= tEnd); b++)
+			{
+				state s = indet;
+
+				if ((known[b >> 6] >> (b & 63)) & 1)
+					s = (((x[b >> 6] ^ mo) >> (b & 63)) & 1) ? high : low;
+
+				oPS[op]->addState(s, t0 + b);
+			}
+		}
+	}
+}
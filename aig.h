@@ -0,0 +1,105 @@
+#ifndef AIG_H
+#define AIG_H
+
+//================================================================
+//Filename:		And-Inverter Graph Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of Aig, which rebuilds a
+//					circuit without feedback from two-input ANDs and
+//					inverted edges, shrinks it by rewriting small cuts,
+//					and simulates it 64 nanoseconds to the word.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <map>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "truthTable.h"
+
+using namespace std;
+
+// Words of 64 nanoseconds each simulated per pass.
+#define AIG_WORDS		8
+
+// Cuts kept per node while rewriting, and their most leaves.
+#define AIG_CUTS		8
+#define AIG_LEAVES		4
+
+// Rewriting passes tried at most.
+#define AIG_PASSES		4
+
+//==================================
+//Class:	Aig
+//Parent:	n/a
+//==================================
+//Description:
+//	Aig holds a circuit without feedback as an and-inverter graph: node 0
+//		is constant 0, nodes 1 through cntInputs() are the input pads in
+//		order, and every node after is the AND of two earlier ones. An
+//		edge is a literal, twice a node plus 1 if it is inverted, so NOT
+//		costs nothing and 1 is the constant 1. ANDs are hashed on their
+//		two literals as they are made, so no two are alike, and an AND of
+//		a constant, of a literal with itself or with its own inverse,
+//		folds away. OR, NAND and NOR are ANDs with inverted edges, XOR is
+//		three ANDs, and a gLUT is a tree of multiplexers, one per input.
+//	rewrite() works on cuts: sets of at most four nodes that every path
+//		from the inputs to a node passes through, each with the node's
+//		function of them as a 16-bit truth table. A node whose function
+//		of a cut is constant, one of the cut's nodes, or the same as one
+//		already made from the same nodes is replaced by it; otherwise the
+//		function is built afresh, splitting on one leaf at a time, and
+//		kept if it needs fewer new ANDs than the cut frees. Passes go on
+//		while the graph shrinks.
+//	The graph has only 0 and 1, and no delays: run() gives the outputs
+//		each time's inputs settle to, or X at every output for a time
+//		when any input is X.
+//==================================
+class Aig
+{
+public:
+				Aig(Netlist *n) throw (NullPointerException, BasicException);
+
+				~Aig();
+
+	int			cntInputs();
+	int			cntOutputs();
+	int			cntNodes();
+	int			cntAnds();
+	int			getDepth();
+	long		cntBytes();
+	int			getOutput(int op);
+
+	int			rewrite();
+	void		simulate(lanes *v, int words);
+	void		run(Vector *v, int tEnd) throw (BasicException);
+
+private:
+
+	int			conj(int a, int b, bool dry, int &cost);
+	int			disj(int a, int b, bool dry, int &cost);
+	int			exor(int a, int b, bool dry, int &cost);
+	int			lut(int g, vector<int> &in, int k, int idx, int step);
+	int			synth(unsigned tt, int *leaf, bool dry, int &cost);
+	bool		pass();
+	void		cuts(vector<int> &leaf, vector<unsigned> &tt, vector<int> &cnt);
+	int			mffc(vector<int> &f, int n, int *leaf, int k, vector<int> &refs);
+	void		deref(vector<int> &f, int n, int *leaf, int k, vector<int> &refs, int &size);
+	void		reref(vector<int> &f, int n, int *leaf, int k, vector<int> &refs);
+	void		cleanup();
+
+	Netlist*				net;
+	int						nIn;
+	vector<int>*			fan;		// per node: its two fan-in literals.
+	vector<int>*			outs;		// per output pad: its literal.
+	map<long long, int>*	strash;		// (fan-in, fan-in) to the AND's node.
+};
+
+#endif //AIG_H
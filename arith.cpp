@@ -0,0 +1,786 @@
+//================================================================
+//Filename:		Arithmetic Checker Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for Arith: reading buses
+//					and checks, compiling each expression to postfix,
+//					and sweeping the rows on threads.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include <sstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cctype>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "truthTable.h"
+#include "arith.h"
+
+using namespace std;
+
+// Words of 64 rows a thread takes at a time.
+#define ARITH_CHUNK	256
+
+// Postfix operations; AR_BUS and AR_CONST take a bus or constant index.
+#define AR_BUS		0
+#define AR_CONST	1
+#define AR_NOT		2
+#define AR_NEG		3
+#define AR_OR		4
+#define AR_XOR		5
+#define AR_AND		6
+#define AR_SHL		7
+#define AR_SHR		8
+#define AR_ADD		9
+#define AR_SUB		10
+#define AR_MUL		11
+#define AR_DIV		12
+#define AR_MOD		13
+
+// Binary operators by precedence level, loosest first.
+static int	binaryOp(string t, int level)
+{
+	switch (level)
+	{
+	case 0:
+		return (t == "|") ? AR_OR : -1;
+	case 1:
+		return (t == "^") ? AR_XOR : -1;
+	case 2:
+		return (t == "&") ? AR_AND : -1;
+	case 3:
+		return (t == "<<") ? AR_SHL : ((t == ">>") ? AR_SHR : -1);
+	case 4:
+		return (t == "+") ? AR_ADD : ((t == "-") ? AR_SUB : -1);
+	case 5:
+		return (t == "*") ? AR_MUL : ((t == "/") ? AR_DIV : ((t == "%") ? AR_MOD : -1));
+	}
+
+	return -1;
+}
+
+// The low w bits.
+static unsigned long long	widthMask(int w)
+{
+	return (w >= 64) ? ~0ULL : ((1ULL << w) - 1);
+}
+
+//========================
+//Arith Constructor
+//========================
+//Parameters:
+//	Netlist	*n	-	the netlist, without feedback
+//	int		nt	-	how many threads to sweep on
+//Summary:
+//	Sets up the TruthTable to sweep, and no buses or checks. n must
+//		outlive the Arith.
+//========================
+Arith::Arith(Netlist *n, int nt) throw (NullPointerException, BasicException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	if (nt < 1)
+		throw BasicException("Thread count must be at least 1.");
+
+	if (n->getPathDelay() < 0)
+		throw BasicException("Arithmetic checks need a circuit without feedback.");
+
+	net = n;
+	tt = new TruthTable(n, false, 1);
+	nThreads = nt;
+	threads = new pthread_t[nThreads];
+
+	rows = tt->cntRows();
+	words = (rows + 63) / 64;
+	chunks = (long) ((words + ARITH_CHUNK - 1) / ARITH_CHUNK);
+	nextChunk = 0;
+	seat = 0;
+
+	busName = new vector<string>();
+	busPads = new vector< vector<int> >();
+	busOut = new vector<bool>();
+
+	text = new vector<string>();
+	lhs = new vector<int>();
+	code = new vector< vector<int> >();
+	operands = new vector< vector<int> >();
+	consts = new vector<unsigned long long>();
+	depth = 0;
+
+	show = 0;
+	failed = new vector<unsigned long long>();
+	seatMiss = new vector< vector<unsigned long long> >();
+	misses = new vector< vector<unsigned long long> >();
+}
+
+//========================
+//Arith Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the TruthTable, buses, checks and results.
+//========================
+Arith::~Arith()
+{
+	delete [] threads;
+	delete tt;
+
+	delete busName;
+	delete busPads;
+	delete busOut;
+	delete text;
+	delete lhs;
+	delete code;
+	delete operands;
+	delete consts;
+	delete failed;
+	delete seatMiss;
+	delete misses;
+}
+
+//========================
+//Arith Read
+//========================
+//Parameters:
+//	istream	&in	-	an open spec file
+//Summary:
+//	Adds each BUS and CHECK line of the file. A BUS must come before
+//		the checks that use it.
+//Returns:
+//	n/a
+//========================
+void		Arith::read(istream &in) throw (BasicException)
+{
+	string line;
+
+	while (getline(in, line))
+	{
+		istringstream	ls(line);
+		string			CMD = "";
+
+		ls >> CMD;
+
+		if (CMD == "")
+			continue;
+
+		if (CMD == "BUS")
+		{
+			string		name = "";
+			string		id;
+			vector<int>	pads;
+			int			outs = 0;
+
+			ls >> name;
+
+			if (name == "")
+				throw BasicException("A bus needs a name.");
+
+			if (bus(name, false) >= 0)
+				throw BasicException("A bus is declared twice.");
+
+			while (ls >> id)
+			{
+				int p = -1;
+
+				for (int ip = 0; (p < 0) && (ip < net->cntiPads()); ip++)
+				{
+					if (net->getiPadID(ip) == id)
+						p = ip;
+				}
+
+				for (int op = 0; (p < 0) && (op < net->cntoPads()); op++)
+				{
+					if (net->getoPadID(op) == id)
+					{
+						p = op;
+						outs++;
+					}
+				}
+
+				if (p < 0)
+					throw BasicException("A bus names a pad the circuit lacks.");
+
+				pads.insert(pads.begin(), p);
+			}
+
+			if (pads.empty())
+				throw BasicException("A bus needs at least one pad.");
+
+			if ((outs != 0) && (outs != pads.size()))
+				throw BasicException("A bus mixes input and output pads.");
+
+			if (pads.size() > 64)
+				throw BasicException("A bus is wider than 64 pads.");
+
+			busName->push_back(name);
+			busPads->push_back(pads);
+			busOut->push_back(outs != 0);
+			continue;
+		}
+
+		if (CMD != "CHECK")
+			throw BasicException("Unrecognized arithmetic spec command.");
+
+		int first = line.find("CHECK") + 5;
+		int eq = line.find('=', first);
+
+		if (eq == string::npos)
+			throw BasicException("A check must read CHECK bus = expression.");
+
+		istringstream	left(line.substr(first, eq - first));
+		string			name = "";
+		string			more = "";
+		string			right = line.substr(eq + 1);
+		vector<string>	tok;
+
+		left >> name >> more;
+
+		if ((name == "") || (more != ""))
+			throw BasicException("A check must read CHECK bus = expression.");
+
+		int b = bus(name, true);
+
+		if (!(*busOut)[b])
+			throw BasicException("A check's left side must be a bus of output pads.");
+
+		for (int i = 0; i < right.size(); )
+		{
+			char ch = right[i];
+
+			if (isspace(ch))
+				i++;
+			else if (isalnum(ch) || (ch == '_'))
+			{
+				int j = i;
+
+				while ((j < right.size()) && (isalnum(right[j]) || (right[j] == '_')))
+					j++;
+
+				tok.push_back(right.substr(i, j - i));
+				i = j;
+			}
+			else if (((ch == '<') || (ch == '>')) && (i + 1 < right.size()) && (right[i + 1] == ch))
+			{
+				tok.push_back(right.substr(i, 2));
+				i += 2;
+			}
+			else
+			{
+				tok.push_back(string(1, ch));
+				i++;
+			}
+		}
+
+		int c = text->size();
+		int at = 0;
+
+		code->push_back(vector<int>());
+		operands->push_back(vector<int>());
+		parse(tok, at, 0, c);
+
+		if (at != tok.size())
+			throw BasicException("A check's expression is malformed.");
+
+		int need = 0;
+		int sp = 0;
+
+		for (int k = 0; k < (*code)[c].size(); k += 2)
+		{
+			int op = (*code)[c][k];
+
+			if ((op == AR_BUS) || (op == AR_CONST))
+				sp++;
+			else if ((op != AR_NOT) && (op != AR_NEG))
+				sp--;
+
+			need = max(need, sp);
+		}
+
+		depth = max(depth, need);
+
+		int from = line.find_first_not_of(" \t", first);
+		int last = line.find_last_not_of(" \t\r");
+
+		text->push_back(line.substr(from, last - from + 1));
+		lhs->push_back(b);
+	}
+}
+
+//========================
+//Arith Bus
+//========================
+//Parameters:
+//	string	id		-	a bus or pad ID
+//	bool	make	-	whether a pad may stand for a bus of its own
+//Summary:
+//	Finds the bus declared as id. Failing that, and if make, finds the
+//		pad id and adds a one-pad bus for it.
+//Returns:
+//	int	-	the bus, or -1 if none and not make
+//========================
+int			Arith::bus(string id, bool make) throw (BasicException)
+{
+	for (int b = 0; b < busName->size(); b++)
+	{
+		if ((*busName)[b] == id)
+			return b;
+	}
+
+	if (!make)
+		return -1;
+
+	for (int ip = 0; ip < net->cntiPads(); ip++)
+	{
+		if (net->getiPadID(ip) == id)
+		{
+			busName->push_back(id);
+			busPads->push_back(vector<int>(1, ip));
+			busOut->push_back(false);
+			return busName->size() - 1;
+		}
+	}
+
+	for (int op = 0; op < net->cntoPads(); op++)
+	{
+		if (net->getoPadID(op) == id)
+		{
+			busName->push_back(id);
+			busPads->push_back(vector<int>(1, op));
+			busOut->push_back(true);
+			return busName->size() - 1;
+		}
+	}
+
+	throw BasicException("A check names a bus or pad the circuit lacks.");
+}
+
+//========================
+//Arith Parse
+//========================
+//Parameters:
+//	vector<string>	&tok	-	the expression's tokens
+//	int				&at		-	the next token; moved past what is read
+//	int				level	-	precedence level, 0 (|) through 6 (unary)
+//	int				c		-	the check whose code to append to
+//Summary:
+//	Reads one operand at the given level by recursive descent, emitting
+//		postfix code: each level reads operands of the next, joined by
+//		its own operators, and level 6 reads ~ or - before an operand, a
+//		constant, a bus, or a parenthesized expression.
+//Returns:
+//	n/a
+//========================
+void		Arith::parse(vector<string> &tok, int &at, int level, int c) throw (BasicException)
+{
+	vector<int>& cd = (*code)[c];
+
+	if (level == 6)
+	{
+		if (at >= tok.size())
+			throw BasicException("A check's expression is malformed.");
+
+		string t = tok[at++];
+
+		if ((t == "~") || (t == "-"))
+		{
+			parse(tok, at, 6, c);
+			cd.push_back((t == "~") ? AR_NOT : AR_NEG);
+			cd.push_back(0);
+			return;
+		}
+
+		if (t == "(")
+		{
+			parse(tok, at, 0, c);
+
+			if ((at >= tok.size()) || (tok[at] != ")"))
+				throw BasicException("A check's expression is malformed.");
+
+			at++;
+			return;
+		}
+
+		if (!isalnum(t[0]) && (t[0] != '_'))
+			throw BasicException("A check's expression is malformed.");
+
+		if (t.find_first_not_of("0123456789") == string::npos)
+		{
+			cd.push_back(AR_CONST);
+			cd.push_back(consts->size());
+			consts->push_back(strtoull(t.c_str(), NULL, 10));
+			return;
+		}
+
+		int b = bus(t, true);
+
+		if ((*busOut)[b])
+			throw BasicException("A check's operands must be buses of input pads.");
+
+		vector<int>& ops = (*operands)[c];
+
+		if (find(ops.begin(), ops.end(), b) == ops.end())
+			ops.push_back(b);
+
+		cd.push_back(AR_BUS);
+		cd.push_back(b);
+		return;
+	}
+
+	parse(tok, at, level + 1, c);
+
+	while (at < tok.size())
+	{
+		int op = binaryOp(tok[at], level);
+
+		if (op < 0)
+			break;
+
+		at++;
+		parse(tok, at, level + 1, c);
+		cd.push_back(op);
+		cd.push_back(0);
+	}
+}
+
+//========================
+//Arith Checks and Buses
+//========================
+//Parameters:
+//	int					c	-	a check
+//	int					k	-	one of its operands
+//	int					b	-	a bus
+//	unsigned long long	row	-	a row, below cntRows()
+//Summary:
+//	The checks read, each one's text and input buses, a bus's name,
+//		and an input bus's value in a row.
+//Returns:
+//	varies
+//========================
+int			Arith::cntChecks()
+{
+	return text->size();
+}
+
+string		Arith::getCheck(int c)
+{
+	return (*text)[c];
+}
+
+int			Arith::cntOperands(int c)
+{
+	return (*operands)[c].size();
+}
+
+int			Arith::getOperand(int c, int k)
+{
+	return (*operands)[c][k];
+}
+
+string		Arith::getBus(int b)
+{
+	return (*busName)[b];
+}
+
+unsigned long long	Arith::getValue(int b, unsigned long long row)
+{
+	unsigned long long value = 0;
+
+	for (int j = 0; j < (*busPads)[b].size(); j++)
+		value |= ((row >> (*busPads)[b][j]) & 1) << j;
+
+	return value;
+}
+
+//========================
+//Arith Worker
+//========================
+//Parameters:
+//	void	*arg	-	the Arith
+//Summary:
+//	Thread entry point: takes the next seat and works it.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		Arith::worker(void *arg)
+{
+	Arith* ar = (Arith*) arg;
+
+	ar->work(__sync_fetch_and_add(&ar->seat, 1));
+
+	return NULL;
+}
+
+//========================
+//Arith Work
+//========================
+//Parameters:
+//	int	s	-	this thread's seat
+//Summary:
+//	Takes chunks until none are left. Each word is evaluated on the
+//		TruthTable, then, lane by lane, every check's expression is
+//		worked on the stack from the row's operand values and compared
+//		with its output bus. Mismatches are counted, and the first few
+//		kept, under this seat.
+//Returns:
+//	n/a
+//========================
+void		Arith::work(int s)
+{
+	int							nC = cntChecks();
+	vector<lanes>				v(net->cntWires() + 1, 0);
+	vector<unsigned long long>	val(busName->size(), 0);
+	vector<unsigned long long>	st(depth + 1, 0);
+	vector<unsigned long long>&	mine = (*seatMiss)[s];
+	vector<int>					use;
+	vector<int>					outWire;
+
+	for (int c = 0; c < nC; c++)
+	{
+		for (int k = 0; k < cntOperands(c); k++)
+		{
+			if (find(use.begin(), use.end(), getOperand(c, k)) == use.end())
+				use.push_back(getOperand(c, k));
+		}
+	}
+
+	for (int c = 0; c < nC; c++)
+	{
+		vector<int>& pads = (*busPads)[(*lhs)[c]];
+
+		for (int j = 0; j < pads.size(); j++)
+			outWire.push_back(net->getoPadWire(pads[j]));
+	}
+
+	while (true)
+	{
+		long c = __sync_fetch_and_add(&nextChunk, 1);
+
+		if (c >= chunks)
+			break;
+
+		unsigned long long	from = (unsigned long long) c * ARITH_CHUNK;
+		unsigned long long	to = from + ARITH_CHUNK;
+
+		if (to > words)
+			to = words;
+
+		for (unsigned long long w = from; w < to; w++)
+		{
+			int valid = 64;
+
+			if (rows - w * 64 < 64)
+				valid = (int) (rows - w * 64);
+
+			tt->evaluate(&v[0], w);
+
+			for (int l = 0; l < valid; l++)
+			{
+				unsigned long long row = w * 64 + l;
+
+				for (int k = 0; k < use.size(); k++)
+					val[use[k]] = getValue(use[k], row);
+
+				int at = 0;
+
+				for (int ch = 0; ch < nC; ch++)
+				{
+					vector<int>&	cd = (*code)[ch];
+					int				width = (*busPads)[(*lhs)[ch]].size();
+					int				sp = 0;
+
+					for (int k = 0; k < cd.size(); k += 2)
+					{
+						unsigned long long b;
+
+						switch (cd[k])
+						{
+						case AR_BUS:
+							st[sp++] = val[cd[k + 1]];
+							continue;
+						case AR_CONST:
+							st[sp++] = (*consts)[cd[k + 1]];
+							continue;
+						case AR_NOT:
+							st[sp - 1] = ~st[sp - 1];
+							continue;
+						case AR_NEG:
+							st[sp - 1] = 0ULL - st[sp - 1];
+							continue;
+						}
+
+						b = st[--sp];
+
+						switch (cd[k])
+						{
+						case AR_OR:		st[sp - 1] |= b;	break;
+						case AR_XOR:	st[sp - 1] ^= b;	break;
+						case AR_AND:	st[sp - 1] &= b;	break;
+						case AR_ADD:	st[sp - 1] += b;	break;
+						case AR_SUB:	st[sp - 1] -= b;	break;
+						case AR_MUL:	st[sp - 1] *= b;	break;
+						case AR_SHL:
+							st[sp - 1] = (b >= 64) ? 0 : (st[sp - 1] << b);
+							break;
+						case AR_SHR:
+							st[sp - 1] = (b >= 64) ? 0 : (st[sp - 1] >> b);
+							break;
+						case AR_DIV:
+							st[sp - 1] = (b == 0) ? 0 : (st[sp - 1] / b);
+							break;
+						case AR_MOD:
+							st[sp - 1] = (b == 0) ? 0 : (st[sp - 1] % b);
+							break;
+						}
+					}
+
+					unsigned long long want = st[0] & widthMask(width);
+					unsigned long long got = 0;
+
+					for (int j = 0; j < width; j++)
+						got |= ((v[outWire[at + j]] >> l) & 1) << j;
+
+					at += width;
+
+					if (got == want)
+						continue;
+
+					(*failed)[(long) s * nC + ch]++;
+
+					if (mine.size() < 4 * (unsigned long long) show)
+					{
+						mine.push_back(row);
+						mine.push_back(ch);
+						mine.push_back(got);
+						mine.push_back(want);
+					}
+				}
+			}
+		}
+	}
+}
+
+//========================
+//Arith Run
+//========================
+//Parameters:
+//	int	show	-	how many mismatches to keep
+//Summary:
+//	Sweeps every row on the threads, then merges each seat's first
+//		mismatches and keeps the first show of them, by row and then
+//		check.
+//Returns:
+//	n/a
+//========================
+void		Arith::run(int show) throw (BasicException)
+{
+	this->show = show;
+	nextChunk = 0;
+	seat = 0;
+	failed->assign((long) nThreads * cntChecks(), 0);
+	seatMiss->assign(nThreads, vector<unsigned long long>());
+	misses->clear();
+
+	int started = 1;
+
+	while ((started < nThreads) && (pthread_create(&threads[started], NULL, worker, this) == 0))
+		started++;
+
+	if (started < nThreads)
+	{
+		char buf[80];
+
+		for (int c = 1; c < started; c++)
+			pthread_join(threads[c], NULL);
+
+		sprintf(buf, "Unable to start sweep thread %d of %d.", started + 1, nThreads);
+		throw BasicException(buf);
+	}
+
+	work(__sync_fetch_and_add(&seat, 1));
+
+	for (int c = 1; c < nThreads; c++)
+		pthread_join(threads[c], NULL);
+
+	for (int s = 0; s < nThreads; s++)
+	{
+		vector<unsigned long long>& m = (*seatMiss)[s];
+
+		for (int k = 0; k < m.size(); k += 4)
+			misses->push_back(vector<unsigned long long>(m.begin() + k, m.begin() + k + 4));
+	}
+
+	sort(misses->begin(), misses->end());
+
+	if (misses->size() > show)
+		misses->resize(show);
+}
+
+//========================
+//Arith Results
+//========================
+//Parameters:
+//	int	c	-	a check
+//	int	k	-	a kept mismatch
+//Summary:
+//	The thread count, the rows swept, how many rows break check c, and
+//		for each kept mismatch, its row, check, the output bus's value
+//		and the expression's.
+//Returns:
+//	varies
+//========================
+int			Arith::cntThreads()
+{
+	return nThreads;
+}
+
+unsigned long long	Arith::cntRows()
+{
+	return rows;
+}
+
+unsigned long long	Arith::cntFailed(int c)
+{
+	unsigned long long n = 0;
+
+	for (int s = 0; s < nThreads; s++)
+		n += (*failed)[(long) s * cntChecks() + c];
+
+	return n;
+}
+
+int			Arith::cntMismatches()
+{
+	return misses->size();
+}
+
+unsigned long long	Arith::getRow(int k)
+{
+	return (*misses)[k][0];
+}
+
+int			Arith::getCheckOf(int k)
+{
+	return (int) (*misses)[k][1];
+}
+
+unsigned long long	Arith::getGot(int k)
+{
+	return (*misses)[k][2];
+}
+
+unsigned long long	Arith::getWant(int k)
+{
+	return (*misses)[k][3];
+}
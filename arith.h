@@ -0,0 +1,115 @@
+#ifndef ARITH_H
+#define ARITH_H
+
+//================================================================
+//Filename:		Arithmetic Checker Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of Arith, which groups pads
+//					into integer buses and checks, over every input
+//					combination, that an output bus equals an
+//					expression of the input buses.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "truthTable.h"
+
+using namespace std;
+
+// Mismatches reported unless told otherwise.
+#define ARITH_SHOW		10
+
+//==================================
+//Class:	Arith
+//Parent:	n/a
+//==================================
+//Description:
+//	Arith reads a spec file of lines
+//			BUS N N1 N0
+//			CHECK S = N * M
+//		A BUS names pads, most significant first, as one unsigned
+//		integer; a pad not named by any BUS is a bus of its own. A CHECK
+//		says an output bus equals an expression of input buses and
+//		decimal constants, with C's + - * / % & | ^ << >> ~ and
+//		parentheses, worked in 64 bits and cut to the output bus's
+//		width (x / 0 and x % 0 give 0).
+//		Every input combination is swept on a TruthTable, 64 rows per
+//		evaluation, its words cut into chunks that threads take in turn.
+//		The expression is worked out lane by lane for each word, with
+//		the operands read off the row number, and compared with the
+//		output bus's lanes. Each thread keeps the first mismatches it
+//		meets, and since a thread's chunks only go up, the first of all
+//		of them are the first overall, whatever the thread count.
+//==================================
+class Arith
+{
+public:
+				Arith(Netlist *n, int nt = 1) throw (NullPointerException, BasicException);
+
+				~Arith();
+
+	void		read(istream &in) throw (BasicException);
+	int			cntChecks();
+	string		getCheck(int c);
+	int			cntOperands(int c);
+	int			getOperand(int c, int k);
+	string		getBus(int b);
+	unsigned long long	getValue(int b, unsigned long long row);
+
+	void		run(int show) throw (BasicException);
+	int			cntThreads();
+	unsigned long long	cntRows();
+	unsigned long long	cntFailed(int c);
+
+	int			cntMismatches();
+	unsigned long long	getRow(int k);
+	int			getCheckOf(int k);
+	unsigned long long	getGot(int k);
+	unsigned long long	getWant(int k);
+
+private:
+
+	int			bus(string id, bool make) throw (BasicException);
+	void		parse(vector<string> &tok, int &at, int level, int c) throw (BasicException);
+	void		work(int seat);
+
+static void*	worker(void *arg);
+
+	Netlist*				net;
+	TruthTable*				tt;
+	int						nThreads;
+	pthread_t*				threads;
+	unsigned long long		rows;
+	unsigned long long		words;
+	long					chunks;
+	long					nextChunk;
+	int						seat;
+
+	vector<string>*			busName;
+	vector< vector<int> >*	busPads;	// per bus: its pads, least significant first.
+	vector<bool>*			busOut;		// per bus: output pads, not input.
+
+	vector<string>*			text;		// per check: its expression, as read.
+	vector<int>*			lhs;		// per check: the output bus.
+	vector< vector<int> >*	code;		// per check: (op, argument) pairs, postfix.
+	vector< vector<int> >*	operands;	// per check: input buses, as first used.
+	vector<unsigned long long>*	consts;
+	int						depth;		// the most stack any check needs.
+
+	int						show;
+	vector<unsigned long long>*	failed;	// per seat, per check.
+	vector< vector<unsigned long long> >*	seatMiss;	// per seat: (row, check, got, want)s.
+	vector< vector<unsigned long long> >*	misses;		// the first, merged and in order.
+};
+
+#endif //ARITH_H
@@ -0,0 +1,813 @@
+//================================================================
+//Filename:		Test Pattern Generator Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the Atpg: PODEM's
+//					implication, objectives and backtrace, and the
+//					cube merging and compaction around it.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <iostream>
+#include <functional>
+#include <algorithm>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "faultSim.h"
+#include "testability.h"
+#include "stimulus.h"
+#include "atpg.h"
+
+using namespace std;
+
+// Cubes fault simulated at a time while generating.
+#define CUBE_BATCH		16
+
+// Random patterns are tried 64 at a time, up to RANDOM_BLOCKS times,
+// while each 64 detect at least RANDOM_GAIN new faults.
+#define RANDOM_BLOCKS	64
+#define RANDOM_GAIN		1
+
+// podem() results.
+#define PD_FOUND		0
+#define PD_REDUNDANT	1
+#define PD_ABORTED		2
+
+// Whether a gate kind inverts its underlying AND, OR, XOR or buffer.
+static bool	inverts(gateType t)
+{
+	return ((t == gNOT) || (t == gNAND) || (t == gNOR) || (t == gXNOR));
+}
+
+//========================
+//Atpg Constructor
+//========================
+//Parameters:
+//	Netlist		*n		-	the netlist, without feedback or gLUT gates
+//	FaultSim	*f		-	the fault list to target, over the same netlist
+//	Testability	*t		-	SCOAP measures of the same netlist
+//	int			limit	-	backtracks allowed per fault
+//Summary:
+//	Sets up the two-circuit simulator. All three arguments must outlive
+//		the Atpg.
+//========================
+Atpg::Atpg(Netlist *n, FaultSim *f, Testability *t, int limit) throw (NullPointerException, BasicException)
+{
+	if ((n == NULL) || (f == NULL) || (t == NULL))
+		throw NullPointerException();
+
+	if (limit < 0)
+		throw BasicException("Backtrack limit must not be negative.");
+
+	net = n;
+	fs = f;
+	tm = t;
+	backLimit = limit;
+	nCubes = 0;
+	nMerged = 0;
+	nRandom = 0;
+	nRedundant = 0;
+	nAborted = 0;
+
+	rank = new vector<int>(net->cntGates());
+	order = new vector<int>();
+	padOf = new vector<int>(net->cntWires(), -1);
+	gv = new vector<unsigned char>(net->cntWires(), indet);
+	fv = new vector<unsigned char>(net->cntWires(), indet);
+	cube = new vector<unsigned char>(net->cntiPads(), indet);
+	queued = new vector<bool>(net->cntGates(), false);
+	isOut = new vector<bool>(net->cntWires(), false);
+	seen = new vector<int>(net->cntWires(), 0);
+	mark = 0;
+	heap = new priority_queue<int, vector<int>, greater<int> >();
+	tests = new vector<unsigned char>();
+
+	vector<pair<int, int> > lv;
+
+	for (int g = 0; g < net->cntGates(); g++)
+	{
+		if (net->getType(g) == gLUT)
+			throw BasicException("Test generation works on the circuit's own gates, not lookup tables.");
+
+		lv.push_back(make_pair(net->getLevel(g), g));
+	}
+
+	sort(lv.begin(), lv.end());
+
+	for (int k = 0; k < lv.size(); k++)
+	{
+		order->push_back(lv[k].second);
+		(*rank)[lv[k].second] = k;
+	}
+
+	for (int ip = 0; ip < net->cntiPads(); ip++)
+		(*padOf)[net->getiPadWire(ip)] = ip;
+
+	for (int op = 0; op < net->cntoPads(); op++)
+		(*isOut)[net->getoPadWire(op)] = true;
+}
+
+//========================
+//Atpg Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the simulator and patterns.
+//========================
+Atpg::~Atpg()
+{
+	delete rank;
+	delete order;
+	delete padOf;
+	delete gv;
+	delete fv;
+	delete cube;
+	delete queued;
+	delete isOut;
+	delete seen;
+	delete heap;
+	delete tests;
+}
+
+//========================
+//Atpg Accessors
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Test cubes generated, patterns after merging, random patterns tried
+//		first, patterns kept after compaction, and faults found redundant
+//		or given up on.
+//Returns:
+//	int	-	the count
+//========================
+int			Atpg::cntCubes()
+{
+	return nCubes;
+}
+
+int			Atpg::cntMerged()
+{
+	return nMerged;
+}
+
+int			Atpg::cntRandom()
+{
+	return nRandom;
+}
+
+int			Atpg::cntPatterns()
+{
+	return (net->cntiPads() == 0) ? 0 : tests->size() / net->cntiPads();
+}
+
+int			Atpg::cntRedundant()
+{
+	return nRedundant;
+}
+
+int			Atpg::cntAborted()
+{
+	return nAborted;
+}
+
+//========================
+//Atpg Faulty Input
+//========================
+//Parameters:
+//	int	g	-	a gate
+//	int	k	-	one of its inputs
+//Summary:
+//	The state gate g's input k has in the faulty circuit: the wire's
+//		faulty state, or the stuck value if the fault is on that input.
+//Returns:
+//	state	-	the faulty input state
+//========================
+state		Atpg::faultyIn(int g, int k)
+{
+	if ((g == fGate) && (k == fPin))
+		return (state) fStuck;
+
+	return (state) (*fv)[net->getInput(g, k)];
+}
+
+//========================
+//Atpg Evaluate
+//========================
+//Parameters:
+//	int	g	-	a gate
+//Summary:
+//	Re-evaluates g in both circuits and queues its readers if either
+//		output changed. The faulty output of the faulty wire is the
+//		stuck value whatever the inputs.
+//Returns:
+//	n/a
+//========================
+void		Atpg::evaluate(int g)
+{
+	int				o = net->getOutput(g);
+	int				nin = net->cntInputs(g);
+	vector<state>	in(nin);
+
+	for (int k = 0; k < nin; k++)
+		in[k] = (state) (*gv)[net->getInput(g, k)];
+
+	state good = evalType(net->getType(g), in);
+
+	for (int k = 0; k < nin; k++)
+		in[k] = faultyIn(g, k);
+
+	state bad = evalType(net->getType(g), in);
+
+	if ((fGate < 0) && (o == fWire))
+		bad = (state) fStuck;
+
+	if ((good == (*gv)[o]) && (bad == (*fv)[o]))
+		return;
+
+	(*gv)[o] = good;
+	(*fv)[o] = bad;
+
+	for (int k = 0; k < net->cntFanout(o); k++)
+	{
+		int r = net->getFanout(o, k);
+
+		if (!(*queued)[r])
+		{
+			(*queued)[r] = true;
+			heap->push((*rank)[r]);
+		}
+	}
+}
+
+//========================
+//Atpg Assign
+//========================
+//Parameters:
+//	int		ip	-	an input pad
+//	state	s	-	its new state, X to undo a decision
+//Summary:
+//	Sets an input pad in both circuits and carries the change forward
+//		in level order.
+//Returns:
+//	n/a
+//========================
+void		Atpg::assign(int ip, state s)
+{
+	int w = net->getiPadWire(ip);
+
+	(*cube)[ip] = s;
+	(*gv)[w] = s;
+	(*fv)[w] = ((fGate < 0) && (w == fWire)) ? fStuck : s;
+
+	for (int k = 0; k < net->cntFanout(w); k++)
+	{
+		int r = net->getFanout(w, k);
+
+		if (!(*queued)[r])
+		{
+			(*queued)[r] = true;
+			heap->push((*rank)[r]);
+		}
+	}
+
+	while (!heap->empty())
+	{
+		int g = (*order)[heap->top()];
+
+		heap->pop();
+		(*queued)[g] = false;
+
+		evaluate(g);
+	}
+}
+
+//========================
+//Atpg Detected
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Whether some output pad is 0 in one circuit and 1 in the other.
+//Returns:
+//	bool	-	true once the decisions so far are a test
+//========================
+bool		Atpg::detected()
+{
+	for (int op = 0; op < net->cntoPads(); op++)
+	{
+		int w = net->getoPadWire(op);
+
+		if (((*gv)[w] != indet) && ((*fv)[w] != indet) && ((*gv)[w] != (*fv)[w]))
+			return true;
+	}
+
+	return false;
+}
+
+//========================
+//Atpg X Path
+//========================
+//Parameters:
+//	int	w	-	a wire X in the good or the faulty circuit
+//Summary:
+//	Whether some path of such wires leads from w to an output pad, so a
+//		difference reaching w could still be seen. Without one, the
+//		D-frontier gate driving w is a dead end.
+//Returns:
+//	bool	-	true if an X path exists
+//========================
+bool		Atpg::xPath(int w)
+{
+	vector<int> stack;
+
+	mark++;
+	(*seen)[w] = mark;
+	stack.push_back(w);
+
+	while (!stack.empty())
+	{
+		int x = stack.back();
+
+		stack.pop_back();
+
+		if ((*isOut)[x])
+			return true;
+
+		for (int k = 0; k < net->cntFanout(x); k++)
+		{
+			int o = net->getOutput(net->getFanout(x, k));
+
+			if (((*seen)[o] != mark) && (((*gv)[o] == indet) || ((*fv)[o] == indet)))
+			{
+				(*seen)[o] = mark;
+				stack.push_back(o);
+			}
+		}
+	}
+
+	return false;
+}
+
+//========================
+//Atpg Objective
+//========================
+//Parameters:
+//	int		&w	-	receives the wire to set
+//	state	&s	-	receives the state to set it to
+//Summary:
+//	PODEM's next objective. Until the fault's wire is the opposite of
+//		the stuck value in the good circuit, that; after, an undecided
+//		input of the D-frontier gate nearest an output (by CO) set to
+//		its non-controlling value: 1 into AND and NAND, 0 into OR and
+//		NOR, the cheaper value into XOR and XNOR. With no D-frontier gate
+//		left an X path, or the fault's wire already at the stuck value,
+//		there is none and PODEM backs up. A D-frontier gate whose undecided inputs are
+//		all faulty-only X gets w = -1: any undecided pad will do.
+//Returns:
+//	bool	-	false for a dead end
+//========================
+bool		Atpg::objective(int &w, state &s)
+{
+	state site = (state) (*gv)[fWire];
+
+	if (site == (state) fStuck)
+		return false;
+
+	if (site == indet)
+	{
+		w = fWire;
+		s = (fStuck == high) ? low : high;
+		return true;
+	}
+
+	int best = -1;
+	int bestCO = SCOAP_INF + 1;
+
+	for (int r = 0; r < order->size(); r++)
+	{
+		int g = (*order)[r];
+		int o = net->getOutput(g);
+
+		if (((*gv)[o] != indet) && ((*fv)[o] != indet))
+			continue;
+
+		bool diff = false;
+
+		for (int k = 0; k < net->cntInputs(g); k++)
+		{
+			state gi = (state) (*gv)[net->getInput(g, k)];
+			state fi = faultyIn(g, k);
+
+			if ((gi != indet) && (fi != indet) && (gi != fi))
+				diff = true;
+		}
+
+		if (diff && (tm->getCO(o) < bestCO) && xPath(o))
+		{
+			best = g;
+			bestCO = tm->getCO(o);
+		}
+	}
+
+	if (best < 0)
+		return false;
+
+	gateType type = net->getType(best);
+
+	for (int k = 0; k < net->cntInputs(best); k++)
+	{
+		int in = net->getInput(best, k);
+
+		if ((*gv)[in] != indet)
+			continue;
+
+		w = in;
+
+		if ((type == gAND) || (type == gNAND))
+			s = high;
+		else if ((type == gOR) || (type == gNOR))
+			s = low;
+		else
+			s = (tm->getCC0(in) <= tm->getCC1(in)) ? low : high;
+
+		return true;
+	}
+
+	w = -1;
+	return true;
+}
+
+//========================
+//Atpg Backtrace
+//========================
+//Parameters:
+//	int		w	-	a wire whose good state is X
+//	state	s	-	the state wanted on it
+//	state	&v	-	receives the state to give the pad found
+//Summary:
+//	Walks from w back to an undecided input pad through X wires. Where
+//		one input decides a gate's output (a 0 into AND), it follows the
+//		input easiest to set that way; where every input must agree (1s
+//		into AND), the hardest, so a conflict shows up soon. Inverting
+//		gates flip the wanted state; through XOR, it is flipped by the
+//		inputs already set.
+//Returns:
+//	int	-	the input pad
+//========================
+int			Atpg::backtrace(int w, state s, state &v)
+{
+	while ((*padOf)[w] < 0)
+	{
+		int			g = net->getDriver(w);
+		gateType	type = net->getType(g);
+		int			pick = -1;
+		int			pickCost = 0;
+		state		t = s;
+
+		if (inverts(type))
+			t = (t == high) ? low : high;
+
+		if ((type == gXOR) || (type == gXNOR))
+		{
+			for (int k = 0; k < net->cntInputs(g); k++)
+			{
+				int in = net->getInput(g, k);
+
+				if ((*gv)[in] == high)
+					t = (t == high) ? low : high;
+				else if (((*gv)[in] == indet) && ((pick < 0) || (min(tm->getCC0(in), tm->getCC1(in)) < pickCost)))
+				{
+					pick = in;
+					pickCost = min(tm->getCC0(in), tm->getCC1(in));
+				}
+			}
+
+			int xs = 0;
+
+			for (int k = 0; k < net->cntInputs(g); k++)
+			{
+				if ((*gv)[net->getInput(g, k)] == indet)
+					xs++;
+			}
+
+			if (xs > 1) // others still free: take the cheaper value.
+				t = (tm->getCC0(pick) <= tm->getCC1(pick)) ? low : high;
+		}
+		else
+		{
+			// does one input settle it (true), or must all agree?
+			bool one = (((type == gAND) || (type == gNAND)) && (t == low))
+					|| (((type == gOR) || (type == gNOR)) && (t == high));
+
+			for (int k = 0; k < net->cntInputs(g); k++)
+			{
+				int in = net->getInput(g, k);
+
+				if ((*gv)[in] != indet)
+					continue;
+
+				int c = tm->getCC(in, t);
+
+				if ((pick < 0) || (one && (c < pickCost)) || (!one && (c > pickCost)))
+				{
+					pick = in;
+					pickCost = c;
+				}
+			}
+		}
+
+		w = pick;
+		s = t;
+	}
+
+	v = s;
+
+	return (*padOf)[w];
+}
+
+//========================
+//Atpg PODEM
+//========================
+//Parameters:
+//	int	f	-	a fault of the FaultSim's list
+//Summary:
+//	Searches for a test cube for f, leaving it in cube. Each step takes
+//		the objective, backtraces it to a pad and decides that pad; on a
+//		dead end, decisions whose other value was tried are undone and
+//		the latest remaining one flipped.
+//Returns:
+//	int	-	PD_FOUND, PD_REDUNDANT or PD_ABORTED
+//========================
+int			Atpg::podem(int f)
+{
+	int nI = net->cntiPads();
+
+	fs->getFault(f, fWire, fGate, fPin, fStuck);
+
+	gv->assign(gv->size(), indet);
+	fv->assign(fv->size(), indet);
+	cube->assign(nI, indet);
+
+	if ((fGate < 0) && ((*padOf)[fWire] >= 0))
+		(*fv)[fWire] = fStuck;
+
+	for (int r = 0; r < order->size(); r++)
+		evaluate((*order)[r]);
+
+	while (!heap->empty())	// readers queued by the pass above.
+	{
+		int g = (*order)[heap->top()];
+
+		heap->pop();
+		(*queued)[g] = false;
+		evaluate(g);
+	}
+
+	vector<int>		padStack;
+	vector<bool>	flipped;
+	int				backs = 0;
+
+	while (true)
+	{
+		if (detected())
+			return PD_FOUND;
+
+		int		w;
+		state	s;
+
+		if (objective(w, s))
+		{
+			int		ip = -1;
+			state	v = low;
+
+			if (w >= 0)
+				ip = backtrace(w, s, v);
+			else
+			{
+				for (int p = 0; (p < nI) && (ip < 0); p++)
+				{
+					if ((*cube)[p] == indet)
+						ip = p;
+				}
+			}
+
+			if (ip >= 0)
+			{
+				padStack.push_back(ip);
+				flipped.push_back(false);
+				assign(ip, v);
+				continue;
+			}
+		}
+
+		while (!padStack.empty() && flipped.back())
+		{
+			assign(padStack.back(), indet);
+			padStack.pop_back();
+			flipped.pop_back();
+		}
+
+		if (padStack.empty())
+			return PD_REDUNDANT;
+
+		if (++backs > backLimit)
+			return PD_ABORTED;
+
+		flipped.back() = true;
+		assign(padStack.back(), ((*cube)[padStack.back()] == high) ? low : high);
+	}
+}
+
+//========================
+//Atpg Run
+//========================
+//Parameters:
+//	unsigned long long	seed	-	seeds the random patterns and X fill
+//Summary:
+//	Fault simulates blocks of random patterns, dropping what they
+//		detect, until a block adds less than RANDOM_GAIN faults. Then
+//		targets every fault still undetected, dropping faults as batches
+//		of cubes are fault simulated, merges compatible cubes first fit,
+//		fills the remaining X at random, and keeps only the patterns,
+//		random or generated, that detect something when simulated last
+//		to first, reversing again while that drops any. The FaultSim is
+//		left graded against the final patterns.
+//Returns:
+//	n/a
+//========================
+void		Atpg::run(unsigned long long seed)
+{
+	int						nI = net->cntiPads();
+	int						nF = fs->cntFaults();
+	Xoshiro					rng(seed);
+	vector<unsigned char>	all;
+	vector<unsigned char>	cubes;
+	vector<unsigned char>	batch;
+
+	nCubes = 0;
+	nRandom = 0;
+	nRedundant = 0;
+	nAborted = 0;
+
+	fs->run(batch, false); // clear detections.
+
+	for (int b = 0; (b < RANDOM_BLOCKS) && (nI > 0) && (fs->cntDetected() < nF); b++)
+	{
+		int before = fs->cntDetected();
+
+		for (int k = 0; k < 64 * nI; k++)
+			batch.push_back((rng.next() >> 63) ? high : low);
+
+		fs->run(batch, true);
+		all.insert(all.end(), batch.begin(), batch.end());
+		nRandom += 64;
+		batch.clear();
+
+		if (fs->cntDetected() - before < RANDOM_GAIN)
+			break;
+	}
+
+	for (int f = 0; f < nF; f++)
+	{
+		if (fs->getDetectedBy(f) >= 0)
+			continue;
+
+		int r = podem(f);
+
+		if (r == PD_REDUNDANT)
+			nRedundant++;
+		else if (r == PD_ABORTED)
+			nAborted++;
+		else
+		{
+			nCubes++;
+			cubes.insert(cubes.end(), cube->begin(), cube->end());
+			batch.insert(batch.end(), cube->begin(), cube->end());
+		}
+
+		if (batch.size() >= CUBE_BATCH * nI)
+		{
+			fs->run(batch, true);
+			batch.clear();
+		}
+	}
+
+	vector<unsigned char> merged;
+
+	for (int c = 0; c < nCubes; c++)
+	{
+		unsigned char*	cb = &cubes[(long) c * nI];
+		int				m = 0;
+		int				nM = merged.size() / (nI ? nI : 1);
+
+		for (; m < nM; m++)
+		{
+			unsigned char*	mb = &merged[(long) m * nI];
+			bool			fit = true;
+
+			for (int ip = 0; (ip < nI) && fit; ip++)
+				fit = (cb[ip] == indet) || (mb[ip] == indet) || (cb[ip] == mb[ip]);
+
+			if (fit)
+				break;
+		}
+
+		if (m == nM)
+			merged.insert(merged.end(), cb, cb + nI);
+		else
+		{
+			for (int ip = 0; ip < nI; ip++)
+			{
+				if (cb[ip] != indet)
+					merged[(long) m * nI + ip] = cb[ip];
+			}
+		}
+	}
+
+	for (long k = 0; k < merged.size(); k++)
+	{
+		if (merged[k] == indet)
+			merged[k] = (rng.next() >> 63) ? high : low;
+	}
+
+	nMerged = merged.size() / (nI ? nI : 1);
+	all.insert(all.end(), merged.begin(), merged.end());
+
+	int nAll = nRandom + nMerged;
+
+	while (true)
+	{
+		vector<unsigned char> rev;
+
+		for (int m = nAll - 1; m >= 0; m--)
+			rev.insert(rev.end(), all.begin() + (long) m * nI, all.begin() + (long) (m + 1) * nI);
+
+		fs->run(rev, false);
+
+		vector<bool> need(nAll, false);
+
+		for (int f = 0; f < nF; f++)
+		{
+			if (fs->getDetectedBy(f) >= 0)
+				need[fs->getDetectedBy(f)] = true;
+		}
+
+		all.clear();
+
+		for (int m = 0; m < nAll; m++)
+		{
+			if (need[m])
+				all.insert(all.end(), rev.begin() + (long) m * nI, rev.begin() + (long) (m + 1) * nI);
+		}
+
+		if (all.size() == rev.size())
+			break;
+
+		nAll = all.size() / nI;
+	}
+
+	*tests = all;
+
+	fs->run(*tests, false);
+}
+
+//========================
+//Atpg Write
+//========================
+//Parameters:
+//	ostream	&out	-	receives the vector file
+//	string	name	-	the VECTOR name
+//Summary:
+//	Writes the patterns as a vector file, each held long enough for the
+//		longest path to settle (getPathDelay() + 1 ns), with an INPUT
+//		line only where a pad changes.
+//Returns:
+//	n/a
+//========================
+void		Atpg::write(ostream &out, string name)
+{
+	int nI = net->cntiPads();
+	int hold = net->getPathDelay() + 1;
+
+	out << "VECTOR " << name << endl;
+
+	for (int p = 0; p < cntPatterns(); p++)
+	{
+		for (int ip = 0; ip < nI; ip++)
+		{
+			unsigned char s = (*tests)[(long) p * nI + ip];
+
+			if ((p == 0) || (s != (*tests)[(long) (p - 1) * nI + ip]))
+				out << "INPUT\t" << net->getiPadID(ip) << "\t" << p * hold << "\t" << (int) s << endl;
+		}
+	}
+}
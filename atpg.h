@@ -0,0 +1,115 @@
+#ifndef ATPG_H
+#define ATPG_H
+
+//================================================================
+//Filename:		Test Pattern Generator Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of the Atpg, which writes
+//					a small vector file detecting as many stuck-at
+//					faults as it can, found by PODEM.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <iostream>
+#include <functional>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "faultSim.h"
+#include "testability.h"
+
+using namespace std;
+
+//==================================
+//Class:	Atpg
+//Parent:	n/a
+//==================================
+//Description:
+//	The Atpg first fault simulates random patterns while they keep
+//		finding faults, then targets each fault of a FaultSim's list
+//		that no test so far detects with PODEM: it simulates the good and
+//		the faulty circuit side by side in 0/1/X with only the input pads
+//		it has decided set, and each decision comes from backtracing an
+//		objective back to an input pad. The objective is first the
+//		opposite of the stuck value on the fault's wire, then the value
+//		that lets the difference through a gate of the D-frontier (the
+//		gates with a good/faulty difference on an input but not yet on
+//		the output) from which an X path still leads to an output. The
+//		backtrace takes the easiest input by SCOAP where one input will
+//		do and the hardest where all must. A dead end undoes the latest
+//		decision and tries its other value; when none remain, the fault
+//		is redundant, and past the backtrack limit it is aborted.
+//		Each test leaves undecided pads at X, a test cube. Cubes are
+//		fault simulated as they come, X and all, and the faults they
+//		detect dropped; a detection with X inputs holds whatever the X
+//		becomes. Afterwards, cubes that agree wherever both are set are
+//		merged, the leftover X is filled at random, and all the patterns
+//		are fault simulated last to first so any pattern, random or not,
+//		that detects nothing the later ones miss can be left out.
+//==================================
+class Atpg
+{
+public:
+				Atpg(Netlist *n, FaultSim *f, Testability *t, int limit = 100) throw (NullPointerException, BasicException);
+
+				~Atpg();
+
+	void		run(unsigned long long seed);
+	int			cntCubes();
+	int			cntMerged();
+	int			cntRandom();
+	int			cntPatterns();
+	int			cntRedundant();
+	int			cntAborted();
+
+	void		write(ostream &out, string name);
+
+private:
+
+	int			podem(int f);
+	void		assign(int ip, state s);
+	void		evaluate(int g);
+	bool		objective(int &w, state &s);
+	int			backtrace(int w, state s, state &v);
+	bool		detected();
+	bool		xPath(int w);
+	state		faultyIn(int g, int k);
+
+	Netlist*				net;
+	FaultSim*				fs;
+	Testability*			tm;
+	int						backLimit;
+
+	int						fWire;		// the fault being targeted.
+	int						fGate;
+	int						fPin;
+	int						fStuck;
+
+	vector<int>*			rank;		// per gate, its place in level order.
+	vector<int>*			order;		// gates in level order.
+	vector<int>*			padOf;		// per wire, its input pad, or -1.
+	vector<unsigned char>*	gv;			// good state of each wire.
+	vector<unsigned char>*	fv;			// faulty state of each wire.
+	vector<unsigned char>*	cube;		// each input pad's decided state.
+	vector<bool>*			queued;
+	vector<bool>*			isOut;		// per wire: drives an output pad.
+	vector<int>*			seen;		// per wire: last xPath() visit.
+	int						mark;
+	priority_queue<int, vector<int>, greater<int> >*	heap;
+
+	int						nCubes;
+	int						nMerged;
+	int						nRandom;
+	int						nRedundant;
+	int						nAborted;
+	vector<unsigned char>*	tests;		// cntiPads() states per pattern.
+};
+
+#endif //ATPG_H
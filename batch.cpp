@@ -0,0 +1,2777 @@
+//================================================================
+//Filename:		Digital Circuit Analyzer, Batch Edition
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		A console front end for running circuits without
+//					the EzWindows display. Takes the circuit and
+//					vector files on the command line, simulates, and
+//					prints each pad's waveform as a row of states.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <list>
+#include <algorithm>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <unistd.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "loader.h"
+#include "netlist.h"
+#include "engine.h"
+#include "eventEngine.h"
+#include "windowEngine.h"
+#include "aig.h"
+#include "regress.h"
+#include "pipeline.h"
+#include "zipStream.h"
+#include "binVector.h"
+#include "truthTable.h"
+#include "stimulus.h"
+#include "faultSim.h"
+#include "testability.h"
+#include "atpg.h"
+#include "bdd.h"
+#include "symbolic.h"
+#include "sat.h"
+#include "equiv.h"
+#include "bmc.h"
+#include "arith.h"
+
+using namespace std;
+
+// Threads -threads may start per processor.
+#define MAX_THREADS_PER_CPU	8
+
+// A starting time: wall clock seconds, and processor time used.
+typedef pair<double, clock_t>	stopwatch;
+
+int		usage();
+int		cmdRun(vector<string> &args);
+int		cmdRegress(vector<string> &args);
+int		cmdStream(vector<string> &args);
+int		cmdSort(vector<string> &args);
+int		cmdPack(vector<string> &args);
+int		cmdTruth(vector<string> &args);
+int		cmdRandom(vector<string> &args);
+int		cmdFaults(vector<string> &args);
+int		cmdAtpg(vector<string> &args);
+int		cmdScoap(vector<string> &args);
+int		cmdSymbolic(vector<string> &args);
+int		cmdEquiv(vector<string> &args);
+int		cmdBmc(vector<string> &args);
+int		cmdArith(vector<string> &args);
+Circuit*	openCircuit(string cir, string vec);
+Circuit*	readCircuit(string cir);
+long	argNumber(vector<string> &args, int &a, long lo, long hi, string opt = "") throw (BasicException);
+long	argTime(vector<string> &args, int &a, string opt = "") throw (BasicException);
+double	argChance(vector<string> &args, int &a, string opt = "") throw (BasicException);
+unsigned long long	argSeed(vector<string> &args, int &a, int base) throw (BasicException);
+long	maxThreads();
+void	dfsPads(Netlist *net, vector<string> &names);
+void	coutWave(int tEnd, PadState *tP);
+stopwatch	startWatch();
+double	seconds(stopwatch from);
+double	cpuSeconds(stopwatch from);
+string	scoapCost(int c);
+
+//========================
+//Usage
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Prints the command line summary.
+//Returns:
+//	int	-	1, for use as main's failure status
+//========================
+int usage()
+{
+	cout << "usage: digibatch run <circuit.txt> [vector.txt] [options]" << endl;
+	cout << "  -engine object|compiled|event|window|aig" << endl;
+	cout << "                            simulate the Gate objects, a compiled netlist step by" << endl;
+	cout << "                            step, a compiled netlist event by event, windows of" << endl;
+	cout << "                            time side by side, or a rewritten and-inverter graph" << endl;
+	cout << "                            with no delays (the last two without feedback)" << endl;
+	cout << "  -order file|level|dfs|rcm|best" << endl;
+	cout << "                            gate order of the compiled netlist" << endl;
+	cout << "  -lut k                    collapse fanout-free cones into k-input lookup tables" << endl;
+	cout << "  -optimize                 drop dead, duplicate and double-NOT gates; waveforms kept" << endl;
+	cout << "  -functional               optimize further, keeping only the settled 0/1 outputs" << endl;
+	cout << "  -threads n                run the compiled, event or window engine on n threads" << endl;
+	cout << "  -stats                    report netlist locality and run time" << endl;
+	cout << "usage: digibatch regress <circuit.txt> <vector.txt>... [options]" << endl;
+	cout << "  -procs n                  run the vectors in n worker processes" << endl;
+	cout << "  -results mb               size of the shared results area (default 64)" << endl;
+	cout << "  -order, -lut              as for run" << endl;
+	cout << "  -optimize, -functional    as for run" << endl;
+	cout << "usage: digibatch stream <circuit.txt> [vector.txt] [options]" << endl;
+	cout << "  -batch n                  records handed between threads at a time" << endl;
+	cout << "  -sort                     sort the vector file by time first (see sort)" << endl;
+	cout << "  -o file                   write the output changes to file, not the screen" << endl;
+	cout << "  -order, -lut, -stats      as for run" << endl;
+	cout << "  -optimize, -functional    as for run" << endl;
+	cout << "usage: digibatch sort <vector.txt> <sorted.txt> [options]" << endl;
+	cout << "  -memory n                 INPUT lines to sort in memory at once (default 1000000)" << endl;
+	cout << "usage: digibatch pack <circuit.txt> <sorted.txt> <vector.dgv>" << endl;
+	cout << "                            convert a sorted vector file to the binary format," << endl;
+	cout << "                            which run, regress and stream also accept" << endl;
+	cout << "usage: digibatch truth <circuit.txt> [options]" << endl;
+	cout << "                            settled outputs for every input combination" << endl;
+	cout << "  -x                        X as a third input state (3^n rows, not 2^n)" << endl;
+	cout << "  -hash                     print a hash of each output column, not the column" << endl;
+	cout << "  -threads n                enumerate on n threads" << endl;
+	cout << "  -lut, -stats              as for run" << endl;
+	cout << "  -optimize, -functional    as for run" << endl;
+	cout << "usage: digibatch random <circuit.txt> [options]" << endl;
+	cout << "                            run on random input and print each run's output hash" << endl;
+	cout << "  -seed n                   seed every run from n (default 1)" << endl;
+	cout << "  -runs n                   independent runs (default 1)" << endl;
+	cout << "  -time ns                  length of each run (default 1000)" << endl;
+	cout << "  -toggle p                 chance per ns an input changes (default 0.1)" << endl;
+	cout << "  -xrate p                  chance per ns an input goes to X (default 0)" << endl;
+	cout << "  -hold ns                  fewest ns an input holds a state (default 1)" << endl;
+	cout << "  -pad ID p x ns            toggle, X rate and hold for one input pad" << endl;
+	cout << "  -wave r                   print run r's waveforms" << endl;
+	cout << "  -save r file              save run r's input as a vector file" << endl;
+	cout << "  -threads n                share the runs among n threads" << endl;
+	cout << "  -order, -lut, -stats      as for run" << endl;
+	cout << "  -optimize, -functional    as for run" << endl;
+	cout << "usage: digibatch faults <circuit.txt> [vector.txt] [options]" << endl;
+	cout << "                            stuck-at fault coverage of the vector's patterns" << endl;
+	cout << "  -collapse                 merge equivalent faults first" << endl;
+	cout << "  -concurrent               concurrent fault simulation (one thread)" << endl;
+	cout << "  -threads n                share the fault list among n threads" << endl;
+	cout << "  -stats                    as for run" << endl;
+	cout << "usage: digibatch atpg <circuit.txt> <vector.txt> [options]" << endl;
+	cout << "                            write a compacted stuck-at test vector" << endl;
+	cout << "  -backtracks n             give up on a fault after n backtracks (100)" << endl;
+	cout << "  -seed n                   seed for random patterns and unset inputs (1)" << endl;
+	cout << "  -stats                    as for run" << endl;
+	cout << "usage: digibatch scoap <circuit.txt> [options]" << endl;
+	cout << "                            SCOAP testability; lists the hardest wires" << endl;
+	cout << "  -top n                    how many wires to list (10)" << endl;
+	cout << "  -all                      list every wire's measures" << endl;
+	cout << "  -stats                    as for run" << endl;
+	cout << "usage: digibatch symbolic <circuit.txt> [other.txt] [options]" << endl;
+	cout << "                            each output as a BDD of the inputs, or" << endl;
+	cout << "                            whether two circuits' outputs are the same" << endl;
+	cout << "  -order pads|dfs           variable order: input pads' or depth-first" << endl;
+	cout << "  -reorder                  sift the variable order as the BDDs grow" << endl;
+	cout << "  -nodes n                  give up past n BDD nodes" << endl;
+	cout << "  -dump                     print each output's BDD" << endl;
+	cout << "  -stats                    as for run" << endl;
+	cout << "usage: digibatch equiv <a.txt> <b.txt> [options]" << endl;
+	cout << "                            prove two circuits' outputs the same, by SAT" << endl;
+	cout << "  -cex file                 write the counterexamples as a vector for a.txt" << endl;
+	cout << "  -cex2 file                the same, for b.txt" << endl;
+	cout << "  -conflicts n              give up on an internal wire after n conflicts (100)" << endl;
+	cout << "  -seed n                   seed for the random patterns (1)" << endl;
+	cout << "  -stats                    as for run" << endl;
+	cout << "usage: digibatch bmc <circuit.txt> <props.txt> [options]" << endl;
+	cout << "                            check assertions over every input sequence" << endl;
+	cout << "  -depth n                  check through n ns (20)" << endl;
+	cout << "  -x                        let input pads be X as well as 0 and 1" << endl;
+	cout << "  -cex file                 write the failing sequence as a vector" << endl;
+	cout << "  -stats                    as for run" << endl;
+	cout << "usage: digibatch arith <circuit.txt> <spec.txt> [options]" << endl;
+	cout << "                            check output buses against arithmetic on input buses" << endl;
+	cout << "  -show n                   report the first n mismatches (10)" << endl;
+	cout << "  -threads n                sweep on n threads (one per processor)" << endl;
+	cout << "  -lut, -stats              as for run" << endl;
+	cout << "  -optimize, -functional    as for run" << endl;
+	return 1;
+}
+
+//========================
+//Open Circuit
+//========================
+//Parameters:
+//	string	cir	-	circuit file name
+//	string	vec	-	vector file name, or "" for the circuit's _v.txt
+//Summary:
+//	Loads and validates a circuit, then loads its vector, reporting any
+//		problem the way the interactive program does.
+//Returns:
+//	Circuit*	-	the loaded circuit, or NULL on failure
+//========================
+Circuit* openCircuit(string cir, string vec)
+{
+	Circuit* crc = NULL;
+
+	if (vec == "")
+	{
+		vec = cir;
+
+		if ((vec.size() > 4) && (vec.substr(vec.size() - 4) == ".txt"))
+			vec = vec.substr(0, vec.size() - 4);
+
+		vec.append("_v.txt");
+	}
+
+	fstream fcir;
+	ZipIn	fvec(vec);
+
+	fcir.open(cir.c_str(), fstream::in);
+
+	if (fcir.good() == 0)
+	{
+		cout << "Unable to open source file." << endl;
+		return NULL;
+	}
+
+	if (fvec.good() == 0)
+	{
+		cout << "Unable to open vector file." << endl;
+		return NULL;
+	}
+
+	try
+	{
+		crc = loadCircuit(fcir);
+	}
+	catch(BasicException e)
+	{
+		cout << "Error reading from Circuit Input file:" << e.getMessage() << endl;
+		return NULL;
+	}
+
+	try
+	{
+		crc->validate();
+	}
+	catch(InvalidCircuit v)
+	{
+		cout << v.getMessage() << endl;
+		delete crc;
+		return NULL;
+	}
+
+	try
+	{
+		loadVector(crc, fvec);
+	}
+	catch(BasicException g)
+	{
+		cout << "Error reading Vector File: " << g.getMessage() << endl;
+		delete crc;
+		return NULL;
+	}
+
+	return crc;
+}
+
+//========================
+//Read Circuit
+//========================
+//Parameters:
+//	string	cir	-	circuit file name
+//Summary:
+//	Loads and validates a circuit for the commands that need no vector,
+//		reporting any problem the way openCircuit does.
+//Returns:
+//	Circuit*	-	the loaded circuit, or NULL on failure
+//========================
+Circuit* readCircuit(string cir)
+{
+	Circuit*	crc = NULL;
+	fstream		fcir;
+
+	fcir.open(cir.c_str(), fstream::in);
+
+	if (fcir.good() == 0)
+	{
+		cout << "Unable to open source file." << endl;
+		return NULL;
+	}
+
+	try
+	{
+		crc = loadCircuit(fcir);
+	}
+	catch(BasicException e)
+	{
+		cout << "Error reading from Circuit Input file:" << e.getMessage() << endl;
+		return NULL;
+	}
+
+	try
+	{
+		crc->validate();
+	}
+	catch(InvalidCircuit v)
+	{
+		cout << v.getMessage() << endl;
+		delete crc;
+		return NULL;
+	}
+
+	return crc;
+}
+
+//========================
+//Option Number
+//========================
+//Parameters:
+//	vector<string>	&args	-	a command's arguments
+//	int				&a		-	an option's index; moved on to its value
+//	long			lo		-	the least value allowed
+//	long			hi		-	the most
+//	string			opt		-	the option's name, if not args[a]
+//Summary:
+//	Reads the whole number following an option. Anything else, such as
+//		"abc", "4x" or a value out of range, is an error naming the
+//		option, rather than the 0 atoi would make of it.
+//Returns:
+//	long	-	the value
+//========================
+long	argNumber(vector<string> &args, int &a, long lo, long hi, string opt) throw (BasicException)
+{
+	if (opt == "")
+		opt = args[a];
+
+	string	tN = args[++a];
+	char*	end = NULL;
+	char	buf[160];
+
+	errno = 0;
+
+	long v = strtol(tN.c_str(), &end, 10);
+
+	if ((tN == "") || (*end != '\0') || (errno == ERANGE) || (v < lo) || (v > hi))
+	{
+		if (hi == LONG_MAX || hi == INT_MAX)
+			sprintf(buf, "%s needs a whole number of at least %ld, not \"%.40s\".", opt.c_str(), lo, tN.c_str());
+		else
+			sprintf(buf, "%s needs a whole number from %ld to %ld, not \"%.40s\".", opt.c_str(), lo, hi, tN.c_str());
+
+		throw BasicException(buf);
+	}
+
+	return v;
+}
+
+//========================
+//Option Time
+//========================
+//Parameters:
+//	vector<string>	&args	-	a command's arguments
+//	int				&a		-	an option's index; moved on to its value
+//	string			opt		-	the option's name, if not args[a]
+//Summary:
+//	Reads the time, in whole ns of at least 1, following an option. As
+//		in a vector file, a trailing "ns" is allowed.
+//Returns:
+//	long	-	the value
+//========================
+long	argTime(vector<string> &args, int &a, string opt) throw (BasicException)
+{
+	string	&tT = args[a + 1];
+
+	if ((tT.size() > 2) && (tT.substr(tT.size() - 2) == "ns"))
+		tT = tT.substr(0, tT.size() - 2);
+
+	return argNumber(args, a, 1, INT_MAX, opt);
+}
+
+//========================
+//Option Chance
+//========================
+//Parameters:
+//	vector<string>	&args	-	a command's arguments
+//	int				&a		-	an option's index; moved on to its value
+//	string			opt		-	the option's name, if not args[a]
+//Summary:
+//	Reads the chance, from 0 to 1, following an option.
+//Returns:
+//	double	-	the value
+//========================
+double	argChance(vector<string> &args, int &a, string opt) throw (BasicException)
+{
+	if (opt == "")
+		opt = args[a];
+
+	string	tN = args[++a];
+	char*	end = NULL;
+
+	double v = strtod(tN.c_str(), &end);
+
+	if ((tN == "") || (*end != '\0') || !(v >= 0) || (v > 1))
+		throw BasicException(opt + " needs a chance from 0 to 1, not \"" + tN + "\".");
+
+	return v;
+}
+
+//========================
+//Option Seed
+//========================
+//Parameters:
+//	vector<string>	&args	-	a command's arguments
+//	int				&a		-	an option's index; moved on to its value
+//	int				base	-	as for strtoull: 10, or 0 to allow hex too
+//Summary:
+//	Reads the unsigned 64-bit seed following an option.
+//Returns:
+//	unsigned long long	-	the value
+//========================
+unsigned long long	argSeed(vector<string> &args, int &a, int base) throw (BasicException)
+{
+	string	opt = args[a];
+	string	tN = args[++a];
+	char*	end = NULL;
+
+	errno = 0;
+
+	unsigned long long v = strtoull(tN.c_str(), &end, base);
+
+	if ((tN == "") || (tN[0] == '-') || (*end != '\0') || (errno == ERANGE))
+		throw BasicException(opt + " needs a whole number of at least 0, not \"" + tN + "\".");
+
+	return v;
+}
+
+//========================
+//Max Threads
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The most threads -threads may ask for: a few per processor, so a
+//		slip of the keyboard cannot start thousands.
+//Returns:
+//	long	-	the limit
+//========================
+long	maxThreads()
+{
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (cpus < 1) ? MAX_THREADS_PER_CPU : cpus * MAX_THREADS_PER_CPU;
+}
+
+//========================
+//Print Waveform
+//========================
+//Parameters:
+//	int			tEnd	-	the last time increment to print
+//	PadState	*tP		-	the PadState to display
+//Summary:
+//	Prints a PadState as "ID: " followed by one state digit per
+//		nanosecond, 0 through tEnd (2 is indeterminate).
+//Returns:
+//	n/a
+//========================
+void coutWave(int tEnd, PadState *tP)
+{
+	cout << tP->getID() << ": ";
+
+	for (int ct = 0; ct <= tEnd; ct++)
+	{
+		if (tP->cntStates() == 0)
+			cout << indet;
+		else
+			cout << tP->getState(ct);
+	}
+
+	cout << endl;
+}
+
+//========================
+//Start Watch
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Notes the time now, for seconds and cpuSeconds.
+//Returns:
+//	stopwatch	-	the wall clock and processor time now
+//========================
+stopwatch startWatch()
+{
+	timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return stopwatch(ts.tv_sec + ts.tv_nsec / 1e9, clock());
+}
+
+//========================
+//Seconds
+//========================
+//Parameters:
+//	stopwatch	from	-	a startWatch()
+//Summary:
+//	Wall clock seconds since from, which is what shrinks when more
+//		threads share the work.
+//Returns:
+//	double	-	elapsed seconds
+//========================
+double seconds(stopwatch from)
+{
+	return startWatch().first - from.first;
+}
+
+//========================
+//CPU Seconds
+//========================
+//Parameters:
+//	stopwatch	from	-	a startWatch()
+//Summary:
+//	Processor seconds since from, summed over every thread.
+//Returns:
+//	double	-	processor seconds
+//========================
+double cpuSeconds(stopwatch from)
+{
+	return ((double) (clock() - from.second)) / CLOCKS_PER_SEC;
+}
+
+//========================
+//Run Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "run"
+//Summary:
+//	Loads a circuit and vector, simulates to the traced run time with
+//		the chosen engine, and prints every pad's waveform.
+//Returns:
+//	int	-	status of the function, 0 for Success, 1 for Failure
+//========================
+int cmdRun(vector<string> &args)
+{
+	string		cir = "";
+	string		vec = "";
+	string		eng = "compiled";
+	orderType	ord = oFile;
+	bool		stats = false;
+	int			lut = 0;
+	bool		opt = false;
+	bool		functional = false;
+	int			threads = 1;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-order") && (a + 1 < args.size()))
+				ord = parseOrder(args[++a]);
+			else if ((args[a] == "-engine") && (a + 1 < args.size()))
+				eng = args[++a];
+			else if ((args[a] == "-lut") && (a + 1 < args.size()))
+				lut = argNumber(args, a, 2, 8);
+			else if (args[a] == "-optimize")
+				opt = true;
+			else if (args[a] == "-functional")
+				opt = functional = true;
+			else if ((args[a] == "-threads") && (a + 1 < args.size()))
+				threads = argNumber(args, a, 1, maxThreads());
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else if (vec == "")
+				vec = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if ((cir == "") || ((eng != "object") && (eng != "compiled") && (eng != "event") && (eng != "window") && (eng != "aig")))
+		return usage();
+
+	Circuit* crc = openCircuit(cir, vec);
+
+	if (crc == NULL)
+		return 1;
+
+	try
+	{
+		int trace = crc->getVector()->trace();
+
+		cout << "Circuit Run Time: " << trace << "ns" << endl;
+
+		stopwatch start = startWatch();
+
+		if (eng == "object")
+			crc->run(trace);
+		else
+		{
+			Netlist net(crc);
+
+			int removed = opt ? net.optimize(functional) : 0;
+			int folded = (lut > 0) ? net.collapse(lut) : 0;
+
+			net.reorder(ord);
+
+			if (stats)
+			{
+				char buf[160];
+
+				if (opt)
+				{
+					sprintf(buf, "Optimized away %d gates%s", removed, functional ? " (functional)" : "");
+					cout << buf << endl;
+				}
+
+				if (lut > 0)
+				{
+					sprintf(buf, "Collapsed %d gates into %d-input lookup tables", folded, lut);
+					cout << buf << endl;
+				}
+
+				sprintf(buf, "Netlist: %d gates, %d wires, %d levels, order %s",
+					net.cntGates(), net.cntWires(), net.getMaxLevel(), orderName(net.getOrder()).c_str());
+				cout << buf << endl;
+
+				sprintf(buf, "  avg gate distance %.2f, avg wire distance %.2f, %.1f%% of fan-ins within 64 gates",
+					net.avgGateDistance(), net.avgWireDistance(), net.pctNear(64));
+				cout << buf << endl;
+			}
+
+			if (eng == "event")
+			{
+				EventEngine sim(&net, threads);
+
+				sim.run(crc->getVector(), trace);
+
+				if (stats)
+				{
+					char buf[160];
+
+					sprintf(buf, "  %ld events in %ld windows, %d thread(s)", sim.getEvents(), sim.getWindows(), sim.cntThreads());
+					cout << buf << endl;
+
+					if (sim.cntThreads() > 1)
+						sprintf(buf, "  lookahead %dns", sim.getLookahead());
+					else
+						sprintf(buf, "  lookahead unbounded (one partition)");
+					cout << buf << endl;
+				}
+			}
+			else if (eng == "aig")
+			{
+				Aig sim(&net);
+				int ands = sim.cntAnds();
+				int rewritten = sim.rewrite();
+
+				sim.run(crc->getVector(), trace);
+
+				if (stats)
+				{
+					char buf[160];
+
+					sprintf(buf, "  AIG: %d inputs, %d ANDs, %d removed by rewriting, depth %d, %ld bytes",
+						sim.cntInputs(), ands - rewritten, rewritten, sim.getDepth(), sim.cntBytes());
+					cout << buf << endl;
+				}
+			}
+			else if (eng == "window")
+			{
+				WindowEngine sim(&net, threads);
+
+				sim.run(crc->getVector(), trace);
+
+				if (stats)
+				{
+					char buf[160];
+
+					sprintf(buf, "  %d window(s), %dns warm-up each", sim.cntThreads(), sim.getWarmup());
+					cout << buf << endl;
+				}
+			}
+			else
+			{
+				Engine sim(&net, threads);
+
+				sim.run(crc->getVector(), trace);
+
+				if (stats)
+				{
+					cout << "  " << sim.getBinarySteps() << " of " << trace + 1 << " steps X-free (binary kernel)" << endl;
+					cout << "  " << sim.cntThreads() << " thread(s)" << endl;
+				}
+			}
+		}
+
+		if (stats)
+		{
+			char buf[120];
+
+			sprintf(buf, "Simulated %dns in %.3fs (%.3fs CPU, %s engine)", trace + 1, seconds(start), cpuSeconds(start), eng.c_str());
+			cout << buf << endl;
+		}
+
+		for (int ps = 0; ps < crc->getVector()->cntPadStates(); ps++)
+			coutWave(trace, crc->getVector()->getPadState(ps));
+	}
+	catch(BasicException e)
+	{
+		cout << "Error running circuit: " << e.getMessage() << endl;
+		delete crc;
+		return 1;
+	}
+
+	delete crc;
+
+	return 0;
+}
+
+//========================
+//Regress Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "regress"
+//Summary:
+//	Loads and compiles a circuit once, then runs every vector file given
+//		against it in worker processes and prints each one's output pads.
+//		See Regression.
+//Returns:
+//	int	-	status of the function, 0 for Success, 1 for Failure
+//========================
+int cmdRegress(vector<string> &args)
+{
+	string			cir = "";
+	vector<string>	vecs;
+	orderType		ord = oFile;
+	int				lut = 0;
+	bool			opt = false;
+	bool			functional = false;
+	int				procs = 1;
+	long			mb = 64;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-order") && (a + 1 < args.size()))
+				ord = parseOrder(args[++a]);
+			else if ((args[a] == "-lut") && (a + 1 < args.size()))
+				lut = argNumber(args, a, 2, 8);
+			else if (args[a] == "-optimize")
+				opt = true;
+			else if (args[a] == "-functional")
+				opt = functional = true;
+			else if ((args[a] == "-procs") && (a + 1 < args.size()))
+				procs = argNumber(args, a, 1, INT_MAX);
+			else if ((args[a] == "-results") && (a + 1 < args.size()))
+				mb = argNumber(args, a, 1, LONG_MAX >> 20);
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else
+				vecs.push_back(args[a]);
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if ((cir == "") || vecs.empty())
+		return usage();
+
+	Circuit*	crc = readCircuit(cir);
+	int			status = 1;
+
+	if (crc == NULL)
+		return 1;
+
+	try
+	{
+		Netlist net(crc);
+
+		if (opt)
+			net.optimize(functional);
+
+		if (lut > 0)
+			net.collapse(lut);
+
+		net.reorder(ord);
+
+		Regression reg(crc, &net, vecs, mb * 1024 * 1024);
+
+		reg.run(procs);
+
+		status = reg.report(cout);
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+	}
+
+	delete crc;
+
+	return status;
+}
+
+//========================
+//Stream Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "stream"
+//Summary:
+//	Loads and compiles a circuit, then streams a time-sorted vector file
+//		through it, printing output pad changes as OUTPUT lines while the
+//		file is still being read. See Pipeline.
+//Returns:
+//	int	-	status of the function, 0 for Success, 1 for Failure
+//========================
+int cmdStream(vector<string> &args)
+{
+	string		cir = "";
+	string		vec = "";
+	orderType	ord = oFile;
+	int			lut = 0;
+	bool		opt = false;
+	bool		functional = false;
+	int			batch = 4096;
+	long		memory = 1000000;
+	bool		stats = false;
+	bool		sorting = false;
+	string		dst = "";
+	ZipIn*		sorted = NULL;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-order") && (a + 1 < args.size()))
+				ord = parseOrder(args[++a]);
+			else if ((args[a] == "-lut") && (a + 1 < args.size()))
+				lut = argNumber(args, a, 2, 8);
+			else if (args[a] == "-optimize")
+				opt = true;
+			else if (args[a] == "-functional")
+				opt = functional = true;
+			else if ((args[a] == "-batch") && (a + 1 < args.size()))
+				batch = argNumber(args, a, 1, INT_MAX);
+			else if ((args[a] == "-memory") && (a + 1 < args.size()))
+				memory = argNumber(args, a, 1, LONG_MAX);
+			else if (args[a] == "-sort")
+				sorting = true;
+			else if ((args[a] == "-o") && (a + 1 < args.size()))
+				dst = args[++a];
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else if (vec == "")
+				vec = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if (cir == "")
+		return usage();
+
+	if (vec == "")
+	{
+		vec = cir;
+
+		if ((vec.size() > 4) && (vec.substr(vec.size() - 4) == ".txt"))
+			vec = vec.substr(0, vec.size() - 4);
+
+		vec.append("_v.txt");
+	}
+
+	ZipIn	fvec(vec);
+
+	if (fvec.good() == 0)
+	{
+		cout << "Unable to open vector file." << endl;
+		return 1;
+	}
+
+	if (sorting) // stream from a sorted scratch copy instead.
+	{
+		char	path[] = "/tmp/digibatchXXXXXX";
+		int		fd = mkstemp(path);
+
+		if (fd < 0)
+		{
+			cout << "Unable to create a scratch file for sorting." << endl;
+			return 1;
+		}
+
+		close(fd);
+
+		fstream fsort;
+
+		fsort.open(path, fstream::out | fstream::trunc);
+
+		try
+		{
+			sortVector(fvec, fsort, memory);
+		}
+		catch(BasicException e)
+		{
+			cout << "Error reading Vector File: " << e.getMessage() << endl;
+			unlink(path);
+			return 1;
+		}
+
+		fsort.close();
+
+		if (fsort.fail())
+		{
+			cout << "Unable to write a scratch file for sorting." << endl;
+			unlink(path);
+			return 1;
+		}
+
+		sorted = new ZipIn(path);
+		unlink(path); // gone once closed.
+	}
+
+	ZipOut* fout = NULL;
+
+	if (dst != "")
+	{
+		fout = new ZipOut(dst);
+
+		if (fout->good() == 0)
+		{
+			cout << "Unable to open output file." << endl;
+			delete fout;
+			delete sorted;
+			return 1;
+		}
+	}
+
+	Circuit*	crc = readCircuit(cir);
+	int			status = 1;
+
+	if (crc == NULL)
+	{
+		delete fout;
+		delete sorted;
+		return 1;
+	}
+
+	try
+	{
+		crc->setVector(newVector(crc, "stream"));
+
+		Netlist net(crc);
+
+		if (opt)
+			net.optimize(functional);
+
+		if (lut > 0)
+			net.collapse(lut);
+
+		net.reorder(ord);
+
+		int tail = net.getPathDelay(); // the netlist that runs, not the Gate objects.
+
+		if (tail < 0) // feedback: no path delay, so trace the Gate objects.
+			tail = crc->getVector()->trace();
+
+		Pipeline pipe(&net, tail, batch);
+
+		stopwatch	start = startWatch();
+		int			tEnd = pipe.run((sorted != NULL) ? *sorted : fvec, (fout != NULL) ? *fout : cout);
+
+		if (fout != NULL)
+		{
+			fout->close();
+
+			if (fout->good() == 0)
+				throw BasicException("Unable to write output file.");
+		}
+
+		if (stats)
+		{
+			char buf[120];
+
+			sprintf(buf, "Streamed %dns in %.3fs (%.3fs CPU)", tEnd + 1, seconds(start), cpuSeconds(start));
+			cerr << buf << endl;
+		}
+
+		status = 0;
+	}
+	catch(BasicException e)
+	{
+		cout << "Error running circuit: " << e.getMessage() << endl;
+	}
+
+	delete crc;
+	delete fout;
+	delete sorted;
+
+	return status;
+}
+
+//========================
+//Sort Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "sort"
+//Summary:
+//	Sorts a vector file by time into a new file, for streaming. See
+//		sortVector.
+//Returns:
+//	int	-	status of the function, 0 for Success, 1 for Failure
+//========================
+int cmdSort(vector<string> &args)
+{
+	string	src = "";
+	string	dst = "";
+	long	memory = 1000000;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-memory") && (a + 1 < args.size()))
+				memory = argNumber(args, a, 1, LONG_MAX);
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (src == "")
+				src = args[a];
+			else if (dst == "")
+				dst = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if (dst == "")
+		return usage();
+
+	ZipIn	fin(src);
+
+	if (fin.good() == 0)
+	{
+		cout << "Unable to open vector file." << endl;
+		return 1;
+	}
+
+	ZipOut	fout(dst);
+
+	if (fout.good() == 0)
+	{
+		cout << "Unable to open output file." << endl;
+		return 1;
+	}
+
+	try
+	{
+		sortVector(fin, fout, memory);
+	}
+	catch(BasicException e)
+	{
+		cout << "Error reading Vector File: " << e.getMessage() << endl;
+		return 1;
+	}
+
+	fout.close();
+
+	if (fout.good() == 0)
+	{
+		cout << "Unable to write output file." << endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+//========================
+//Pack Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "pack"
+//Summary:
+//	Converts a time sorted vector file to a binary vector file, with
+//		the pads in the circuit's order. See packVector.
+//Returns:
+//	int	-	status of the function, 0 for Success, 1 for Failure
+//========================
+int cmdPack(vector<string> &args)
+{
+	if (args.size() != 3)
+		return usage();
+
+	Circuit* crc = readCircuit(args[0]);
+
+	if (crc == NULL)
+		return 1;
+
+	ZipIn	fin(args[1]);
+
+	if (fin.good() == 0)
+	{
+		cout << "Unable to open vector file." << endl;
+		delete crc;
+		return 1;
+	}
+
+	ZipOut	fout(args[2]);
+
+	if (fout.good() == 0)
+	{
+		cout << "Unable to open output file." << endl;
+		delete crc;
+		return 1;
+	}
+
+	int status = 0;
+
+	try
+	{
+		packVector(crc, fin, fout);
+	}
+	catch(BasicException e)
+	{
+		cout << "Error reading Vector File: " << e.getMessage() << endl;
+		status = 1;
+	}
+
+	fout.close();
+
+	if ((status == 0) && (fout.good() == 0))
+	{
+		cout << "Unable to write output file." << endl;
+		status = 1;
+	}
+
+	delete crc;
+
+	return status;
+}
+
+//========================
+//Truth Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "truth"
+//Summary:
+//	Applies every combination of input pad states to a circuit without
+//		feedback and prints each output pad's settled state for each, one
+//		digit per row in the order of TruthTable, or with -hash, a hash of
+//		each output's column and of the whole table. No vector file is
+//		needed.
+//Returns:
+//	int	-	status of the function, 0 for Success, 1 for Failure
+//========================
+int cmdTruth(vector<string> &args)
+{
+	string	cir = "";
+	bool	x = false;
+	bool	hash = false;
+	bool	stats = false;
+	int		lut = 0;
+	bool	opt = false;
+	bool	functional = false;
+	int		threads = 1;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-lut") && (a + 1 < args.size()))
+				lut = argNumber(args, a, 2, 8);
+			else if (args[a] == "-optimize")
+				opt = true;
+			else if (args[a] == "-functional")
+				opt = functional = true;
+			else if ((args[a] == "-threads") && (a + 1 < args.size()))
+				threads = argNumber(args, a, 1, maxThreads());
+			else if (args[a] == "-x")
+				x = true;
+			else if (args[a] == "-hash")
+				hash = true;
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if (cir == "")
+		return usage();
+
+	Circuit*	crc = readCircuit(cir);
+	int			status = 0;
+
+	if (crc == NULL)
+		return 1;
+
+	try
+	{
+		Netlist net(crc);
+
+		if (opt)
+			net.optimize(functional);
+
+		if (lut > 0)
+			net.collapse(lut);
+
+		TruthTable tt(&net, x, threads);
+
+		stopwatch start = startWatch();
+
+		tt.run(!hash);
+
+		cout << "Inputs:";
+
+		for (int ip = 0; ip < net.cntiPads(); ip++)
+			cout << " " << net.getiPadID(ip);
+
+		cout << " (first changes fastest), " << tt.cntRows() << " rows" << endl;
+
+		if (stats)
+		{
+			char buf[120];
+
+			sprintf(buf, "Enumerated in %.3fs (%.3fs CPU) on %d thread(s)", seconds(start), cpuSeconds(start), tt.cntThreads());
+			cout << buf << endl;
+		}
+
+		for (int op = 0; op < net.cntoPads(); op++)
+		{
+			cout << net.getoPadID(op) << ": ";
+
+			if (hash)
+			{
+				char buf[24];
+
+				sprintf(buf, "%016llx", tt.getHash(op));
+				cout << buf;
+			}
+			else
+			{
+				for (unsigned long long r = 0; r < tt.cntRows(); r++)
+					cout << tt.getState(op, r);
+			}
+
+			cout << endl;
+		}
+
+		if (hash)
+		{
+			char buf[40];
+
+			sprintf(buf, "Table: %016llx", tt.getHash());
+			cout << buf << endl;
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		status = 1;
+	}
+
+	delete crc;
+
+	return status;
+}
+
+//========================
+//Random Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "random"
+//Summary:
+//	Runs a circuit on seeded random input, as many independent runs as
+//		asked, and prints each run's output hash. A run can be printed as
+//		waveforms or its input saved as a vector file to reproduce it
+//		with run. See RandomRuns.
+//Returns:
+//	int	-	status of the function, 0 for Success, 1 for Failure
+//========================
+int cmdRandom(vector<string> &args)
+{
+	string				cir = "";
+	string				saveFile = "";
+	unsigned long long	seed = 1;
+	int					runs = 1;
+	int					tEnd = 1000;
+	double				toggle = 0.1;
+	double				xrate = 0;
+	int					hold = 1;
+	int					wave = -1;
+	int					save = -1;
+	orderType			ord = oFile;
+	bool				stats = false;
+	int					lut = 0;
+	bool				opt = false;
+	bool				functional = false;
+	int					threads = 1;
+	vector<string>		padIDs;
+	vector<double>		padToggle;
+	vector<double>		padX;
+	vector<int>			padHold;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-seed") && (a + 1 < args.size()))
+				seed = argSeed(args, a, 0);
+			else if ((args[a] == "-runs") && (a + 1 < args.size()))
+				runs = argNumber(args, a, 1, INT_MAX);
+			else if ((args[a] == "-time") && (a + 1 < args.size()))
+				tEnd = argTime(args, a);
+			else if ((args[a] == "-toggle") && (a + 1 < args.size()))
+				toggle = argChance(args, a);
+			else if ((args[a] == "-xrate") && (a + 1 < args.size()))
+				xrate = argChance(args, a);
+			else if ((args[a] == "-hold") && (a + 1 < args.size()))
+				hold = argTime(args, a);
+			else if ((args[a] == "-pad") && (a + 4 < args.size()))
+			{
+				padIDs.push_back(args[++a]);
+				padToggle.push_back(argChance(args, a, "-pad"));
+				padX.push_back(argChance(args, a, "-pad"));
+				padHold.push_back(argTime(args, a, "-pad"));
+			}
+			else if ((args[a] == "-wave") && (a + 1 < args.size()))
+				wave = argNumber(args, a, 0, INT_MAX);
+			else if ((args[a] == "-save") && (a + 2 < args.size()))
+			{
+				if (save >= 0)
+					throw BasicException("-save can only be given once.");
+
+				save = argNumber(args, a, 0, INT_MAX);
+				saveFile = args[++a];
+			}
+			else if ((args[a] == "-order") && (a + 1 < args.size()))
+				ord = parseOrder(args[++a]);
+			else if ((args[a] == "-lut") && (a + 1 < args.size()))
+				lut = argNumber(args, a, 2, 8);
+			else if (args[a] == "-optimize")
+				opt = true;
+			else if (args[a] == "-functional")
+				opt = functional = true;
+			else if ((args[a] == "-threads") && (a + 1 < args.size()))
+				threads = argNumber(args, a, 1, maxThreads());
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if (cir == "")
+		return usage();
+
+	Circuit*	crc = readCircuit(cir);
+	int			status = 0;
+
+	if (crc == NULL)
+		return 1;
+
+	try
+	{
+		Netlist net(crc);
+
+		if (opt)
+			net.optimize(functional);
+
+		if (lut > 0)
+			net.collapse(lut);
+
+		net.reorder(ord);
+
+		RandomRuns rr(&net, seed, threads);
+
+		rr.setPad(-1, toggle, xrate, hold);
+
+		for (int k = 0; k < padIDs.size(); k++)
+		{
+			int ip = 0;
+
+			while ((ip < net.cntiPads()) && (net.getiPadID(ip) != padIDs[k]))
+				ip++;
+
+			if (ip == net.cntiPads())
+				throw BasicException("No input pad " + padIDs[k] + ".");
+
+			rr.setPad(ip, padToggle[k], padX[k], padHold[k]);
+		}
+
+		stopwatch start = startWatch();
+
+		rr.run(runs, tEnd);
+
+		if (stats)
+		{
+			char buf[120];
+
+			sprintf(buf, "%d run(s) of %dns in %.3fs (%.3fs CPU) on %d thread(s)", runs, tEnd + 1, seconds(start), cpuSeconds(start), rr.cntThreads());
+			cout << buf << endl;
+		}
+
+		for (int r = 0; r < runs; r++)
+		{
+			char buf[48];
+
+			sprintf(buf, "Run %d: %016llx", r, rr.getHash(r));
+			cout << buf << endl;
+		}
+
+		if (wave >= 0)
+		{
+			crc->setVector(newVector(crc, "random"));
+			rr.record(wave, tEnd, crc->getVector());
+
+			for (int ps = 0; ps < crc->getVector()->cntPadStates(); ps++)
+				coutWave(tEnd, crc->getVector()->getPadState(ps));
+		}
+
+		if (save >= 0)
+		{
+			ZipOut fout(saveFile);
+
+			if (fout.good() == 0)
+				throw BasicException("Unable to open output file.");
+
+			if (crc->getVector() != NULL) // left by -wave.
+				delete crc->getVector();
+
+			crc->setVector(newVector(crc, "random"));
+			rr.record(save, tEnd, crc->getVector());
+
+			vector<iPadState*>* ins = crc->getVector()->getIPadStates();
+
+			fout << "VECTOR random_" << seed << "_" << save << endl;
+
+			for (int ct = 0; ct <= tEnd; ct++)
+			{
+				for (int ip = 0; ip < ins->size(); ip++)
+				{
+					PadState* tP = (*ins)[ip];
+
+					if ((ct == 0) || (tP->getState(ct) != tP->getState(ct - 1)))
+						fout << "INPUT\t" << tP->getID() << "\t" << ct << "\t" << tP->getState(ct) << endl;
+				}
+			}
+
+			delete ins;
+
+			fout.close();
+
+			if (fout.good() == 0)
+				throw BasicException("Unable to write output file.");
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		status = 1;
+	}
+
+	delete crc;
+
+	return status;
+}
+
+//========================
+//Faults Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "faults"
+//Summary:
+//	Grades a vector file by the single stuck-at faults its patterns
+//		detect, and lists the faults it misses. See FaultSim.
+//Returns:
+//	int	-	status of the function, 0 for Success, 1 for Failure
+//========================
+int cmdFaults(vector<string> &args)
+{
+	string	cir = "";
+	string	vec = "";
+	bool	stats = false;
+	bool	merge = false;
+	bool	concurrent = false;
+	int		threads = 1;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-threads") && (a + 1 < args.size()))
+				threads = argNumber(args, a, 1, maxThreads());
+			else if (args[a] == "-collapse")
+				merge = true;
+			else if (args[a] == "-concurrent")
+				concurrent = true;
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else if (vec == "")
+				vec = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if (cir == "")
+		return usage();
+
+	Circuit* crc = openCircuit(cir, vec);
+
+	if (crc == NULL)
+		return 1;
+
+	try
+	{
+		Netlist		net(crc);
+		FaultSim	fs(&net, threads);
+
+		if (merge)
+			fs.collapse();
+
+		stopwatch start = startWatch();
+
+		if (concurrent)
+			fs.runConcurrent(crc->getVector());
+		else
+			fs.run(crc->getVector());
+
+		char buf[120];
+
+		if (stats)
+		{
+			if (concurrent)
+				sprintf(buf, "Simulated concurrently in %.3fs (%.3fs CPU)", seconds(start), cpuSeconds(start));
+			else
+				sprintf(buf, "Simulated in %.3fs (%.3fs CPU) on %d thread(s)", seconds(start), cpuSeconds(start), fs.cntThreads());
+			cout << buf << endl;
+		}
+
+		sprintf(buf, "Patterns: %d", fs.cntPatterns());
+		cout << buf << endl;
+
+		if (merge)
+		{
+			sprintf(buf, "Faults: %d (collapsed from %d)", fs.cntFaults(), fs.cntUncollapsed());
+			cout << buf << endl;
+		}
+		else
+		{
+			sprintf(buf, "Faults: %d", fs.cntFaults());
+			cout << buf << endl;
+		}
+
+		sprintf(buf, "Detected: %d (%.1f%%)", fs.cntDetected(),
+			(fs.cntFaults() == 0) ? 100.0 : 100.0 * fs.cntDetected() / fs.cntFaults());
+		cout << buf << endl;
+
+		if (fs.cntDetected() < fs.cntFaults())
+			cout << "Undetected:" << endl;
+
+		for (int f = 0; f < fs.cntFaults(); f++)
+		{
+			if (fs.getDetectedBy(f) < 0)
+				cout << "  " << fs.getFaultName(f) << endl;
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		delete crc;
+		return 1;
+	}
+
+	delete crc;
+
+	return 0;
+}
+
+//========================
+//Atpg Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "atpg"
+//Summary:
+//	Generates test patterns for the collapsed stuck-at faults of a
+//		circuit without feedback and writes them as a vector file, then
+//		reports the coverage they reach. See Atpg.
+//Returns:
+//	int	-	status of the function, 0 for Success, 1 for Failure
+//========================
+int cmdAtpg(vector<string> &args)
+{
+	string				cir = "";
+	string				out = "";
+	bool				stats = false;
+	int					limit = 100;
+	unsigned long long	seed = 1;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-backtracks") && (a + 1 < args.size()))
+				limit = argNumber(args, a, 0, INT_MAX);
+			else if ((args[a] == "-seed") && (a + 1 < args.size()))
+				seed = argSeed(args, a, 10);
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else if (out == "")
+				out = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if ((cir == "") || (out == ""))
+		return usage();
+
+	Circuit*	crc = readCircuit(cir);
+	int			status = 0;
+
+	if (crc == NULL)
+		return 1;
+
+	try
+	{
+		Netlist		net(crc);
+		FaultSim	fs(&net);
+
+		fs.collapse();
+
+		Testability	tm(&net);
+		Atpg		gen(&net, &fs, &tm, limit);
+
+		stopwatch start = startWatch();
+
+		gen.run(seed);
+
+		ZipOut fout(out);
+
+		if (fout.good() == 0)
+			throw BasicException("Unable to open output file.");
+
+		gen.write(fout, "atpg_" + crc->getID());
+		fout.close();
+
+		if (fout.good() == 0)
+			throw BasicException("Unable to write output file.");
+
+		char buf[120];
+
+		if (stats)
+		{
+			sprintf(buf, "Generated in %.3fs (%.3fs CPU)", seconds(start), cpuSeconds(start));
+			cout << buf << endl;
+			sprintf(buf, "Random: %d, cubes: %d, merged to %d", gen.cntRandom(), gen.cntCubes(), gen.cntMerged());
+			cout << buf << endl;
+		}
+
+		sprintf(buf, "Patterns: %d", gen.cntPatterns());
+		cout << buf << endl;
+		sprintf(buf, "Faults: %d (collapsed from %d)", fs.cntFaults(), fs.cntUncollapsed());
+		cout << buf << endl;
+		sprintf(buf, "Detected: %d (%.1f%%)", fs.cntDetected(),
+			(fs.cntFaults() == 0) ? 100.0 : 100.0 * fs.cntDetected() / fs.cntFaults());
+		cout << buf << endl;
+		sprintf(buf, "Redundant: %d", gen.cntRedundant());
+		cout << buf << endl;
+		sprintf(buf, "Aborted: %d", gen.cntAborted());
+		cout << buf << endl;
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		status = 1;
+	}
+
+	delete crc;
+
+	return status;
+}
+
+//========================
+//SCOAP Cost
+//========================
+//Parameters:
+//	int	c	-	a SCOAP measure
+//Summary:
+//	Formats a measure for the scoap report, "inf" for SCOAP_INF.
+//Returns:
+//	string	-	the text
+//========================
+string scoapCost(int c)
+{
+	char buf[16];
+
+	if (c >= SCOAP_INF)
+		return "inf";
+
+	sprintf(buf, "%d", c);
+
+	return buf;
+}
+
+//========================
+//Scoap Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "scoap"
+//Summary:
+//	Prints how many wires can never be set or seen and the wires
+//		hardest to control (by the larger of CC0 and CC1) and to observe
+//		(by CO), or with -all, every wire's measures in netlist order.
+//		See Testability.
+//Returns:
+//	int	-	status of the function, 0 for Success, 1 for Failure
+//========================
+int cmdScoap(vector<string> &args)
+{
+	string	cir = "";
+	bool	all = false;
+	bool	stats = false;
+	int		top = 10;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-top") && (a + 1 < args.size()))
+				top = argNumber(args, a, 0, INT_MAX);
+			else if (args[a] == "-all")
+				all = true;
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if (cir == "")
+		return usage();
+
+	Circuit*	crc = readCircuit(cir);
+	int			status = 0;
+
+	if (crc == NULL)
+		return 1;
+
+	try
+	{
+		Netlist		net(crc);
+		stopwatch		start = startWatch();
+		Testability	tm(&net);
+		char		buf[120];
+		int			nW = net.cntWires();
+
+		if (stats)
+		{
+			sprintf(buf, "Measured in %.3fs (%.3fs CPU), %d controllability and %d observability pass(es)",
+				seconds(start), cpuSeconds(start), tm.cntCCPasses(), tm.cntCOPasses());
+			cout << buf << endl;
+		}
+
+		if (all)
+		{
+			cout << "Wire\tCC0\tCC1\tCO" << endl;
+
+			for (int w = 0; w < nW; w++)
+			{
+				cout << net.getWireID(w) << "\t" << scoapCost(tm.getCC0(w)) << "\t"
+					<< scoapCost(tm.getCC1(w)) << "\t" << scoapCost(tm.getCO(w)) << endl;
+			}
+		}
+		else
+		{
+			vector<pair<int, int> >	hardCC;
+			vector<pair<int, int> >	hardCO;
+			int						noCC = 0;
+			int						noCO = 0;
+
+			for (int w = 0; w < nW; w++)
+			{
+				int c = max(tm.getCC0(w), tm.getCC1(w));
+
+				if (c >= SCOAP_INF)
+					noCC++;
+
+				if (tm.getCO(w) >= SCOAP_INF)
+					noCO++;
+
+				hardCC.push_back(make_pair(-c, w));
+				hardCO.push_back(make_pair(-tm.getCO(w), w));
+			}
+
+			sort(hardCC.begin(), hardCC.end());
+			sort(hardCO.begin(), hardCO.end());
+
+			sprintf(buf, "Wires: %d", nW);
+			cout << buf << endl;
+			sprintf(buf, "Uncontrollable: %d", noCC);
+			cout << buf << endl;
+			sprintf(buf, "Unobservable: %d", noCO);
+			cout << buf << endl;
+
+			cout << "Hardest to control (CC0 CC1):" << endl;
+
+			for (int k = 0; (k < top) && (k < nW); k++)
+			{
+				int w = hardCC[k].second;
+
+				cout << "  " << net.getWireID(w) << "\t" << scoapCost(tm.getCC0(w))
+					<< "\t" << scoapCost(tm.getCC1(w)) << endl;
+			}
+
+			cout << "Hardest to observe (CO):" << endl;
+
+			for (int k = 0; (k < top) && (k < nW); k++)
+			{
+				int w = hardCO[k].second;
+
+				cout << "  " << net.getWireID(w) << "\t" << scoapCost(tm.getCO(w)) << endl;
+			}
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		status = 1;
+	}
+
+	delete crc;
+
+	return status;
+}
+
+//========================
+//Depth-First Pads
+//========================
+//Parameters:
+//	Netlist			*net	-	a netlist
+//	vector<string>	&names	-	receives its input pad IDs
+//Summary:
+//	Lists the input pads in the order a depth-first walk back from each
+//		output pad in turn first reaches them, then any it never reaches.
+//		Inputs that meet in the same cone end up near each other, which
+//		usually keeps BDDs small.
+//Returns:
+//	n/a
+//========================
+void dfsPads(Netlist *net, vector<string> &names)
+{
+	vector<bool>	seen(net->cntWires(), false);
+	vector<int>		padOf(net->cntWires(), -1);
+	vector<bool>	listed(net->cntiPads(), false);
+
+	for (int ip = 0; ip < net->cntiPads(); ip++)
+		padOf[net->getiPadWire(ip)] = ip;
+
+	names.clear();
+
+	for (int op = 0; op < net->cntoPads(); op++)
+	{
+		vector<int> stack(1, net->getoPadWire(op));
+
+		while (!stack.empty())
+		{
+			int w = stack.back();
+
+			stack.pop_back();
+
+			if (seen[w])
+				continue;
+
+			seen[w] = true;
+
+			if ((padOf[w] >= 0) && !listed[padOf[w]])
+			{
+				listed[padOf[w]] = true;
+				names.push_back(net->getiPadID(padOf[w]));
+			}
+
+			int g = net->getDriver(w);
+
+			if (g < 0)
+				continue;
+
+			for (int k = net->cntInputs(g) - 1; k >= 0; k--)
+				stack.push_back(net->getInput(g, k));
+		}
+	}
+
+	for (int ip = 0; ip < net->cntiPads(); ip++)
+	{
+		if (!listed[ip])
+			names.push_back(net->getiPadID(ip));
+	}
+}
+
+//========================
+//Symbolic Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "symbolic"
+//Summary:
+//	Builds every output pad of a circuit without feedback as a BDD of
+//		the input pads and prints its size and how many input settings
+//		make it 1, with -dump the BDD itself. Given a second circuit,
+//		builds both in one BDD, pads matched by ID, and lists each output
+//		that is not the same function in both, with an input setting
+//		where they differ. See Bdd and Symbolic.
+//Returns:
+//	int	-	status of the function, 0 for Success (or equivalent), 1 for
+//				Failure (or not)
+//========================
+int cmdSymbolic(vector<string> &args)
+{
+	string	cir = "";
+	string	other = "";
+	string	order = "pads";
+	bool	sift = false;
+	bool	dump = false;
+	bool	stats = false;
+	int		nodes = BDD_LIMIT;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-order") && (a + 1 < args.size()))
+				order = args[++a];
+			else if ((args[a] == "-nodes") && (a + 1 < args.size()))
+				nodes = argNumber(args, a, 1, INT_MAX);
+			else if (args[a] == "-reorder")
+				sift = true;
+			else if (args[a] == "-dump")
+				dump = true;
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else if (other == "")
+				other = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if ((cir == "") || ((order != "pads") && (order != "dfs")))
+		return usage();
+
+	Circuit*	crc = readCircuit(cir);
+	Circuit*	crc2 = NULL;
+	int			status = 0;
+
+	if (crc == NULL)
+		return 1;
+
+	if (other != "")
+	{
+		crc2 = readCircuit(other);
+
+		if (crc2 == NULL)
+		{
+			delete crc;
+			return 1;
+		}
+	}
+
+	Netlist*	net = NULL;
+	Netlist*	net2 = NULL;
+	Bdd*		bdd = NULL;
+	Symbolic*	sym = NULL;
+	Symbolic*	sym2 = NULL;
+
+	try
+	{
+		vector<string> names;
+
+		net = new Netlist(crc);
+
+		if (crc2 != NULL)
+			net2 = new Netlist(crc2);
+
+		if (order == "dfs")
+			dfsPads(net, names);
+		else
+		{
+			for (int ip = 0; ip < net->cntiPads(); ip++)
+				names.push_back(net->getiPadID(ip));
+		}
+
+		for (int ip = 0; (net2 != NULL) && (ip < net2->cntiPads()); ip++)
+		{
+			if (find(names.begin(), names.end(), net2->getiPadID(ip)) == names.end())
+				names.push_back(net2->getiPadID(ip));
+		}
+
+		vector<int> vars(net->cntiPads());
+		vector<int> vars2((net2 == NULL) ? 0 : net2->cntiPads());
+
+		for (int ip = 0; ip < vars.size(); ip++)
+			vars[ip] = find(names.begin(), names.end(), net->getiPadID(ip)) - names.begin();
+
+		for (int ip = 0; ip < vars2.size(); ip++)
+			vars2[ip] = find(names.begin(), names.end(), net2->getiPadID(ip)) - names.begin();
+
+		stopwatch start = startWatch();
+
+		bdd = new Bdd(names.size(), nodes);
+		bdd->setReorder(sift);
+		sym = new Symbolic(net, bdd, vars);
+		sym->run();
+
+		if (net2 != NULL)
+		{
+			sym2 = new Symbolic(net2, bdd, vars2);
+			sym2->run();
+		}
+
+		if (sift)
+			bdd->reorder();
+
+		char buf[160];
+
+		if (stats)
+		{
+			sprintf(buf, "Built in %.3fs (%.3fs CPU), %d nodes (peak %d), %d collection(s), %d reordering(s)",
+				seconds(start), cpuSeconds(start), bdd->cntNodes(), bdd->cntPeak(), bdd->cntCollections(), bdd->cntReorders());
+			cout << buf << endl;
+			cout << "Order:";
+
+			for (int lv = 0; lv < bdd->cntVars(); lv++)
+				cout << " " << names[bdd->getVarAt(lv)];
+
+			cout << endl;
+		}
+
+		if (sym2 == NULL)
+		{
+			for (int op = 0; op < net->cntoPads(); op++)
+			{
+				int f = sym->getOutput(op);
+
+				sprintf(buf, ": %d nodes, %.0Lf of %.0Lf settings", bdd->cntNodes(f), bdd->cntSat(f),
+					bdd->cntSat(1));
+				cout << net->getoPadID(op) << buf << endl;
+
+				if (dump)
+				{
+					cout << "  = " << ((f < 2) ? "" : "n") << f << endl;
+					bdd->dump(f, names, cout);
+				}
+			}
+		}
+		else
+		{
+			int differ = 0;
+
+			for (int op = 0; op < net->cntoPads(); op++)
+			{
+				int op2 = 0;
+
+				while ((op2 < net2->cntoPads()) && (net2->getoPadID(op2) != net->getoPadID(op)))
+					op2++;
+
+				if (op2 == net2->cntoPads())
+				{
+					cout << net->getoPadID(op) << ": only in " << cir << endl;
+					differ++;
+					continue;
+				}
+
+				int f = sym->getOutput(op);
+				int f2 = sym2->getOutput(op2);
+
+				if (f == f2)
+					continue;
+
+				vector<state> cube;
+
+				bdd->getCube(bdd->XOR(f, f2), cube);
+				cout << net->getoPadID(op) << ": differs at";
+
+				for (int v = 0; v < cube.size(); v++)
+				{
+					if (cube[v] != indet)
+						cout << " " << names[v] << "=" << cube[v];
+				}
+
+				cout << endl;
+				differ++;
+			}
+
+			for (int op2 = 0; op2 < net2->cntoPads(); op2++)
+			{
+				int op = 0;
+
+				while ((op < net->cntoPads()) && (net->getoPadID(op) != net2->getoPadID(op2)))
+					op++;
+
+				if (op == net->cntoPads())
+				{
+					cout << net2->getoPadID(op2) << ": only in " << other << endl;
+					differ++;
+				}
+			}
+
+			if (differ == 0)
+				cout << "Equivalent" << endl;
+			else
+			{
+				sprintf(buf, "Not equivalent: %d output(s) differ", differ);
+				cout << buf << endl;
+				status = 1;
+			}
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		status = 1;
+	}
+
+	delete sym2;
+	delete sym;
+	delete bdd;
+	delete net2;
+	delete net;
+
+	delete crc;
+	delete crc2;
+
+	return status;
+}
+
+//========================
+//Equiv Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "equiv"
+//Summary:
+//	Checks two circuits without feedback against each other, pads
+//		matched by ID, and lists each output that differs with an input
+//		setting that shows it, or an output in only one circuit. With
+//		-cex, the settings are written as a vector file. See Equiv.
+//Returns:
+//	int	-	status of the function, 0 for Success (or equivalent), 1 for
+//				Failure (or not)
+//========================
+int cmdEquiv(vector<string> &args)
+{
+	string				cir = "";
+	string				other = "";
+	string				cexOut[2] = {"", ""};
+	unsigned long long	seed = 1;
+	long				conflicts = EQ_CONFLICTS;
+	bool				stats = false;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-cex") && (a + 1 < args.size()))
+				cexOut[0] = args[++a];
+			else if ((args[a] == "-cex2") && (a + 1 < args.size()))
+				cexOut[1] = args[++a];
+			else if ((args[a] == "-seed") && (a + 1 < args.size()))
+				seed = argSeed(args, a, 10);
+			else if ((args[a] == "-conflicts") && (a + 1 < args.size()))
+				conflicts = argNumber(args, a, 0, LONG_MAX);
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else if (other == "")
+				other = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if ((cir == "") || (other == ""))
+		return usage();
+
+	Circuit*	crc = readCircuit(cir);
+	Circuit*	crc2 = NULL;
+	int			status = 0;
+
+	if (crc == NULL)
+		return 1;
+
+	crc2 = readCircuit(other);
+
+	if (crc2 == NULL)
+	{
+		delete crc;
+		return 1;
+	}
+
+	Netlist*	net = NULL;
+	Netlist*	net2 = NULL;
+	Equiv*		eq = NULL;
+
+	try
+	{
+		net = new Netlist(crc);
+		net2 = new Netlist(crc2);
+		eq = new Equiv(net, net2, seed, conflicts);
+
+		stopwatch start = startWatch();
+
+		eq->run();
+
+		char buf[160];
+
+		if (stats)
+		{
+			sprintf(buf, "Checked in %.3fs (%.3fs CPU), %ld patterns, %d SAT variables, %ld conflicts",
+				seconds(start), cpuSeconds(start), eq->cntPatterns(), eq->cntVars(), eq->cntConflicts());
+			cout << buf << endl;
+			sprintf(buf, "Internal checks: %d, proved %d, refuted %d, gave up %d",
+				eq->cntChecked(), eq->cntProved(), eq->cntRefuted(), eq->cntGaveUp());
+			cout << buf << endl;
+		}
+
+		int differ = 0;
+
+		for (int op = 0; op < net->cntoPads(); op++)
+		{
+			int p = 0;
+
+			while ((p < eq->cntPairs()) && (eq->getPair(p, 0) != op))
+				p++;
+
+			if (p == eq->cntPairs())
+			{
+				cout << net->getoPadID(op) << ": only in " << cir << endl;
+				differ++;
+				continue;
+			}
+
+			if (eq->isSame(p))
+				continue;
+
+			vector<state> in;
+
+			eq->getCex(p, in);
+			cout << net->getoPadID(op) << ": differs at";
+
+			for (int k = 0; k < in.size(); k++)
+				cout << " " << eq->getName(k) << "=" << in[k];
+
+			cout << endl;
+			differ++;
+		}
+
+		for (int op2 = 0; op2 < net2->cntoPads(); op2++)
+		{
+			int p = 0;
+
+			while ((p < eq->cntPairs()) && (eq->getPair(p, 1) != op2))
+				p++;
+
+			if (p == eq->cntPairs())
+			{
+				cout << net2->getoPadID(op2) << ": only in " << other << endl;
+				differ++;
+			}
+		}
+
+		for (int side = 0; side < 2; side++)
+		{
+			if ((cexOut[side] == "") || (eq->cntDiffer() == 0))
+				continue;
+
+			ZipOut fout(cexOut[side]);
+
+			if (fout.good() == 0)
+				throw BasicException("Unable to open output file.");
+
+			eq->write(fout, "cex_" + ((side == 0) ? crc : crc2)->getID(), side);
+			fout.close();
+
+			if (fout.good() == 0)
+				throw BasicException("Unable to write output file.");
+		}
+
+		if (differ == 0)
+			cout << "Equivalent" << endl;
+		else
+		{
+			sprintf(buf, "Not equivalent: %d output(s) differ", differ);
+			cout << buf << endl;
+			status = 1;
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		status = 1;
+	}
+
+	delete eq;
+	delete net2;
+	delete net;
+
+	delete crc;
+	delete crc2;
+
+	return status;
+}
+
+//========================
+//Bmc Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "bmc"
+//Summary:
+//	Checks a property file's assertions against a circuit, feedback and
+//		all, at every time through the depth. The first time one can
+//		fail, it is printed with the pads' waveforms up to then, and
+//		with -cex the input sequence is written as a vector file. See
+//		Bmc.
+//Returns:
+//	int	-	status of the function, 0 for Success (or no assertion fails),
+//				1 for Failure (or one does)
+//========================
+int cmdBmc(vector<string> &args)
+{
+	string	cir = "";
+	string	props = "";
+	string	cexOut = "";
+	int		depth = BMC_DEPTH;
+	bool	xIn = false;
+	bool	stats = false;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-depth") && (a + 1 < args.size()))
+				depth = argNumber(args, a, 1, INT_MAX);
+			else if ((args[a] == "-cex") && (a + 1 < args.size()))
+				cexOut = args[++a];
+			else if (args[a] == "-x")
+				xIn = true;
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else if (props == "")
+				props = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if ((cir == "") || (props == ""))
+		return usage();
+
+	Circuit*	crc = readCircuit(cir);
+	int			status = 0;
+
+	if (crc == NULL)
+		return 1;
+
+	ZipIn	fin(props);
+
+	if (fin.good() == 0)
+	{
+		cout << "Unable to open property file." << endl;
+		delete crc;
+		return 1;
+	}
+
+	Netlist*	net = NULL;
+	Bmc*		bmc = NULL;
+
+	try
+	{
+		net = new Netlist(crc);
+		bmc = new Bmc(net, xIn);
+		bmc->read(fin);
+
+		stopwatch start = startWatch();
+		int		t = bmc->run(depth);
+		char	buf[160];
+
+		if (stats)
+		{
+			sprintf(buf, "Checked in %.3fs (%.3fs CPU), %d frames, %d SAT variables, %ld conflicts",
+				seconds(start), cpuSeconds(start), bmc->cntFrames(), bmc->cntVars(), bmc->cntConflicts());
+			cout << buf << endl;
+		}
+
+		if (t < 0)
+		{
+			sprintf(buf, "No assertion fails through %dns", depth);
+			cout << buf << endl;
+		}
+		else
+		{
+			sprintf(buf, " fails at %dns", t);
+			cout << bmc->getProperty(bmc->getFailed()) << buf << endl;
+
+			for (int ip = 0; ip < net->cntiPads(); ip++)
+			{
+				cout << net->getiPadID(ip) << ": ";
+
+				for (int ct = 0; ct <= t; ct++)
+					cout << bmc->getState(net->getiPadWire(ip), ct);
+
+				cout << endl;
+			}
+
+			for (int op = 0; op < net->cntoPads(); op++)
+			{
+				cout << net->getoPadID(op) << ": ";
+
+				for (int ct = 0; ct <= t; ct++)
+					cout << bmc->getState(net->getoPadWire(op), ct);
+
+				cout << endl;
+			}
+
+			if (cexOut != "")
+			{
+				ZipOut fout(cexOut);
+
+				if (fout.good() == 0)
+					throw BasicException("Unable to open output file.");
+
+				bmc->write(fout, "cex_" + crc->getID());
+				fout.close();
+
+				if (fout.good() == 0)
+					throw BasicException("Unable to write output file.");
+			}
+
+			status = 1;
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		status = 1;
+	}
+
+	delete bmc;
+	delete net;
+	delete crc;
+
+	return status;
+}
+
+//========================
+//Arith Command
+//========================
+//Parameters:
+//	vector<string>	&args	-	the arguments following "arith"
+//Summary:
+//	Sweeps every input combination of a circuit without feedback and
+//		checks the spec file's buses against its arithmetic, printing
+//		how many rows break each check and the first mismatches with
+//		their operands. See Arith.
+//Returns:
+//	int	-	status of the function, 0 for Success (or every check holds),
+//				1 for Failure (or not)
+//========================
+int cmdArith(vector<string> &args)
+{
+	string	cir = "";
+	string	spec = "";
+	int		show = ARITH_SHOW;
+	int		threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	int		lut = 0;
+	bool	opt = false;
+	bool	functional = false;
+	bool	stats = false;
+
+	try
+	{
+		for (int a = 0; a < args.size(); a++)
+		{
+			if ((args[a] == "-show") && (a + 1 < args.size()))
+				show = argNumber(args, a, 0, INT_MAX);
+			else if ((args[a] == "-threads") && (a + 1 < args.size()))
+				threads = argNumber(args, a, 1, maxThreads());
+			else if ((args[a] == "-lut") && (a + 1 < args.size()))
+				lut = argNumber(args, a, 2, 8);
+			else if (args[a] == "-optimize")
+				opt = true;
+			else if (args[a] == "-functional")
+				opt = functional = true;
+			else if (args[a] == "-stats")
+				stats = true;
+			else if (args[a].substr(0, 1) == "-")
+				return usage();
+			else if (cir == "")
+				cir = args[a];
+			else if (spec == "")
+				spec = args[a];
+			else
+				return usage();
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		return usage();
+	}
+
+	if ((cir == "") || (spec == ""))
+		return usage();
+
+	if (threads < 1)
+		threads = 1;
+
+	Circuit*	crc = readCircuit(cir);
+	int			status = 0;
+
+	if (crc == NULL)
+		return 1;
+
+	ZipIn	fin(spec);
+
+	if (fin.good() == 0)
+	{
+		cout << "Unable to open spec file." << endl;
+		delete crc;
+		return 1;
+	}
+
+	Netlist*	net = NULL;
+	Arith*		ar = NULL;
+
+	try
+	{
+		net = new Netlist(crc);
+
+		if (opt)
+			net->optimize(functional);
+
+		if (lut > 0)
+			net->collapse(lut);
+
+		ar = new Arith(net, threads);
+		ar->read(fin);
+
+		stopwatch start = startWatch();
+
+		ar->run(show);
+
+		char	buf[160];
+		int		broken = 0;
+
+		if (stats)
+		{
+			sprintf(buf, "Swept %llu rows in %.3fs (%.3fs CPU) on %d thread(s)", ar->cntRows(), seconds(start), cpuSeconds(start), ar->cntThreads());
+			cout << buf << endl;
+		}
+
+		for (int c = 0; c < ar->cntChecks(); c++)
+		{
+			sprintf(buf, ": %llu of %llu rows fail", ar->cntFailed(c), ar->cntRows());
+			cout << ar->getCheck(c) << buf << endl;
+
+			if (ar->cntFailed(c) > 0)
+				broken++;
+		}
+
+		for (int k = 0; k < ar->cntMismatches(); k++)
+		{
+			int c = ar->getCheckOf(k);
+
+			cout << ar->getCheck(c) << " fails at";
+
+			for (int o = 0; o < ar->cntOperands(c); o++)
+			{
+				int b = ar->getOperand(c, o);
+
+				sprintf(buf, " %s=%llu", ar->getBus(b).c_str(), ar->getValue(b, ar->getRow(k)));
+				cout << buf;
+			}
+
+			sprintf(buf, ": got %llu, expected %llu", ar->getGot(k), ar->getWant(k));
+			cout << buf << endl;
+		}
+
+		if (broken == 0)
+			cout << "Every check holds" << endl;
+		else
+		{
+			sprintf(buf, "%d check(s) fail", broken);
+			cout << buf << endl;
+			status = 1;
+		}
+	}
+	catch(BasicException e)
+	{
+		cout << e.getMessage() << endl;
+		status = 1;
+	}
+
+	delete ar;
+	delete net;
+	delete crc;
+
+	return status;
+}
+
+//========================
+//Main
+//========================
+//Parameters:
+//	int		argc	-	argument count
+//	char	**argv	-	arguments; argv[1] names the command
+//Summary:
+//	Dispatches to the named command.
+//Returns:
+//	int	-	status of the program, 0 for Success, 1 for Failure
+//========================
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+		return usage();
+
+	string			cmd = argv[1];
+	vector<string>	args;
+
+	for (int a = 2; a < argc; a++)
+		args.push_back(argv[a]);
+
+	if (cmd == "run")
+		return cmdRun(args);
+
+	if (cmd == "regress")
+		return cmdRegress(args);
+
+	if (cmd == "stream")
+		return cmdStream(args);
+
+	if (cmd == "sort")
+		return cmdSort(args);
+
+	if (cmd == "pack")
+		return cmdPack(args);
+
+	if (cmd == "truth")
+		return cmdTruth(args);
+
+	if (cmd == "random")
+		return cmdRandom(args);
+
+	if (cmd == "faults")
+		return cmdFaults(args);
+
+	if (cmd == "atpg")
+		return cmdAtpg(args);
+
+	if (cmd == "scoap")
+		return cmdScoap(args);
+
+	if (cmd == "symbolic")
+		return cmdSymbolic(args);
+
+	if (cmd == "equiv")
+		return cmdEquiv(args);
+
+	if (cmd == "bmc")
+		return cmdBmc(args);
+
+	if (cmd == "arith")
+		return cmdArith(args);
+
+	return usage();
+}
@@ -0,0 +1,980 @@
+//================================================================
+//Filename:		Binary Decision Diagram Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the Bdd: the unique
+//					and computed tables, ITE, collection, and sifting.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include "logicException.h"
+#include "logic.h"
+#include "bdd.h"
+
+using namespace std;
+
+// Entries in the computed table.
+#define CACHE_SIZE		(1 << 18)
+
+// Buckets each variable's unique table starts with.
+#define UNIQUE_START	64
+
+// Nodes at which the first collection happens.
+#define GC_START		(1 << 16)
+
+// Sifting gives up on a direction once the nodes pass this share of the best.
+#define SIFT_GROWTH		1.2
+
+// Hashes a node's low and high.
+static unsigned int	hash2(int lo, int hi)
+{
+	return (unsigned int) lo * 12582917u + (unsigned int) hi * 4256249u;
+}
+
+//========================
+//Bdd Constructor
+//========================
+//Parameters:
+//	int	vars	-	how many variables, 0 to vars - 1, top to bottom
+//	int	limit	-	the most nodes to hold at once
+//Summary:
+//	Sets up the constants, empty unique tables and the computed table.
+//========================
+Bdd::Bdd(int vars, int limit) throw (BasicException)
+{
+	if ((vars < 0) || (limit < 2))
+		throw BasicException("A BDD needs a variable count and a node limit.");
+
+	nVars = vars;
+	this->limit = limit;
+
+	nVar = new vector<int>(2, vars);	// 0 and 1 sit below every level.
+	nLo = new vector<int>(2);
+	nHi = new vector<int>(2);
+	nNext = new vector<int>(2, -1);
+	nExt = new vector<int>(2, 0);
+	nRef = new vector<int>(2, 0);
+	freeList = -1;
+	nNodes = 0;
+	peak = 0;
+
+	(*nLo)[0] = (*nHi)[0] = 0;
+	(*nLo)[1] = (*nHi)[1] = 1;
+
+	unique = new vector< vector<int> >(vars, vector<int>(UNIQUE_START, -1));
+	uCount = new vector<int>(vars, 0);
+	perm = new vector<int>(vars);
+	invPerm = new vector<int>(vars);
+
+	for (int v = 0; v < vars; v++)
+		(*perm)[v] = (*invPerm)[v] = v;
+
+	cache = new vector<int>(4 * CACHE_SIZE, -1);
+	cacheMask = CACHE_SIZE - 1;
+
+	threshold = GC_START;
+	collections = 0;
+	reorders = 0;
+	autoReorder = false;
+	reordering = false;
+}
+
+//========================
+//Bdd Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases every node; functions held by ref() are gone with them.
+//========================
+Bdd::~Bdd()
+{
+	delete nVar;
+	delete nLo;
+	delete nHi;
+	delete nNext;
+	delete nExt;
+	delete nRef;
+	delete unique;
+	delete uCount;
+	delete perm;
+	delete invPerm;
+	delete cache;
+}
+
+//========================
+//Bdd Accessors
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Variables, nodes now in the unique tables, the most there have been,
+//		and how many collections and reorderings have run.
+//Returns:
+//	int	-	the count
+//========================
+int			Bdd::cntVars()
+{
+	return nVars;
+}
+
+int			Bdd::cntNodes()
+{
+	return nNodes;
+}
+
+int			Bdd::cntPeak()
+{
+	return peak;
+}
+
+int			Bdd::cntCollections()
+{
+	return collections;
+}
+
+int			Bdd::cntReorders()
+{
+	return reorders;
+}
+
+//========================
+//Bdd Function Size
+//========================
+//Parameters:
+//	int	f	-	a function
+//Summary:
+//	Counts the nodes f reaches, not counting 0 and 1.
+//Returns:
+//	int	-	the node count
+//========================
+int			Bdd::cntNodes(int f)
+{
+	vector<bool>	seen(nVar->size(), false);
+	vector<int>		stack(1, f);
+	int				count = 0;
+
+	while (!stack.empty())
+	{
+		int n = stack.back();
+
+		stack.pop_back();
+
+		if ((n < 2) || seen[n])
+			continue;
+
+		seen[n] = true;
+		count++;
+		stack.push_back((*nLo)[n]);
+		stack.push_back((*nHi)[n]);
+	}
+
+	return count;
+}
+
+//========================
+//Bdd Satisfying Count
+//========================
+//Parameters:
+//	int	f	-	a function
+//Summary:
+//	Counts the settings of all the variables that make f 1. Each node's
+//		share of settings is the mean of its low's and its high's.
+//Returns:
+//	long double	-	the count, exact below 2^64
+//========================
+long double	Bdd::cntSat(int f)
+{
+	vector<long double>	share(nVar->size(), -1.0);
+	vector<int>			stack(1, f);
+
+	share[0] = 0.0;
+	share[1] = 1.0;
+
+	while (!stack.empty())
+	{
+		int n = stack.back();
+		int lo = (*nLo)[n];
+		int hi = (*nHi)[n];
+
+		if (share[n] >= 0.0)
+			stack.pop_back();
+		else if (share[lo] < 0.0)
+			stack.push_back(lo);
+		else if (share[hi] < 0.0)
+			stack.push_back(hi);
+		else
+		{
+			share[n] = (share[lo] + share[hi]) / 2.0;
+			stack.pop_back();
+		}
+	}
+
+	return ldexpl(share[f], nVars);
+}
+
+//========================
+//Bdd Variable
+//========================
+//Parameters:
+//	int	v	-	a variable
+//Summary:
+//	The function that is 1 exactly when v is.
+//Returns:
+//	int	-	the function
+//========================
+int			Bdd::getVar(int v)
+{
+	return make(v, 0, 1);
+}
+
+//========================
+//Bdd Node Accessors
+//========================
+//Parameters:
+//	int	f	-	a function
+//	int	v	-	a variable
+//	int	level	-	a level
+//Summary:
+//	The variable f's top node tests (-1 for 0 and 1), its low and high,
+//		a variable's level in the current order (0 at the top), and the
+//		variable at a level.
+//Returns:
+//	int	-	the value asked for
+//========================
+int			Bdd::getTop(int f)
+{
+	return (f < 2) ? -1 : (*nVar)[f];
+}
+
+int			Bdd::getLow(int f)
+{
+	return (*nLo)[f];
+}
+
+int			Bdd::getHigh(int f)
+{
+	return (*nHi)[f];
+}
+
+int			Bdd::getLevel(int v)
+{
+	return (*perm)[v];
+}
+
+int			Bdd::getVarAt(int level)
+{
+	return (*invPerm)[level];
+}
+
+//========================
+//Bdd Cube
+//========================
+//Parameters:
+//	int				f		-	a function
+//	vector<state>	&cube	-	receives a state per variable
+//Summary:
+//	Finds one setting that makes f 1 by following any branch not to 0
+//		from the top; variables the path does not test are left X, and
+//		f is 1 whatever they are.
+//Returns:
+//	bool	-	false if f is 0
+//========================
+bool		Bdd::getCube(int f, vector<state> &cube)
+{
+	cube.assign(nVars, indet);
+
+	if (f == 0)
+		return false;
+
+	while (f > 1)
+	{
+		if ((*nLo)[f] != 0)
+		{
+			cube[(*nVar)[f]] = low;
+			f = (*nLo)[f];
+		}
+		else
+		{
+			cube[(*nVar)[f]] = high;
+			f = (*nHi)[f];
+		}
+	}
+
+	return true;
+}
+
+//========================
+//Bdd Reference
+//========================
+//Parameters:
+//	int	f	-	a function
+//Summary:
+//	ref() keeps f and everything it reaches through collections until
+//		the matching deref().
+//Returns:
+//	n/a
+//========================
+void		Bdd::ref(int f)
+{
+	(*nExt)[f]++;
+}
+
+void		Bdd::deref(int f)
+{
+	if ((*nExt)[f] > 0)
+		(*nExt)[f]--;
+}
+
+//========================
+//Bdd Set Reorder
+//========================
+//Parameters:
+//	bool	on	-	whether to sift at collections
+//Summary:
+//	Turns reordering at each collection on or off.
+//Returns:
+//	n/a
+//========================
+void		Bdd::setReorder(bool on)
+{
+	autoReorder = on;
+}
+
+//========================
+//Bdd Level
+//========================
+//Parameters:
+//	int	n	-	a node
+//Summary:
+//	The level of the variable n tests; nVars for 0 and 1.
+//Returns:
+//	int	-	the level
+//========================
+int			Bdd::level(int n)
+{
+	return (n < 2) ? nVars : (*perm)[(*nVar)[n]];
+}
+
+//========================
+//Bdd Insert
+//========================
+//Parameters:
+//	int	n	-	a node not in any unique table
+//Summary:
+//	Chains n into its variable's unique table, doubling the buckets when
+//		they average over two nodes.
+//Returns:
+//	n/a
+//========================
+void		Bdd::insert(int n)
+{
+	int				v = (*nVar)[n];
+	vector<int>&	b = (*unique)[v];
+	unsigned int	k = hash2((*nLo)[n], (*nHi)[n]) & (b.size() - 1);
+
+	(*nNext)[n] = b[k];
+	b[k] = n;
+
+	if (++(*uCount)[v] > 2 * (int) b.size())
+		grow(v);
+}
+
+//========================
+//Bdd Unlink
+//========================
+//Parameters:
+//	int	n	-	a node in its variable's unique table
+//Summary:
+//	Takes n out of its chain.
+//Returns:
+//	n/a
+//========================
+void		Bdd::unlink(int n)
+{
+	int				v = (*nVar)[n];
+	vector<int>&	b = (*unique)[v];
+	unsigned int	k = hash2((*nLo)[n], (*nHi)[n]) & (b.size() - 1);
+
+	if (b[k] == n)
+		b[k] = (*nNext)[n];
+	else
+	{
+		int p = b[k];
+
+		while ((*nNext)[p] != n)
+			p = (*nNext)[p];
+
+		(*nNext)[p] = (*nNext)[n];
+	}
+
+	(*uCount)[v]--;
+}
+
+//========================
+//Bdd Grow
+//========================
+//Parameters:
+//	int	v	-	a variable
+//Summary:
+//	Doubles v's buckets and rechains its nodes.
+//Returns:
+//	n/a
+//========================
+void		Bdd::grow(int v)
+{
+	vector<int>&	b = (*unique)[v];
+	vector<int>		nodes;
+
+	for (int k = 0; k < b.size(); k++)
+	{
+		for (int n = b[k]; n >= 0; n = (*nNext)[n])
+			nodes.push_back(n);
+	}
+
+	b.assign(2 * b.size(), -1);
+
+	for (int k = 0; k < nodes.size(); k++)
+	{
+		unsigned int h = hash2((*nLo)[nodes[k]], (*nHi)[nodes[k]]) & (b.size() - 1);
+
+		(*nNext)[nodes[k]] = b[h];
+		b[h] = nodes[k];
+	}
+}
+
+//========================
+//Bdd Make
+//========================
+//Parameters:
+//	int	v	-	a variable above lo's and hi's
+//	int	lo	-	the function where v is 0
+//	int	hi	-	the function where v is 1
+//Summary:
+//	The node testing v with these branches: lo itself if the branches
+//		are the same, else the one in v's unique table, made if need be.
+//		While reordering, a new node counts as a parent of its branches.
+//Returns:
+//	int	-	the node
+//========================
+int			Bdd::make(int v, int lo, int hi) throw (BasicException)
+{
+	if (lo == hi)
+		return lo;
+
+	vector<int>&	b = (*unique)[v];
+	unsigned int	k = hash2(lo, hi) & (b.size() - 1);
+
+	for (int n = b[k]; n >= 0; n = (*nNext)[n])
+	{
+		if (((*nLo)[n] == lo) && ((*nHi)[n] == hi))
+			return n;
+	}
+
+	if (!reordering && (nNodes >= limit))
+		throw BasicException("The BDD grew past its node limit.");
+
+	int n = freeList;
+
+	if (n >= 0)
+		freeList = (*nNext)[n];
+	else
+	{
+		n = nVar->size();
+		nVar->push_back(0);
+		nLo->push_back(0);
+		nHi->push_back(0);
+		nNext->push_back(-1);
+		nExt->push_back(0);
+		nRef->push_back(0);
+	}
+
+	(*nVar)[n] = v;
+	(*nLo)[n] = lo;
+	(*nHi)[n] = hi;
+	(*nExt)[n] = 0;
+	(*nRef)[n] = 0;
+
+	if (reordering)
+	{
+		(*nRef)[lo]++;
+		(*nRef)[hi]++;
+	}
+
+	insert(n);
+
+	if (++nNodes > peak)
+		peak = nNodes;
+
+	return n;
+}
+
+//========================
+//Bdd ITE
+//========================
+//Parameters:
+//	int	f	-	the condition
+//	int	g	-	the function where f is 1
+//	int	h	-	the function where f is 0
+//Summary:
+//	If f then g else h. The logic functions are all ITEs: AND is
+//		ITE(f, g, 0), OR ITE(f, 1, g), XOR ITE(f, NOT g, g), and NOT
+//		ITE(f, 0, 1).
+//Returns:
+//	int	-	the function
+//========================
+int			Bdd::ITE(int f, int g, int h) throw (BasicException)
+{
+	checkpoint(f, g, h);
+
+	return iteRec(f, g, h);
+}
+
+int			Bdd::AND(int f, int g) throw (BasicException)
+{
+	return ITE(f, g, 0);
+}
+
+int			Bdd::OR(int f, int g) throw (BasicException)
+{
+	return ITE(f, 1, g);
+}
+
+int			Bdd::XOR(int f, int g) throw (BasicException)
+{
+	checkpoint(f, g, 0);
+
+	int ng = iteRec(g, 0, 1);
+
+	return iteRec(f, ng, g);
+}
+
+int			Bdd::NOT(int f) throw (BasicException)
+{
+	return ITE(f, 0, 1);
+}
+
+//========================
+//Bdd ITE Recursion
+//========================
+//Parameters:
+//	int	f, g, h	-	as for ITE
+//Summary:
+//	Shannon expansion on the topmost variable of the three, through the
+//		computed table. Nothing is collected while it runs.
+//Returns:
+//	int	-	the function
+//========================
+int			Bdd::iteRec(int f, int g, int h) throw (BasicException)
+{
+	if (f == 1)
+		return g;
+
+	if (f == 0)
+		return h;
+
+	if (g == f)
+		g = 1;
+
+	if (h == f)
+		h = 0;
+
+	if (g == h)
+		return g;
+
+	if ((g == 1) && (h == 0))
+		return f;
+
+	unsigned int	k = (hash2(f, g) ^ ((unsigned int) h * 1500450271u)) & cacheMask;
+	int*			e = &(*cache)[4 * k];
+
+	if ((e[0] == f) && (e[1] == g) && (e[2] == h))
+		return e[3];
+
+	int top = min(level(f), min(level(g), level(h)));
+	int v = (*invPerm)[top];
+
+	int f0 = ((*nVar)[f] == v) ? (*nLo)[f] : f;
+	int f1 = ((*nVar)[f] == v) ? (*nHi)[f] : f;
+	int g0 = ((g > 1) && ((*nVar)[g] == v)) ? (*nLo)[g] : g;
+	int g1 = ((g > 1) && ((*nVar)[g] == v)) ? (*nHi)[g] : g;
+	int h0 = ((h > 1) && ((*nVar)[h] == v)) ? (*nLo)[h] : h;
+	int h1 = ((h > 1) && ((*nVar)[h] == v)) ? (*nHi)[h] : h;
+
+	int t = iteRec(f1, g1, h1);
+	int r = make(v, iteRec(f0, g0, h0), t);
+
+	e[0] = f;
+	e[1] = g;
+	e[2] = h;
+	e[3] = r;
+
+	return r;
+}
+
+//========================
+//Bdd Checkpoint
+//========================
+//Parameters:
+//	int	f, g, h	-	the arguments of the call starting
+//Summary:
+//	Once the unique tables pass the threshold, collects (and with
+//		reordering on, sifts) with the arguments held, and doubles the
+//		threshold if over half the nodes are still in use.
+//Returns:
+//	n/a
+//========================
+void		Bdd::checkpoint(int f, int g, int h)
+{
+	if (nNodes < threshold)
+		return;
+
+	ref(f);
+	ref(g);
+	ref(h);
+
+	collect();
+
+	if (autoReorder)
+		reorder();
+
+	deref(f);
+	deref(g);
+	deref(h);
+
+	if (2 * nNodes > threshold)
+		threshold *= 2;
+}
+
+//========================
+//Bdd Collect
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Frees every node that no function held by ref() reaches, and empties
+//		the computed table, whose entries may name them.
+//Returns:
+//	n/a
+//========================
+void		Bdd::collect()
+{
+	vector<bool>	mark(nVar->size(), false);
+	vector<int>		stack;
+
+	for (int n = 2; n < nVar->size(); n++)
+	{
+		if (((*nVar)[n] >= 0) && ((*nExt)[n] > 0))
+			stack.push_back(n);
+	}
+
+	while (!stack.empty())
+	{
+		int n = stack.back();
+
+		stack.pop_back();
+
+		if ((n < 2) || mark[n])
+			continue;
+
+		mark[n] = true;
+		stack.push_back((*nLo)[n]);
+		stack.push_back((*nHi)[n]);
+	}
+
+	for (int v = 0; v < nVars; v++)
+	{
+		vector<int>& b = (*unique)[v];
+
+		for (int k = 0; k < b.size(); k++)
+		{
+			int* link = &b[k];
+
+			while (*link >= 0)
+			{
+				int n = *link;
+
+				if (mark[n])
+					link = &(*nNext)[n];
+				else
+				{
+					*link = (*nNext)[n];
+					(*nVar)[n] = -1;
+					(*nNext)[n] = freeList;
+					freeList = n;
+					(*uCount)[v]--;
+					nNodes--;
+				}
+			}
+		}
+	}
+
+	cache->assign(cache->size(), -1);
+	collections++;
+}
+
+//========================
+//Bdd Release
+//========================
+//Parameters:
+//	int	n	-	a node losing a parent while reordering
+//Summary:
+//	Drops n's count and frees it, and so on down, once nothing uses it.
+//Returns:
+//	n/a
+//========================
+void		Bdd::release(int n)
+{
+	if ((n < 2) || (--(*nRef)[n] > 0))
+		return;
+
+	int lo = (*nLo)[n];
+	int hi = (*nHi)[n];
+
+	unlink(n);
+	(*nVar)[n] = -1;
+	(*nNext)[n] = freeList;
+	freeList = n;
+	nNodes--;
+
+	release(lo);
+	release(hi);
+}
+
+//========================
+//Bdd Swap
+//========================
+//Parameters:
+//	int	lv	-	a level above the bottom one
+//Summary:
+//	Exchanges the variables x at lv and y at lv + 1. A node of x with no
+//		child testing y stays as it is. Any other, f = x ? f1 : f0 with
+//		fi = y ? fi1 : fi0, becomes y ? (x ? f11 : f01) : (x ? f10 : f00)
+//		in place, so it keeps its int; the x nodes it now needs are found
+//		or made after every unchanged one is back in x's table.
+//Returns:
+//	n/a
+//========================
+void		Bdd::swap(int lv)
+{
+	int				x = (*invPerm)[lv];
+	int				y = (*invPerm)[lv + 1];
+	vector<int>&	b = (*unique)[x];
+	vector<int>		nodes;
+
+	for (int k = 0; k < b.size(); k++)
+	{
+		for (int n = b[k]; n >= 0; n = (*nNext)[n])
+			nodes.push_back(n);
+	}
+
+	b.assign(b.size(), -1);
+	(*uCount)[x] = 0;
+
+	vector<int> moved;
+
+	for (int k = 0; k < nodes.size(); k++)
+	{
+		int n = nodes[k];
+
+		if (((*nVar)[(*nLo)[n]] == y) || ((*nVar)[(*nHi)[n]] == y))
+			moved.push_back(n);
+		else
+			insert(n);
+	}
+
+	for (int k = 0; k < moved.size(); k++)
+	{
+		int n = moved[k];
+		int f0 = (*nLo)[n];
+		int f1 = (*nHi)[n];
+		int f00 = ((*nVar)[f0] == y) ? (*nLo)[f0] : f0;
+		int f01 = ((*nVar)[f0] == y) ? (*nHi)[f0] : f0;
+		int f10 = ((*nVar)[f1] == y) ? (*nLo)[f1] : f1;
+		int f11 = ((*nVar)[f1] == y) ? (*nHi)[f1] : f1;
+
+		int lo = make(x, f00, f10);
+
+		(*nRef)[lo]++;
+
+		int hi = make(x, f01, f11);
+
+		(*nRef)[hi]++;
+
+		release(f0);
+		release(f1);
+
+		(*nVar)[n] = y;
+		(*nLo)[n] = lo;
+		(*nHi)[n] = hi;
+		insert(n);
+	}
+
+	(*perm)[x] = lv + 1;
+	(*perm)[y] = lv;
+	(*invPerm)[lv] = y;
+	(*invPerm)[lv + 1] = x;
+}
+
+//========================
+//Bdd Sift
+//========================
+//Parameters:
+//	int	v	-	a variable
+//Summary:
+//	Swaps v down to the bottom level and up to the top, turning back
+//		early once the nodes pass SIFT_GROWTH times the fewest seen, then
+//		returns it to the level where they were fewest.
+//Returns:
+//	n/a
+//========================
+void		Bdd::sift(int v)
+{
+	int lv = (*perm)[v];
+	int best = nNodes;
+	int bestLv = lv;
+
+	while ((lv < nVars - 1) && (nNodes <= SIFT_GROWTH * best))
+	{
+		swap(lv++);
+
+		if (nNodes < best)
+		{
+			best = nNodes;
+			bestLv = lv;
+		}
+	}
+
+	while ((lv > 0) && (nNodes <= SIFT_GROWTH * best))
+	{
+		swap(--lv);
+
+		if (nNodes < best)
+		{
+			best = nNodes;
+			bestLv = lv;
+		}
+	}
+
+	while (lv < bestLv)
+		swap(lv++);
+
+	while (lv > bestLv)
+		swap(--lv);
+}
+
+//========================
+//Bdd Reorder
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Collects, counts each node's parents, then sifts the variables from
+//		the one with the most nodes down. The computed table is emptied
+//		after, since freed nodes may be reused.
+//Returns:
+//	n/a
+//========================
+void		Bdd::reorder()
+{
+	if (nVars < 2)
+		return;
+
+	collect();
+
+	for (int n = 0; n < nVar->size(); n++)
+		(*nRef)[n] = (*nExt)[n];
+
+	for (int n = 2; n < nVar->size(); n++)
+	{
+		if ((*nVar)[n] >= 0)
+		{
+			(*nRef)[(*nLo)[n]]++;
+			(*nRef)[(*nHi)[n]]++;
+		}
+	}
+
+	vector<pair<int, int> > bySize;
+
+	for (int v = 0; v < nVars; v++)
+		bySize.push_back(make_pair(-(*uCount)[v], v));
+
+	sort(bySize.begin(), bySize.end());
+
+	reordering = true;
+
+	for (int k = 0; k < bySize.size(); k++)
+		sift(bySize[k].second);
+
+	reordering = false;
+
+	cache->assign(cache->size(), -1);
+	reorders++;
+}
+
+//========================
+//Bdd Dump
+//========================
+//Parameters:
+//	int				f		-	a function
+//	vector<string>	&names	-	a name per variable
+//	ostream			&out	-	receives the nodes
+//Summary:
+//	Writes each node f reaches, top level first, as its number, the
+//		variable it tests, then its low and high; 0 and 1 are themselves,
+//		other nodes are n and their number.
+//Returns:
+//	n/a
+//========================
+void		Bdd::dump(int f, vector<string> &names, ostream &out)
+{
+	vector<bool>			seen(nVar->size(), false);
+	vector<int>				stack(1, f);
+	vector<pair<int, int> >	nodes;
+
+	while (!stack.empty())
+	{
+		int n = stack.back();
+
+		stack.pop_back();
+
+		if ((n < 2) || seen[n])
+			continue;
+
+		seen[n] = true;
+		nodes.push_back(make_pair(level(n), n));
+		stack.push_back((*nLo)[n]);
+		stack.push_back((*nHi)[n]);
+	}
+
+	sort(nodes.begin(), nodes.end());
+
+	for (int k = 0; k < nodes.size(); k++)
+	{
+		int n = nodes[k].second;
+		int lo = (*nLo)[n];
+		int hi = (*nHi)[n];
+
+		out << "  n" << n << "\t" << names[(*nVar)[n]] << "\t";
+
+		if (lo < 2)
+			out << lo;
+		else
+			out << "n" << lo;
+
+		out << "\t";
+
+		if (hi < 2)
+			out << hi;
+		else
+			out << "n" << hi;
+
+		out << endl;
+	}
+}
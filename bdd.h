@@ -0,0 +1,131 @@
+#ifndef BDD_H
+#define BDD_H
+
+//================================================================
+//Filename:		Binary Decision Diagram Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of the Bdd, a package of
+//					reduced ordered binary decision diagrams over a
+//					fixed set of variables.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+
+using namespace std;
+
+// Default most nodes a Bdd may hold at once.
+#define BDD_LIMIT	(1 << 22)
+
+//==================================
+//Class:	Bdd
+//Parent:	n/a
+//==================================
+//Description:
+//	A Bdd holds boolean functions of its variables as shared, reduced,
+//		ordered decision diagrams. A function is an int naming its top
+//		node: 0 and 1 are the constants, and any other node tests one
+//		variable and goes on to its low (variable 0) or high (variable 1)
+//		node, each of which tests a variable further down the order. No
+//		two nodes test the same variable with the same low and high, and
+//		no node has low equal to high, so two functions are equal exactly
+//		when their ints are.
+//		Each variable keeps its nodes in its own hash table, the unique
+//		table, and every function is built by ITE (if f then g else h),
+//		whose results are remembered in a computed table of fixed size.
+//		AND, OR, XOR and NOT are ITEs.
+//		A function kept across calls must be held with ref() and let go
+//		with deref(). When the tables pass a threshold at the start of a
+//		call, nodes no held function reaches are collected (the call's
+//		own arguments are safe), and the threshold doubles if little was
+//		freed. With reordering on, the variable order is also improved
+//		then by sifting: each variable in turn is swapped level by level
+//		to the bottom and the top and left where the fewest nodes were
+//		needed. A swap rewrites nodes in place, so every function keeps
+//		its int through reordering.
+//==================================
+class Bdd
+{
+public:
+				Bdd(int vars, int limit = BDD_LIMIT) throw (BasicException);
+
+				~Bdd();
+
+	int			cntVars();
+	int			cntNodes();
+	int			cntPeak();
+	int			cntCollections();
+	int			cntReorders();
+	int			cntNodes(int f);
+	long double	cntSat(int f);
+
+	int			getVar(int v);
+	int			getTop(int f);
+	int			getLow(int f);
+	int			getHigh(int f);
+	int			getLevel(int v);
+	int			getVarAt(int level);
+	bool		getCube(int f, vector<state> &cube);
+
+	void		ref(int f);
+	void		deref(int f);
+	void		setReorder(bool on);
+	void		collect();
+	void		reorder();
+
+	int			ITE(int f, int g, int h) throw (BasicException);
+	int			AND(int f, int g) throw (BasicException);
+	int			OR(int f, int g) throw (BasicException);
+	int			XOR(int f, int g) throw (BasicException);
+	int			NOT(int f) throw (BasicException);
+
+	void		dump(int f, vector<string> &names, ostream &out);
+
+private:
+
+	int			level(int n);
+	int			make(int v, int lo, int hi) throw (BasicException);
+	int			iteRec(int f, int g, int h) throw (BasicException);
+	void		checkpoint(int f, int g, int h);
+	void		insert(int n);
+	void		unlink(int n);
+	void		grow(int v);
+	void		release(int n);
+	void		swap(int lv);
+	void		sift(int v);
+
+	int						nVars;
+	int						limit;
+
+	vector<int>*			nVar;		// per node: its variable, or -1 when free.
+	vector<int>*			nLo;
+	vector<int>*			nHi;
+	vector<int>*			nNext;		// per node: next in its hash chain or the free list.
+	vector<int>*			nExt;		// per node: ref() count.
+	vector<int>*			nRef;		// per node: ref() count plus parents, while reordering.
+	int						freeList;
+	int						nNodes;		// nodes in the unique tables, not counting 0 and 1.
+	int						peak;
+
+	vector< vector<int> >*	unique;		// per variable: hash buckets.
+	vector<int>*			uCount;		// per variable: its nodes.
+	vector<int>*			perm;		// per variable: its level.
+	vector<int>*			invPerm;	// per level: its variable.
+
+	vector<int>*			cache;		// 4 ints per entry: f, g, h, result.
+	int						cacheMask;
+
+	int						threshold;	// nodes that trigger a collection.
+	int						collections;
+	int						reorders;
+	bool					autoReorder;
+	bool					reordering;
+};
+
+#endif //BDD_H
@@ -0,0 +1,455 @@
+//================================================================
+//Filename:		Binary Vector Format Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the text to binary vector converter and
+//					the BinVectorReader.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <map>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "loader.h"
+#include "binVector.h"
+
+using namespace std;
+
+// The first byte of a binary vector file, which no text file starts with.
+#define BV_TAG		0x89
+
+//========================
+//Put Varint
+//========================
+//Parameters:
+//	ostream			&out	-	where to write
+//	unsigned int	v		-	the value
+//Summary:
+//	Writes v as an unsigned LEB128 varint: seven bits per byte, low bits
+//		first, the top bit set on every byte but the last.
+//Returns:
+//	n/a
+//========================
+static void	putVarint(ostream &out, unsigned int v)
+{
+	while (v >= 0x80)
+	{
+		out.put((char) ((v & 0x7f) | 0x80));
+		v >>= 7;
+	}
+
+	out.put((char) v);
+}
+
+//========================
+//Put Frame
+//========================
+//Parameters:
+//	ostream		&out	-	where to write
+//	int			dt		-	time since the previous frame
+//	vector<int>	&st		-	per pad, its new state or -1; cleared
+//Summary:
+//	Writes one frame: dt, the changed pad bitmask, then the packed
+//		states of the changed pads.
+//Returns:
+//	n/a
+//========================
+static void	putFrame(ostream &out, int dt, vector<int> &st)
+{
+	vector<unsigned char>	mask((st.size() + 7) / 8, 0);
+	vector<unsigned char>	vals;
+	int						k = 0;
+
+	for (int p = 0; p < st.size(); p++)
+	{
+		if (st[p] < 0)
+			continue;
+
+		mask[p >> 3] |= 1 << (p & 7);
+
+		if ((k & 3) == 0)
+			vals.push_back(0);
+
+		vals[k >> 2] |= st[p] << ((k & 3) * 2);
+		k++;
+		st[p] = -1;
+	}
+
+	putVarint(out, dt);
+	out.write((char*) &mask[0], mask.size());
+
+	if (!vals.empty())
+		out.write((char*) &vals[0], vals.size());
+}
+
+//========================
+//Is Binary Vector
+//========================
+//Parameters:
+//	istream	&in	-	an open vector file, not yet read from
+//Summary:
+//	Looks at the first byte, without taking it, for the binary tag.
+//Returns:
+//	bool	-	true for a binary vector file
+//========================
+bool		isBinaryVector(istream &in)
+{
+	return (in.peek() == BV_TAG);
+}
+
+//========================
+//Pack Vector
+//========================
+//Parameters:
+//	Circuit	*crc	-	the circuit the vector is for
+//	istream	&in		-	a text vector file, sorted by time
+//	ostream	&out	-	receives the binary vector file
+//Summary:
+//	Converts a text vector file to the binary format, with the circuit's
+//		input pads in circuit order. INPUT lines for output pads are
+//		dropped, as a run overwrites them anyway; where one time gives a
+//		pad two states, the later line wins, as in loadVector.
+//Returns:
+//	n/a
+//========================
+void		packVector(Circuit *crc, istream &in, ostream &out) throw (BasicException)
+{
+	if (crc == NULL)
+		throw NullPointerException();
+
+	map<string, int>	iPads;
+	vector<int>			st(crc->cntiPads(), -1);
+	string				CMD;
+	string				name = "";
+	int					last = 0;
+	bool				pending = false;
+
+	for (int p = 0; p < crc->cntiPads(); p++)
+		iPads[crc->getiPad(p)->getID()] = p;
+
+	int frameTime = 0;
+
+	while (!(in.eof()))
+	{
+		CMD = "";
+
+		in >> CMD;
+
+		if ((CMD == "") || (in.eof()))
+			break;
+
+		if (CMD == "VECTOR")
+		{
+			if (name != "")
+				throw BasicException("Only one VECTOR may be packed.");
+
+			in >> name;
+
+			if (name == "")
+				throw NullIDException();
+
+			out.put((char) BV_TAG);
+			out.put('D');
+			out.put('V');
+			out.put(1);
+
+			putVarint(out, name.size());
+			out.write(name.data(), name.size());
+			putVarint(out, crc->cntiPads());
+
+			for (int p = 0; p < crc->cntiPads(); p++)
+			{
+				string tID = crc->getiPad(p)->getID();
+
+				putVarint(out, tID.size());
+				out.write(tID.data(), tID.size());
+			}
+		}
+		else if (CMD == "INPUT")
+		{
+			string tID;
+			string tdly;
+			string State;
+
+			in >> tID >> tdly >> State;
+
+			int tdly2 = parseTime(tdly);
+
+			if (tdly2 < 0) // avoid invalid delay.
+				tdly2 = 0;
+
+			state State2 = parseState(State);
+
+			if (name == "")
+				throw NullPointerException();
+
+			if (tdly2 < frameTime)
+				throw BasicException("Vector file is not sorted by time.");
+
+			if (iPads.count(tID) == 0)
+			{
+				try
+				{
+					crc->getoPad(tID);
+				}
+				catch (ElementNotFound e)
+				{
+					throw BasicException("Vector definitions do not match with circuit definitions.");
+				}
+
+				continue;
+			}
+
+			if (pending && (tdly2 != frameTime))
+			{
+				putFrame(out, frameTime - last, st);
+				last = frameTime;
+			}
+
+			frameTime = tdly2;
+			st[iPads[tID]] = State2;
+			pending = true;
+		}
+		else
+			throw BasicException("Unrecognized vector file command.");
+	}
+
+	if (name == "")
+		throw BasicException("Vector is undefined.");
+
+	if (pending)
+		putFrame(out, frameTime - last, st);
+}
+
+//========================
+//Load Binary Vector
+//========================
+//Parameters:
+//	Circuit	*crc	-	the circuit the vector drives
+//	istream	&in		-	an open binary vector file
+//Summary:
+//	The binary counterpart of loadVector: builds the Vector, then adds
+//		each frame's changes to the PadStates. The file's pads are
+//		matched to the circuit's by name once, up front.
+//Returns:
+//	n/a
+//========================
+void		loadBinaryVector(Circuit *crc, istream &in) throw (BasicException)
+{
+	if (crc == NULL)
+		throw NullPointerException();
+
+	BinVectorReader		rd(in);
+	vector<PadState*>	ps(rd.cntPads(), (PadState*) NULL);
+
+	crc->setVector(newVector(crc, rd.getName()));
+
+	for (int p = 0; p < rd.cntPads(); p++)
+	{
+		try
+		{
+			ps[p] = crc->getVector()->getPadState(rd.getPadID(p));
+		}
+		catch (ElementNotFound e)
+		{
+			throw BasicException("Vector definitions do not match with circuit definitions.");
+		}
+	}
+
+	while (rd.next())
+	{
+		for (int k = 0; k < rd.cntChanges(); k++)
+			ps[rd.getPad(k)]->addState(rd.getState(k), rd.getTime());
+	}
+}
+
+//========================
+//BinVectorReader Constructor
+//========================
+//Parameters:
+//	istream	&in	-	an open binary vector file
+//Summary:
+//	Reads the header: tag, vector name and pad names.
+//========================
+BinVectorReader::BinVectorReader(istream &in) throw (BasicException)
+{
+	src = &in;
+	time = 0;
+	pads = new vector<string>();
+	cPad = new vector<int>();
+	cState = new vector<int>();
+	mask = new vector<unsigned char>();
+
+	char tag[4];
+
+	in.read(tag, 4);
+
+	if ((in.gcount() != 4) || ((unsigned char) tag[0] != BV_TAG) || (tag[1] != 'D') || (tag[2] != 'V'))
+		throw BasicException("Not a binary vector file.");
+
+	if (tag[3] != 1)
+		throw BasicException("Unsupported binary vector file version.");
+
+	name.resize(varint());
+	in.read(&name[0], name.size());
+
+	pads->resize(varint());
+
+	for (int p = 0; p < pads->size(); p++)
+	{
+		(*pads)[p].resize(varint());
+		in.read(&(*pads)[p][0], (*pads)[p].size());
+	}
+
+	if (!in.good())
+		throw BasicException("Binary vector file is cut short.");
+
+	mask->resize((pads->size() + 7) / 8);
+}
+
+//========================
+//BinVectorReader Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the pad and frame storage. The stream is not closed.
+//========================
+BinVectorReader::~BinVectorReader()
+{
+	delete pads;
+	delete cPad;
+	delete cState;
+	delete mask;
+}
+
+//========================
+//BinVectorReader Varint
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Reads one unsigned LEB128 varint.
+//Returns:
+//	unsigned int	-	the value
+//========================
+unsigned int	BinVectorReader::varint() throw (BasicException)
+{
+	unsigned int	v = 0;
+	int				shift = 0;
+	int				b;
+
+	do
+	{
+		b = src->get();
+
+		if ((b == EOF) || (shift > 28))
+			throw BasicException("Binary vector file is cut short.");
+
+		v |= (b & 0x7f) << shift;
+		shift += 7;
+	} while (b & 0x80);
+
+	return v;
+}
+
+//========================
+//BinVectorReader Accessors
+//========================
+//Summary:
+//	The vector name, the input pads, and the current frame: its time
+//		and each change's pad index and new state.
+//========================
+string		BinVectorReader::getName()
+{
+	return name;
+}
+
+int			BinVectorReader::cntPads()
+{
+	return pads->size();
+}
+
+string		BinVectorReader::getPadID(int p)
+{
+	return (*pads)[p];
+}
+
+int			BinVectorReader::getTime()
+{
+	return time;
+}
+
+int			BinVectorReader::cntChanges()
+{
+	return cPad->size();
+}
+
+int			BinVectorReader::getPad(int k)
+{
+	return (*cPad)[k];
+}
+
+state		BinVectorReader::getState(int k)
+{
+	return (state) (*cState)[k];
+}
+
+//========================
+//BinVectorReader Next
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Reads the next frame.
+//Returns:
+//	bool	-	false at the end of the file
+//========================
+bool		BinVectorReader::next() throw (BasicException)
+{
+	if (src->peek() == EOF)
+		return false;
+
+	time += varint();
+
+	src->read((char*) &(*mask)[0], mask->size());
+
+	cPad->clear();
+	cState->clear();
+
+	for (int p = 0; p < pads->size(); p++)
+	{
+		if ((*mask)[p >> 3] & (1 << (p & 7)))
+			cPad->push_back(p);
+	}
+
+	int b = 0;
+
+	for (int k = 0; k < cPad->size(); k++)
+	{
+		if ((k & 3) == 0)
+			b = src->get();
+
+		if (b == EOF)
+			throw BasicException("Binary vector file is cut short.");
+
+		int s = (b >> ((k & 3) * 2)) & 3;
+
+		if (s > indet)
+			throw UnknownState();
+
+		cState->push_back(s);
+	}
+
+	if (!src->good())
+		throw BasicException("Binary vector file is cut short.");
+
+	return true;
+}
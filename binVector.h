@@ -0,0 +1,78 @@
+#ifndef BINVECTOR_H
+#define BINVECTOR_H
+
+//================================================================
+//Filename:		Binary Vector Format Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Prototypes and the reader class for binary vector
+//					files: the pad names once, then one small frame
+//					per time at which any input changes.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+
+using namespace std;
+
+// See Implementation
+bool		isBinaryVector(istream &in);
+
+// See Implementation
+void		loadBinaryVector(Circuit *crc, istream &in) throw (BasicException);
+
+// See Implementation
+void		packVector(Circuit *crc, istream &in, ostream &out) throw (BasicException);
+
+//==================================
+//Class:	BinVectorReader
+//Parent:	n/a
+//==================================
+//Description:
+//	Reads a binary vector file. The file is a 4-byte tag (0x89 'D' 'V' 1),
+//		the vector name, the input pad count and each pad name, then
+//		frames. A frame is the time since the previous frame (the first
+//		counts from 0), a bitmask with a bit set for each pad that changes,
+//		then the new states of just those pads, four 2-bit states to a
+//		byte. Counts, lengths and times are unsigned LEB128 varints.
+//		After the constructor reads the header, each next() reads one
+//		frame.
+//==================================
+class BinVectorReader
+{
+public:
+				BinVectorReader(istream &in) throw (BasicException);
+
+				~BinVectorReader();
+
+	string		getName();
+	int			cntPads();
+	string		getPadID(int p);
+
+	bool		next() throw (BasicException);
+	int			getTime();
+	int			cntChanges();
+	int			getPad(int k);
+	state		getState(int k);
+
+private:
+
+	unsigned int	varint() throw (BasicException);
+
+	istream*		src;
+	string			name;
+	vector<string>*	pads;
+	int				time;
+	vector<int>*	cPad;
+	vector<int>*	cState;
+	vector<unsigned char>*	mask;
+};
+
+#endif //BINVECTOR_H
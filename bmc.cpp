@@ -0,0 +1,621 @@
+//================================================================
+//Filename:		Bounded Model Checker Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for Bmc: the property file
+//					reader, the unrolling of the circuit one
+//					nanosecond at a time into 0/1/X clauses, and the
+//					search for a sequence that breaks an assertion.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "loader.h"
+#include "netlist.h"
+#include "sat.h"
+#include "bmc.h"
+
+using namespace std;
+
+//========================
+//Bmc Constructor
+//========================
+//Parameters:
+//	Netlist	*n	-	the netlist, which may have feedback
+//	bool	x	-	whether input pads may also be X
+//Summary:
+//	Sets up an empty Sat and no properties. n must outlive the Bmc.
+//========================
+Bmc::Bmc(Netlist *n, bool x) throw (NullPointerException, BasicException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	for (int g = 0; g < n->cntGates(); g++)
+	{
+		if (n->getType(g) == gLUT)
+			throw BasicException("Bounded model checking needs a netlist without lookup tables.");
+	}
+
+	net = n;
+	xIn = x;
+	sat = new Sat();
+	one = 2 * sat->newVar();
+
+	vector<int> unit(1, one);
+
+	sat->addClause(unit);
+
+	text = new vector<string>();
+	isAssert = new vector<bool>();
+	from = new vector<int>();
+	wires = new vector< vector<int> >();
+	states = new vector< vector<state> >();
+
+	hi = new vector<int>();
+	lo = new vector<int>();
+	frames = 0;
+
+	failed = -1;
+	trace = new vector<unsigned char>();
+}
+
+//========================
+//Bmc Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the Sat, the properties and the unrolled times.
+//========================
+Bmc::~Bmc()
+{
+	delete sat;
+	delete text;
+	delete isAssert;
+	delete from;
+	delete wires;
+	delete states;
+	delete hi;
+	delete lo;
+	delete trace;
+}
+
+//========================
+//Bmc Read
+//========================
+//Parameters:
+//	istream	&in	-	an open property file
+//Summary:
+//	Adds each ASSERT or ASSUME line of the file. A name is looked up
+//		among the input pads, then the output pads, then the wires. A
+//		name the circuit lacks, or a file with no ASSERT at all, is an
+//		error, since checking it would pass without checking anything.
+//Returns:
+//	n/a
+//========================
+void		Bmc::read(istream &in) throw (BasicException)
+{
+	string line;
+
+	while (getline(in, line))
+	{
+		istringstream	ls(line);
+		string			CMD = "";
+		string			never = "";
+
+		ls >> CMD;
+
+		if (CMD == "")
+			continue;
+
+		if ((CMD != "ASSERT") && (CMD != "ASSUME"))
+			throw BasicException("Unrecognized property file command.");
+
+		ls >> never;
+
+		if (never != "NEVER")
+			throw BasicException("A property must read ASSERT NEVER or ASSUME NEVER.");
+
+		vector<int>		ws;
+		vector<state>	ss;
+		int				t = 0;
+		string			term;
+
+		while (ls >> term)
+		{
+			if (term == "FROM")
+			{
+				string tT = "";
+
+				ls >> tT;
+
+				if (tT == "")
+					throw BasicException("FROM needs a time.");
+
+				t = max(parseTime(tT), 0);
+				continue;
+			}
+
+			int eq = term.find('=');
+
+			if ((eq == string::npos) || (eq == 0))
+				throw BasicException("A property term must read ID=state.");
+
+			string	id = term.substr(0, eq);
+			int		w = -1;
+
+			for (int ip = 0; (w < 0) && (ip < net->cntiPads()); ip++)
+			{
+				if (net->getiPadID(ip) == id)
+					w = net->getiPadWire(ip);
+			}
+
+			for (int op = 0; (w < 0) && (op < net->cntoPads()); op++)
+			{
+				if (net->getoPadID(op) == id)
+					w = net->getoPadWire(op);
+			}
+
+			for (int k = 0; (w < 0) && (k < net->cntWires()); k++)
+			{
+				if (net->getWireID(k) == id)
+					w = k;
+			}
+
+			if (w < 0)
+				throw BasicException("A property names a pad or wire the circuit lacks: " + id + ".");
+
+			ws.push_back(w);
+			ss.push_back(parseState(term.substr(eq + 1)));
+		}
+
+		if (ws.empty())
+			throw BasicException("A property names no pads or wires.");
+
+		int first = line.find_first_not_of(" \t");
+		int last = line.find_last_not_of(" \t\r");
+
+		text->push_back(line.substr(first, last - first + 1));
+		isAssert->push_back(CMD == "ASSERT");
+		from->push_back(t);
+		wires->push_back(ws);
+		states->push_back(ss);
+	}
+
+	if (find(isAssert->begin(), isAssert->end(), true) == isAssert->end())
+		throw BasicException("The property file holds no assertions to check.");
+}
+
+//========================
+//Bmc Properties
+//========================
+//Parameters:
+//	int	p	-	a property
+//Summary:
+//	The properties read, and each one's line.
+//Returns:
+//	int or string	-	the count, or the line
+//========================
+int			Bmc::cntProperties()
+{
+	return text->size();
+}
+
+string		Bmc::getProperty(int p)
+{
+	return (*text)[p];
+}
+
+//========================
+//Bmc Statistics
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Times unrolled so far, and the Sat's variables, clauses and
+//		conflicts.
+//Returns:
+//	int or long	-	the count
+//========================
+int			Bmc::cntFrames()
+{
+	return frames;
+}
+
+int			Bmc::cntVars()
+{
+	return sat->cntVars();
+}
+
+int			Bmc::cntClauses()
+{
+	return sat->cntClauses();
+}
+
+long		Bmc::cntConflicts()
+{
+	return sat->cntConflicts();
+}
+
+//========================
+//Bmc Run
+//========================
+//Parameters:
+//	int	depth	-	the last time to check, in ns
+//Summary:
+//	Adds the times not yet unrolled up to depth, one at a time, and
+//		after each asks the Sat for input values that satisfy every
+//		assumption so far and break some assertion at that time. The
+//		first such sequence is kept; see getFailed() and getState().
+//		Otherwise no assertion can fail at that time, which is added as
+//		a clause before the next.
+//Returns:
+//	int	-	the time an assertion first fails, or -1 if none up to depth
+//========================
+int			Bmc::run(int depth)
+{
+	failed = -1;
+
+	for (int t = frames; t <= depth; t++)
+	{
+		frame(t);
+
+		vector<int> bad;
+		vector<int> which;
+
+		for (int p = 0; p < text->size(); p++)
+		{
+			if ((*isAssert)[p] && ((*from)[p] <= t))
+			{
+				bad.push_back(holds(p, t));
+				which.push_back(p);
+			}
+		}
+
+		int b = disj(bad);
+
+		if (b == (one ^ 1))
+			continue;
+
+		vector<int> assume(1, b);
+
+		if (sat->solve(assume) == SAT_TRUE)
+		{
+			int nW = net->cntWires();
+
+			trace->clear();
+
+			for (int k = 0; k < (t + 1) * nW; k++)
+			{
+				if (value((*hi)[k]))
+					trace->push_back(high);
+				else if (value((*lo)[k]))
+					trace->push_back(low);
+				else
+					trace->push_back(indet);
+			}
+
+			for (int k = 0; (failed < 0) && (k < bad.size()); k++)
+			{
+				if (value(bad[k]))
+					failed = which[k];
+			}
+
+			return t;
+		}
+
+		vector<int> c(1, b ^ 1);
+
+		sat->addClause(c);
+	}
+
+	return -1;
+}
+
+//========================
+//Bmc Failure
+//========================
+//Parameters:
+//	int	w	-	a wire
+//	int	t	-	a time up to the failure
+//Summary:
+//	After run() finds a failure: the assertion broken, and the states
+//		of the sequence that breaks it.
+//Returns:
+//	int or state	-	the property, or the wire's state at t
+//========================
+int			Bmc::getFailed()
+{
+	return failed;
+}
+
+state		Bmc::getState(int w, int t)
+{
+	return (state) (*trace)[t * net->cntWires() + w];
+}
+
+//========================
+//Bmc Write
+//========================
+//Parameters:
+//	ostream	&out	-	where to write
+//	string	name	-	the vector's name
+//Summary:
+//	Writes the input pads of the failing sequence as a vector file.
+//		Every pad is written at time 0 and at the failure, so a run
+//		reaches it, and in between only changes.
+//Returns:
+//	n/a
+//========================
+void		Bmc::write(ostream &out, string name)
+{
+	int end = trace->size() / net->cntWires() - 1;
+
+	out << "VECTOR " << name << endl;
+
+	for (int t = 0; t <= end; t++)
+	{
+		for (int ip = 0; ip < net->cntiPads(); ip++)
+		{
+			int w = net->getiPadWire(ip);
+
+			if ((t == 0) || (t == end) || (getState(w, t) != getState(w, t - 1)))
+				out << "INPUT\t" << net->getiPadID(ip) << "\t" << t << "\t" << (int) getState(w, t) << endl;
+		}
+	}
+}
+
+//========================
+//Bmc Frame
+//========================
+//Parameters:
+//	int	t	-	the next time, in ns
+//Summary:
+//	Gives every wire its two literals at time t: fresh ones for the
+//		input pads, and for each gate's output, its 0/1/X function of its
+//		inputs delay ns before, or X if t is earlier than the delay.
+//		Wires nothing drives stay X. Then adds each assumption in force
+//		at t.
+//Returns:
+//	n/a
+//========================
+void		Bmc::frame(int t)
+{
+	int nW = net->cntWires();
+	int base = t * nW;
+	int zero = one ^ 1;
+
+	hi->resize(base + nW, zero);
+	lo->resize(base + nW, zero);
+
+	for (int ip = 0; ip < net->cntiPads(); ip++)
+	{
+		int w = net->getiPadWire(ip);
+
+		if (xIn)
+		{
+			vector<int> c(2);
+
+			(*hi)[base + w] = 2 * sat->newVar();
+			(*lo)[base + w] = 2 * sat->newVar();
+			c[0] = (*hi)[base + w] ^ 1;
+			c[1] = (*lo)[base + w] ^ 1;
+			sat->addClause(c);
+		}
+		else
+		{
+			(*hi)[base + w] = 2 * sat->newVar();
+			(*lo)[base + w] = (*hi)[base + w] ^ 1;
+		}
+	}
+
+	for (int g = 0; g < net->cntGates(); g++)
+	{
+		int d = net->getDelay(g);
+
+		if (t < d)
+			continue;
+
+		gateType	type = net->getType(g);
+		int			src = (t - d) * nW;
+		int			h = (*hi)[src + net->getInput(g, 0)];
+		int			l = (*lo)[src + net->getInput(g, 0)];
+
+		if ((type == gXOR) || (type == gXNOR))
+		{
+			for (int k = 1; k < net->cntInputs(g); k++)
+			{
+				vector<int> a(2);
+				vector<int> b(2);
+				vector<int> pair(2);
+				int ih = (*hi)[src + net->getInput(g, k)];
+				int il = (*lo)[src + net->getInput(g, k)];
+
+				a[0] = h; a[1] = il;
+				b[0] = l; b[1] = ih;
+				pair[0] = conj(a);
+				pair[1] = conj(b);
+
+				int nh = disj(pair);
+
+				a[0] = h; a[1] = ih;
+				b[0] = l; b[1] = il;
+				pair[0] = conj(a);
+				pair[1] = conj(b);
+				l = disj(pair);
+				h = nh;
+			}
+		}
+		else if (type != gNOT)
+		{
+			vector<int> ih;
+			vector<int> il;
+
+			for (int k = 0; k < net->cntInputs(g); k++)
+			{
+				ih.push_back((*hi)[src + net->getInput(g, k)]);
+				il.push_back((*lo)[src + net->getInput(g, k)]);
+			}
+
+			if ((type == gAND) || (type == gNAND))
+			{
+				h = conj(ih);
+				l = disj(il);
+			}
+			else
+			{
+				h = disj(ih);
+				l = conj(il);
+			}
+		}
+
+		if ((type == gNOT) || (type == gNAND) || (type == gNOR) || (type == gXNOR))
+			std::swap(h, l);
+
+		(*hi)[base + net->getOutput(g)] = h;
+		(*lo)[base + net->getOutput(g)] = l;
+	}
+
+	for (int p = 0; p < text->size(); p++)
+	{
+		if (!(*isAssert)[p] && ((*from)[p] <= t))
+		{
+			vector<int> c(1, holds(p, t) ^ 1);
+
+			sat->addClause(c);
+		}
+	}
+
+	frames = t + 1;
+}
+
+//========================
+//Bmc Conjunction and Disjunction
+//========================
+//Parameters:
+//	vector<int>	&in	-	literals
+//Summary:
+//	A literal for the AND (or OR) of in. Constants are folded and repeats
+//		dropped, so the early times, still X, cost nothing; otherwise a
+//		new variable y implies each literal, and all of them imply y.
+//		disj() is the negation of the conj() of the negations.
+//Returns:
+//	int	-	the literal
+//========================
+int			Bmc::conj(vector<int> &in)
+{
+	vector<int> c;
+
+	for (int k = 0; k < in.size(); k++)
+	{
+		if (in[k] == (one ^ 1))
+			return one ^ 1;
+
+		if (in[k] != one)
+			c.push_back(in[k]);
+	}
+
+	sort(c.begin(), c.end());
+	c.erase(unique(c.begin(), c.end()), c.end());
+
+	for (int k = 1; k < c.size(); k++)
+	{
+		if (c[k] == (c[k - 1] ^ 1))
+			return one ^ 1;
+	}
+
+	if (c.empty())
+		return one;
+
+	if (c.size() == 1)
+		return c[0];
+
+	int			y = 2 * sat->newVar();
+	vector<int>	big(1, y);
+	vector<int>	two(2);
+
+	for (int k = 0; k < c.size(); k++)
+	{
+		two[0] = y ^ 1;
+		two[1] = c[k];
+		sat->addClause(two);
+		big.push_back(c[k] ^ 1);
+	}
+
+	sat->addClause(big);
+
+	return y;
+}
+
+int			Bmc::disj(vector<int> &in)
+{
+	vector<int> neg(in);
+
+	for (int k = 0; k < neg.size(); k++)
+		neg[k] ^= 1;
+
+	return conj(neg) ^ 1;
+}
+
+//========================
+//Bmc Holds
+//========================
+//Parameters:
+//	int	p	-	a property
+//	int	t	-	a time already unrolled
+//Summary:
+//	A literal true when every wire of p has its state at t.
+//Returns:
+//	int	-	the literal
+//========================
+int			Bmc::holds(int p, int t)
+{
+	int			base = t * net->cntWires();
+	vector<int>	terms;
+
+	for (int k = 0; k < (*wires)[p].size(); k++)
+	{
+		int h = (*hi)[base + (*wires)[p][k]];
+		int l = (*lo)[base + (*wires)[p][k]];
+
+		if ((*states)[p][k] == high)
+			terms.push_back(h);
+		else if ((*states)[p][k] == low)
+			terms.push_back(l);
+		else
+		{
+			terms.push_back(h ^ 1);
+			terms.push_back(l ^ 1);
+		}
+	}
+
+	return conj(terms);
+}
+
+//========================
+//Bmc Value
+//========================
+//Parameters:
+//	int	f	-	a literal
+//Summary:
+//	f's value in the Sat's last solution.
+//Returns:
+//	bool	-	the value
+//========================
+bool		Bmc::value(int f)
+{
+	if ((f >> 1) == (one >> 1))
+		return f == one;
+
+	return sat->getValue(f >> 1) != (bool) (f & 1);
+}
@@ -0,0 +1,106 @@
+#ifndef BMC_H
+#define BMC_H
+
+//================================================================
+//Filename:		Bounded Model Checker Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of Bmc, which searches every
+//					input sequence up to a given time for one that
+//					breaks an assertion about the circuit's wires.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "sat.h"
+
+using namespace std;
+
+// Nanoseconds checked unless told otherwise.
+#define BMC_DEPTH		20
+
+//==================================
+//Class:	Bmc
+//Parent:	n/a
+//==================================
+//Description:
+//	Bmc checks properties of a circuit, feedback and all, over the first
+//		nanoseconds after it starts with every wire X. A property file
+//		holds lines of the form
+//			ASSERT NEVER S=1 R=1 [FROM 3ns]
+//			ASSUME NEVER S=1 R=1 [FROM 3ns]
+//		each naming pads or wires and a state (0, 1, or X for indet)
+//		that are never all found together, at any time from the given
+//		one (0 if none) on. An assertion is what is checked; an
+//		assumption rules out input sequences that break it.
+//		The circuit is unrolled one nanosecond at a time, the way the
+//		Engine steps it: at time t an input pad holds a free value, and a
+//		gate's output holds what its inputs gave delay nanoseconds
+//		before, or X before then. Since every delay is at least 1ns, each
+//		time is built from earlier ones only, loops included. Each state
+//		is two Sat literals, one true for 1 and one for 0, neither for X,
+//		and the gates follow the 0/1/X tables: an AND's 1 literal is the
+//		AND of its inputs' 1 literals, its 0 literal the OR of their 0
+//		literals, and so on. Input pads are 0 or 1 unless X is allowed.
+//		After each time is added, one Sat call, assuming some assertion
+//		fails then, either finds an input sequence that does it or
+//		proves none can; the proof is kept as a clause, and the same Sat
+//		goes on to the next time with everything it has learned.
+//==================================
+class Bmc
+{
+public:
+				Bmc(Netlist *n, bool x = false) throw (NullPointerException, BasicException);
+
+				~Bmc();
+
+	void		read(istream &in) throw (BasicException);
+	int			cntProperties();
+	string		getProperty(int p);
+
+	int			run(int depth);
+	int			getFailed();
+	state		getState(int w, int t);
+	void		write(ostream &out, string name);
+
+	int			cntFrames();
+	int			cntVars();
+	int			cntClauses();
+	long		cntConflicts();
+
+private:
+
+	void		frame(int t);
+	int			conj(vector<int> &in);
+	int			disj(vector<int> &in);
+	int			holds(int p, int t);
+	bool		value(int f);
+
+	Netlist*				net;
+	Sat*					sat;
+	bool					xIn;
+	int						one;		// the literal always true.
+
+	vector<string>*			text;		// per property: its line.
+	vector<bool>*			isAssert;
+	vector<int>*			from;
+	vector< vector<int> >*	wires;		// per property: its wires,
+	vector< vector<state> >* states;	//   and the state each must have.
+
+	vector<int>*			hi;			// per time, per wire: literal true for 1,
+	vector<int>*			lo;			//   and literal true for 0.
+	int						frames;
+
+	int						failed;		// the assertion broken, or -1.
+	vector<unsigned char>*	trace;		// per time, per wire: its state.
+};
+
+#endif //BMC_H
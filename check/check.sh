@@ -0,0 +1,560 @@
+#!/bin/sh
+#================================================================
+#Filename:		check.sh
+#Programmer:	Daniel "ProgrammerDan" Boston
+#Date:			October 18, 2026
+#Summary:		Regression check for digibatch, run by 'make check'
+#					from the top directory. Runs every example circuit
+#					through each engine and option that must not change
+#					the results, which must agree, and records what
+#					each command prints in check/out. Each file there
+#					must match its twin in check/expected.
+#					'check.sh -update' rewrites check/expected after an
+#					intended change of output.
+#Revisions:
+#
+#================================================================
+
+D=./digibatch
+EXP=check/expected
+OUT=check/out
+fail=0
+
+#========================
+#Settled
+#========================
+#Parameters:
+#	$1	-	a circuit file, without feedback
+#	$2	-	the Gate objects' run of it
+#	$3	-	a run that keeps only the settled outputs
+#Summary:
+#	Compares the output pads of two runs in the last nanosecond before
+#		each change of the input pads, where the inputs have held at 0
+#		or 1 for at least the circuit's longest path delay, so the
+#		first run has settled. Prints how many such times agree, or the
+#		first that does not.
+#========================
+settled()
+{
+	awk -v cir="$1" '
+	BEGIN {
+		while ((getline l < cir) > 0)
+		{
+			k = split(l, f)
+			if (f[1] == "INPUT")
+				inp[f[2]] = 1
+			else if ((k >= 4) && (f[1] != "OUTPUT"))
+			{
+				g++
+				gd[g] = f[2] + 0
+				gout[g] = f[k]
+				gin[g] = k - 3
+				for (i = 3; i < k; i++)
+					gw[g, i - 2] = f[i]
+			}
+		}
+		for (pass = 0; pass <= g; pass++)
+		{
+			moved = 0
+			for (i = 1; i <= g; i++)
+			{
+				a = 0
+				for (j = 1; j <= gin[i]; j++)
+					if (at[gw[i, j]] > a)
+						a = at[gw[i, j]]
+				if (a + gd[i] > at[gout[i]])
+				{
+					at[gout[i]] = a + gd[i]
+					moved = 1
+				}
+			}
+			if (!moved)
+				break
+		}
+		for (x in at)
+			if (at[x] > span)
+				span = at[x]
+	}
+	FNR == 1 { file++ }
+	/^[^ ]+: [012]+$/ {
+		n = substr($1, 1, length($1) - 1)
+		wv[file, n] = $2
+		if (file == 1)
+			names[++cnt] = n
+	}
+	END {
+		len = length(wv[1, names[1]])
+		good = 0
+		last = 1
+		for (t = 1; t < len; t++)
+		{
+			edge = 0
+			known = 1
+			for (i = 1; i <= cnt; i++)
+			{
+				n = names[i]
+				if (!(n in inp))
+					continue
+				if (substr(wv[1, n], t, 1) == "2")
+					known = 0
+				if (substr(wv[1, n], t, 1) != substr(wv[1, n], t + 1, 1))
+					edge = 1
+			}
+			if (!edge)
+				continue
+			held = t - last
+			last = t + 1
+			if (!known || (held < span))
+				continue
+			for (i = 1; i <= cnt; i++)
+			{
+				n = names[i]
+				a = substr(wv[1, n], t, 1)
+				if (n in inp)
+					continue
+				if (a != substr(wv[2, n], t, 1))
+				{
+					printf("differs at %dns on %s\n", t - 1, n)
+					exit 0
+				}
+			}
+			good++
+		}
+		printf("agrees at %d settled times\n", good)
+	}' "$2" "$3"
+}
+
+#========================
+#Compare
+#========================
+#Parameters:
+#	$1	-	the name of a variant
+#	$2	-	the reference output
+#	$3	-	the variant's output
+#	$4	-	the variant's exit status
+#	$5	-	the circuit, to compare settled outputs only; else exactly
+#Summary:
+#	Prints one line for the variant: whether it agrees, or the error it
+#		stopped with. A variant that ran and disagrees is a failure.
+#========================
+compare()
+{
+	if [ "$4" != 0 ]
+	then
+		echo "$1: `tail -1 "$3"` (exit $4)"
+	elif [ -n "$5" ]
+	then
+		r=`settled "$5" "$2" "$3"`
+		echo "$1: $r"
+		case "$r" in
+			agrees*) ;;
+			*) echo "FAIL: $1 on $cir $r" >&2; fail=`expr $fail + 1`;;
+		esac
+	elif cmp -s "$2" "$3"
+	then
+		echo "$1: agrees"
+	else
+		echo "$1: differs"
+		echo "FAIL: $1 differs on $cir" >&2
+		fail=`expr $fail + 1`
+	fi
+}
+
+#========================
+#Check Run
+#========================
+#Parameters:
+#	$1	-	a circuit file
+#	$2	-	a vector file for it
+#Summary:
+#	Runs the circuit on the Gate objects, then on every engine, order
+#		and option that must print the same waveforms, writing the
+#		record to stdout.
+#========================
+checkRun()
+{
+	cir=$1
+	vec=$2
+	tmp=$OUT/tmp
+
+	echo "== run $cir $vec"
+	$D run $cir $vec > $tmp.ref 2>&1
+	s=$?
+	cat $tmp.ref
+	echo "exit $s"
+
+	if [ $s = 0 ]
+	then
+		while read v
+		do
+			$D run $cir $vec $v > $tmp.run 2>&1
+			compare "run $v" $tmp.ref $tmp.run $?
+		done <<EOF
+-engine compiled
+-engine compiled -order level
+-engine compiled -order dfs
+-engine compiled -order rcm
+-engine compiled -order best
+-engine compiled -lut 4
+-engine compiled -lut 2 -order rcm
+-engine compiled -threads 2
+-engine compiled -threads 3 -order dfs
+-engine event
+-engine event -threads 2
+-engine window
+-engine window -threads 2
+-engine window -lut 3
+-optimize
+-engine compiled -optimize
+-engine event -optimize
+-engine window -optimize -lut 3
+EOF
+
+		gzip -c $vec > $tmp.gz
+		$D run $cir $tmp.gz > $tmp.run 2>&1
+		compare "run on the gzipped vector" $tmp.ref $tmp.run $?
+
+		$D sort $vec $tmp.sorted > /dev/null 2>&1
+		$D pack $cir $tmp.sorted $tmp.dgv > /dev/null 2>&1
+		$D run $cir $tmp.dgv > $tmp.run 2>&1
+		compare "run on the packed vector" $tmp.ref $tmp.run $?
+	fi
+
+	echo "== regress -procs 2"
+	$D regress $cir $vec $vec -procs 2 > $tmp.ref 2>&1
+	s=$?
+	cat $tmp.ref
+	echo "exit $s"
+
+	if [ $s = 0 ]
+	then
+		while read v
+		do
+			$D regress $cir $vec $vec $v > $tmp.run 2>&1
+			compare "regress $v" $tmp.ref $tmp.run $?
+		done <<EOF
+-procs 1
+-procs 2 -order rcm -lut 4
+-procs 2 -optimize
+EOF
+	fi
+
+	echo "== stream"
+	$D stream $cir $vec > $tmp.ref 2>&1
+	s=$?
+	cat $tmp.ref
+	echo "exit $s"
+
+	if [ $s = 0 ]
+	then
+		while read v
+		do
+			$D stream $cir $vec $v > $tmp.run 2>&1
+			compare "stream $v" $tmp.ref $tmp.run $?
+		done <<EOF
+-batch 1
+-batch 3 -order dfs -lut 4
+-sort
+-optimize
+EOF
+
+		$D sort $vec $tmp.sorted -memory 4 > /dev/null 2>&1
+		$D stream $cir $tmp.sorted > $tmp.run 2>&1
+		compare "stream on the vector sorted 4 lines at a time" $tmp.ref $tmp.run $?
+
+		gzip -c $vec > $tmp.gz
+		$D stream $cir $tmp.gz -o $tmp.out.gz > $tmp.run 2>&1
+		gzip -dc $tmp.out.gz > $tmp.run
+		compare "stream to and from gzip" $tmp.ref $tmp.run $?
+
+		$D sort $vec $tmp.sorted > /dev/null 2>&1
+		$D pack $cir $tmp.sorted $tmp.dgv > /dev/null 2>&1
+		$D stream $cir $tmp.dgv > $tmp.run 2>&1
+		compare "stream on the packed vector" $tmp.ref $tmp.run $?
+	fi
+
+	rm -f $tmp.ref $tmp.run $tmp.sorted $tmp.gz $tmp.out.gz $tmp.dgv
+}
+
+#========================
+#Check Circuit
+#========================
+#Parameters:
+#	$1	-	a circuit file
+#	$2	-	its vector file
+#Summary:
+#	Runs every check of one circuit as a whole, writing the record to
+#		stdout.
+#========================
+checkCircuit()
+{
+	cir=$1
+	vec=$2
+	tmp=$OUT/tmp
+
+	checkRun $cir $vec
+
+	# Settled outputs only, on inputs that hold long enough to settle.
+	$D random $cir -seed 7 -time 20000 -toggle 0.2 -hold 400 -save 0 $tmp.vec > /dev/null 2>&1
+
+	if [ -f $tmp.vec ]
+	then
+		echo "== run on random input -seed 7 -hold 400"
+		$D run $cir $tmp.vec > $tmp.ref 2>&1
+
+		while read v
+		do
+			$D run $cir $tmp.vec $v > $tmp.run 2>&1
+			compare "run $v" $tmp.ref $tmp.run $? $cir
+		done <<EOF
+-engine compiled -functional
+-engine aig
+-engine aig -functional
+-engine aig -lut 4
+EOF
+	fi
+
+	echo "== truth -hash"
+	$D truth $cir -hash > $tmp.ref 2>&1
+	s=$?
+	cat $tmp.ref
+	echo "exit $s"
+
+	if [ $s = 0 ]
+	then
+		echo "== truth -hash -x"
+		$D truth $cir -hash -x 2>&1
+		echo "exit $?"
+
+		while read v
+		do
+			$D truth $cir -hash $v > $tmp.run 2>&1
+			compare "truth $v" $tmp.ref $tmp.run $?
+		done <<EOF
+-lut 4
+-threads 2
+-optimize
+-functional
+EOF
+	fi
+
+	echo "== random -runs 3 -seed 7 -time 200"
+	$D random $cir -runs 3 -seed 7 -time 200 > $tmp.ref 2>&1
+	s=$?
+	cat $tmp.ref
+	echo "exit $s"
+
+	if [ $s = 0 ]
+	then
+		while read v
+		do
+			$D random $cir -runs 3 -seed 7 -time 200 $v > $tmp.run 2>&1
+			compare "random $v" $tmp.ref $tmp.run $?
+		done <<EOF
+-lut 4
+-threads 2
+-order rcm
+-optimize
+EOF
+	fi
+
+	echo "== faults"
+	$D faults $cir $vec > $tmp.ref 2>&1
+	s=$?
+	cat $tmp.ref
+	echo "exit $s"
+
+	if [ $s = 0 ]
+	then
+		$D faults $cir $vec -threads 2 > $tmp.run 2>&1
+		compare "faults -threads 2" $tmp.ref $tmp.run $?
+	fi
+
+	echo "== faults -collapse"
+	$D faults $cir $vec -collapse > $tmp.ref 2>&1
+	s=$?
+	cat $tmp.ref
+	echo "exit $s"
+
+	if [ $s = 0 ]
+	then
+		while read v
+		do
+			$D faults $cir $vec $v > $tmp.run 2>&1
+			compare "faults $v" $tmp.ref $tmp.run $?
+		done <<EOF
+-collapse -concurrent
+-collapse -threads 2
+EOF
+		$D faults $cir $vec -concurrent > $tmp.run 2>&1
+		$D faults $cir $vec > $tmp.ref 2>&1
+		compare "faults -concurrent" $tmp.ref $tmp.run $?
+	fi
+
+	echo "== atpg -seed 1"
+	$D atpg $cir $tmp.atpg -seed 1 2>&1
+	s=$?
+	echo "exit $s"
+
+	if [ $s = 0 ]
+	then
+		echo "== faults on the atpg vector"
+		$D faults $cir $tmp.atpg -collapse 2>&1
+		echo "exit $?"
+	fi
+
+	echo "== scoap -top 5"
+	$D scoap $cir -top 5 2>&1
+	echo "exit $?"
+
+	echo "== symbolic"
+	$D symbolic $cir 2>&1
+	echo "exit $?"
+
+	rm -f $tmp.ref $tmp.run $tmp.vec $tmp.atpg
+}
+
+#========================
+#Check Equivalence
+#========================
+#Parameters:
+#	none
+#Summary:
+#	Proves circuits equal that are, and not those that are not, writing
+#		the record to stdout.
+#========================
+checkEquiv()
+{
+	while read p
+	do
+		echo "== symbolic $p"
+		$D symbolic $p 2>&1
+		echo "exit $?"
+
+		echo "== equiv $p"
+		$D equiv $p -seed 1 -cex $OUT/tmp.cex 2>&1
+		echo "exit $?"
+
+		if [ -f $OUT/tmp.cex ]
+		then
+			cat $OUT/tmp.cex
+			rm -f $OUT/tmp.cex
+		fi
+	done <<EOF
+circuits/2x2mult.txt check/2x2mult_nand.txt
+circuits/2x2mult.txt check/2x2mult_bug.txt
+circuits/3_1bitadder.txt check/3_1bitadder_demorgan.txt
+EOF
+}
+
+#========================
+#Check Bmc
+#========================
+#Parameters:
+#	none
+#Summary:
+#	Checks the property files in check/ on their circuits, writing the
+#		record to stdout.
+#========================
+checkBmc()
+{
+	while read c p v
+	do
+		echo "== bmc $c $p${v:+ $v}"
+		$D bmc $c $p $v -cex $OUT/tmp.cex 2>&1
+		echo "exit $?"
+
+		if [ -f $OUT/tmp.cex ]
+		then
+			cat $OUT/tmp.cex
+			rm -f $OUT/tmp.cex
+		fi
+	done <<EOF
+circuits/flipflop.txt check/flipflop_props.txt
+circuits/flipflop.txt check/flipflop_props.txt -x
+circuits/flipflop.txt check/flipflop_props.txt -depth 2
+circuits/flipflop.txt check/flipflop_none.txt
+EOF
+}
+
+#========================
+#Check Arith
+#========================
+#Parameters:
+#	none
+#Summary:
+#	Checks the arithmetic specs in check/ on their circuits, writing the
+#		record to stdout.
+#========================
+checkArith()
+{
+	while read c p
+	do
+		for v in "" "-threads 3 -lut 4"
+		do
+			echo "== arith $c $p${v:+ $v}"
+			$D arith $c $p $v 2>&1
+			echo "exit $?"
+		done
+	done <<EOF
+circuits/2x2mult.txt check/2x2mult_arith.txt
+circuits/3_1bitadder.txt check/3_1bitadder_arith.txt
+circuits/2BitAdder.txt check/2BitAdder_arith.txt
+EOF
+}
+
+if [ ! -x $D ]
+then
+	echo "check.sh: build $D first (make digibatch)." >&2
+	exit 1
+fi
+
+mkdir -p $OUT
+rm -f $OUT/*.out
+
+for cir in circuits/*.txt
+do
+	case $cir in
+		*_v.txt|*_V.txt) continue;;
+	esac
+
+	b=`basename $cir .txt`
+	vec=circuits/${b}_v.txt
+	[ -f $vec ] || vec=circuits/${b}_V.txt
+
+	checkCircuit $cir $vec > $OUT/$b.out
+done
+
+# Goes X-free, so the compiled engine turns binary, then X again.
+checkRun circuits/2x2mult.txt check/2x2mult_x_v.txt > $OUT/2x2mult_x.out
+
+checkEquiv > $OUT/equiv.out
+checkBmc > $OUT/bmc.out
+checkArith > $OUT/arith.out
+
+if [ "$1" = "-update" ] && [ $fail = 0 ]
+then
+	mkdir -p $EXP
+	rm -f $EXP/*.out
+	cp $OUT/*.out $EXP/
+	echo "check.sh: expected output updated."
+	exit 0
+fi
+
+for b in `ls $EXP $OUT | grep '\.out$' | sort -u`
+do
+	if ! diff -u $EXP/$b $OUT/$b
+	then
+		echo "FAIL: $OUT/$b differs from $EXP/$b" >&2
+		fail=`expr $fail + 1`
+	fi
+done
+
+if [ $fail != 0 ]
+then
+	echo "check.sh: $fail check(s) failed."
+	exit 1
+fi
+
+echo "check.sh: all checks passed."
+exit 0
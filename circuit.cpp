@@ -329,21 +329,20 @@ vector<oPadState*>*	Vector::getOPadStates() throw (SourceListEmpty)
 //		this tick function calls the tick function of all the PadStates held
 //		by padStates. They in turn call the tick functions of their linked
 //		pads, which calls the tick of their wires, which call their gates, etc.
-//		Note: the call to itick resets all the gate's execution records, so
-//			that they will execute next tick.
+//		Note: each PadState's pass runs in a fresh gate epoch, so every gate
+//			it reaches will execute once during that pass.
 //Returns:
 //	n/a
 //========================
-void		Vector::tick(int ct) throw (BasicException)
+void		Vector::tick(int ct)
 {
 	list<PadState*>::iterator PSi = padStates->begin();
 
 	while (PSi != padStates->end())
 	{
-		(*PSi)->tick(ct); // branches
+		Gate::newEpoch(); // gates run at most once per pass.
 
-		(*PSi)->itick(ct); // branches, undoing the incrementers that prevent gates from being run
-							// more than once.
+		(*PSi)->tick(ct); // branches
 
 		PSi++;
 	}
@@ -377,6 +376,8 @@ int			Vector::trace() throw (BasicException)
 			if ((*PSi)->cntStates() > bPS)
 				bPS = (*PSi)->cntStates(); // finds biggest padstate input vector.
 
+		Gate::newEpoch(); // fresh pass, so repeated traces agree.
+
 		int t = (*PSi)->trace(oB); // trace branches through objects.
 
 		if (t > big)
@@ -862,6 +863,111 @@ Vector*		Circuit::getVector()
 	return flow;
 }
 
+//========================
+//Circuit Validate
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Checks the structure of the circuit once, after loading, so that the
+//		tick/transform loop can run without checking anything itself.
+//		Every gate must have an output wire and the right number of inputs
+//		(one for NOT, two or more for the rest), and must be the only
+//		driver of its output. Every wire must be driven by exactly one
+//		pad or gate and must lead somewhere, and every pad must be wired.
+//		Pad names must be unique, since Vectors look PadStates up by name.
+//Returns:
+//	n/a	-	throws InvalidCircuit describing the first fault found.
+//========================
+void		Circuit::validate() throw (InvalidCircuit)
+{
+	char	buf[12];
+
+	for (int ip = 0; ip < inPads->size(); ip++)
+	{
+		iPad* p = inPads->at(ip);
+
+		if (p->getIO() == NULL)
+			throw InvalidCircuit(string("input pad ").append(p->getID()).append(" is not wired."));
+
+		if (p->getIO()->getInput() != p)
+			throw InvalidCircuit(string("wire ").append(p->getIO()->getID()).append(" is driven by both input pad ").append(p->getID()).append(" and ").append(p->getIO()->getInput()->getID()).append("."));
+
+		for (int iq = 0; iq < ip; iq++)
+		{
+			if (inPads->at(iq)->getID() == p->getID())
+				throw InvalidCircuit(string("input pad ").append(p->getID()).append(" is declared twice."));
+		}
+	}
+
+	for (int op = 0; op < outPads->size(); op++)
+	{
+		oPad* p = outPads->at(op);
+
+		if (p->getIO() == NULL)
+			throw InvalidCircuit(string("output pad ").append(p->getID()).append(" is not wired."));
+
+		if (p->getIO()->getInput() == NULL)
+			throw InvalidCircuit(string("output pad ").append(p->getID()).append(" is undriven."));
+
+		for (int oq = 0; oq < op; oq++)
+		{
+			if (outPads->at(oq)->getID() == p->getID())
+				throw InvalidCircuit(string("output pad ").append(p->getID()).append(" is declared twice."));
+		}
+
+		for (int iq = 0; iq < inPads->size(); iq++)
+		{
+			if (inPads->at(iq)->getID() == p->getID())
+				throw InvalidCircuit(string("pad ").append(p->getID()).append(" is both an input and an output."));
+		}
+	}
+
+	vector<LogicObj*>::iterator LOi = LogicObjs->begin();
+
+	while (LOi != LogicObjs->end())
+	{
+		Gate* g = dynamic_cast<Gate*>(*LOi);
+
+		if (g != NULL)
+		{
+			Wire* o = g->getOutput();
+
+			if (o == NULL)
+				throw InvalidCircuit(string("gate ").append(g->getID()).append(" has no output wire."));
+
+			if (o->getInput() != g)
+				throw InvalidCircuit(string("wire ").append(o->getID()).append(" is driven by both ").append(g->getID()).append(" and ").append(o->getInput()->getID()).append("."));
+
+			int n = g->cntInputs();
+
+			if ((dynamic_cast<logicNOT*>(g) != NULL) ? (n != 1) : (n < 2))
+				throw InvalidCircuit(string("gate ").append(g->getID()).append(" has ").append(itoa(n, buf, 10)).append(" input(s)."));
+
+			for (int k = 0; k < n; k++)
+			{
+				if (g->getInput(k) == NULL)
+					throw InvalidCircuit(string("gate ").append(g->getID()).append(" has a missing input wire."));
+			}
+		}
+		else
+		{
+			Wire* w = dynamic_cast<Wire*>(*LOi);
+
+			if (w != NULL)
+			{
+				if (w->getInput() == NULL)
+					throw InvalidCircuit(string("wire ").append(w->getID()).append(" has no driver."));
+
+				if (w->cntOutputs() == 0)
+					throw InvalidCircuit(string("wire ").append(w->getID()).append(" is dangling; nothing reads it."));
+			}
+		}
+
+		LOi++;
+	}
+}
+
 //========================
 //Circuit Run
 //========================
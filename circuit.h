@@ -59,7 +59,7 @@ public:
 vector<iPadState*>*	getIPadStates() throw (SourceListEmpty);
 vector<oPadState*>*	getOPadStates() throw (SourceListEmpty);
 
-	void		tick(int ct) throw (BasicException);
+	void		tick(int ct);
 	int			trace() throw (BasicException);
 
 private:
@@ -117,6 +117,7 @@ public:
 	void		setVector(Vector *a) throw (NullPointerException);
 	Vector*		getVector();
 
+	void		validate() throw (InvalidCircuit);
 	void		run(int tEnd) throw (BasicException);
 
 	void		clrCircuit();
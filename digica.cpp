@@ -20,6 +20,7 @@
 #include "logic.h"
 #include "gate.h"
 #include "circuit.h"
+#include "loader.h"
 #include "gui.h"
 #include "ezwin.h"
 
@@ -197,247 +198,7 @@ int ApiMain()
 
 	try
 	{
-		string CMD;
-
-		while (!(fcir.eof()))
-		{
-
-			fcir >> CMD;
-
-			if ((CMD == "") || fcir.eof()) // Final Blank line or EOF
-				break;
-
-			if (CMD == "CIRCUIT") // Create a new circuit.
-			{
-				string tname;
-				fcir >> tname;
-
-				if (tname == "")
-					throw NullIDException();
-
-				crc = new Circuit(tname);
-			}
-			else if (CMD == "INPUT") // Input Pad
-			{
-				string tname;
-				string wName;
-				fcir >> tname >> wName;
-
-				if (crc == NULL)
-					throw NullPointerException();
-
-				Wire* t = NULL;
-				try
-				{
-					t = (Wire*) crc->getLogicObj(wName);
-				}
-				catch (ElementNotFound e) // It's not already in the circuit
-				{
-					t = new Wire(wName, indet);
-					crc->addLogicObj(t);
-				}
-
-				if (t == NULL)
-					throw NullPointerException();
-
-				iPad* tPad = new iPad(tname, indet);
-
-				tPad->setIO(t);		// Link the Wire and the Pad.
-				t->setInput(tPad);
-
-				crc->addiPad(tPad);
-			}
-			else if (CMD == "OUTPUT") // Output Pad
-			{
-				string tname;
-				string wName;
-				fcir >> tname >> wName;
-
-				if (crc == NULL)
-					throw NullPointerException();
-
-				Wire* t = NULL;
-				try
-				{
-					t = (Wire*) crc->getLogicObj(wName);
-				}
-				catch (ElementNotFound e) // It's not already in the circuit
-				{
-					t = new Wire(wName, indet);
-					crc->addLogicObj(t);
-				}
-
-				if (t == NULL)
-					throw NullPointerException();
-
-				oPad* tPad = new oPad(tname, indet);
-
-				tPad->setIO(t);		// Link the wire and the Pad
-				t->addOutput(tPad);
-
-				crc->addoPad(tPad);
-			}
-			else
-			{ // It's a gate
-				if (crc == NULL)
-					throw NullPointerException();
-
-				// Prepare variables for data.
-				Gate*	gt = NULL;
-
-				Wire*	wi1 = NULL; // These are explicitly set to NULL
-				Wire*	wi2 = NULL; // because VC++ doesn't do it for me.
-				Wire*	wo = NULL;
-
-				string	tdly;
-				int		tdly2;
-				string	twi1;
-				string	twi2;
-				string	two;
-				string	tID;
-
-				fcir >> tdly;
-
-				if (tdly.substr(tdly.size() - 1, 1) == "s") // has ns
-				{
-					tdly = tdly.substr(0, tdly.size() - 2);
-					tdly2 = atoi(tdly.c_str());
-				}
-				else // lacks ns
-					tdly2 = atoi(tdly.c_str());
-
-				if (tdly2 <= 0) // avoid invalid delay.
-					tdly2 = 1;
-
-				tID = CMD;	// ID will be constructed.
-
-				// Single input
-				if (CMD == "NOT" || CMD == "INVERTER" || CMD == "INV")
-				{
-					fcir >> twi1 >> two;
-
-					tID = tID.append(twi1).append(two); // ID is generated by GateType[W][W].
-
-					try // Wire Input
-					{
-						wi1 = (Wire*) crc->getLogicObj(twi1);
-					}
-					catch (ElementNotFound e) // It's not already in the circuit
-					{
-						wi1 = new Wire(twi1, indet);
-						crc->addLogicObj(wi1);
-					}
-
-					if (wi1 == NULL)
-						throw NullPointerException();
-
-
-					try // Wire Ouput
-					{
-						wo = (Wire*) crc->getLogicObj(two);
-					}
-					catch (ElementNotFound e) // It's not already in the circuit
-					{
-						wo = new Wire(two, indet);
-						crc->addLogicObj(wo);
-					}
-
-					if (wo == NULL)
-						throw NullPointerException();
-
-					gt = new logicNOT(tID, indet, tdly2);
-
-					if (gt == NULL)
-						throw NullPointerException();
-
-					crc->addLogicObj(gt);
-
-					gt->setOutput(wo);	// Link the Gate with its wires.
-					wo->setInput(gt);
-					gt->addInput(wi1);
-					wi1->addOutput(gt);
-					//Done making Gate
-				}
-				else
-				{
-					fcir >> twi1 >> twi2 >> two;
-
-					tID = tID.append(twi1).append(twi2).append(two); // see above.
-
-					try // Wire Input
-					{
-						wi1 = (Wire*) crc->getLogicObj(twi1);
-					}
-					catch (ElementNotFound e) // It's not already in the circuit
-					{
-						wi1 = new Wire(twi1, indet);
-						crc->addLogicObj(wi1);
-					}
-
-					if (wi1 == NULL)
-						throw NullPointerException();
-
-					try // Wire Input
-					{
-						wi2 = (Wire*) crc->getLogicObj(twi2);
-					}
-					catch (ElementNotFound e) // It's not already in the circuit
-					{
-						wi2 = new Wire(twi2, indet);
-						crc->addLogicObj(wi2);
-					}
-
-					if (wi2 == NULL)
-						throw NullPointerException();
-
-					try // Wire Ouput
-					{
-						wo = (Wire*) crc->getLogicObj(two);
-					}
-					catch (ElementNotFound e) // It's not already in the circuit
-					{
-						wo = new Wire(two, indet);
-						crc->addLogicObj(wo);
-					}
-
-					if (wo == NULL)
-						throw NullPointerException();
-
-					//Evaluate for Gate Type and create it.
-					if (CMD == "OR")
-						gt = new logicOR(tID, indet, tdly2);
-					else if (CMD == "AND")
-						gt = new logicAND(tID, indet, tdly2);
-					else if (CMD == "NAND")
-						gt = new logicNAND(tID, indet, tdly2);
-					else if (CMD == "NOR")
-						gt = new logicNOR(tID, indet, tdly2);
-					else if (CMD == "XOR")
-						gt = new logicXOR(tID, indet, tdly2);
-					else if (CMD == "XNOR")
-						gt = new logicXNOR(tID, indet, tdly2);
-					else
-						throw BasicException("Invalid Gate Type.");
-
-					if (gt == NULL)
-						throw NullPointerException();
-
-					crc->addLogicObj(gt);
-
-					gt->setOutput(wo);	//Link the Gate with its wires.
-					gt->addInput(wi1);
-					gt->addInput(wi2);
-
-					wo->setInput(gt);	//And the wires to the Gate.
-					wi1->addOutput(gt);
-					wi2->addOutput(gt);
-					//Done making Gate
-				}
-			}
-		}
-
-		if (crc == NULL)
-			throw NullPointerException();
+		crc = loadCircuit(fcir);
 	}
 	catch(BasicException e)
 	{
@@ -446,125 +207,24 @@ int ApiMain()
 		return 1;
 	}
 
-	try // Now for the Vector File
+	try // Structural checks happen once, here, rather than on every tick.
 	{
-		string CMD;
-
-		while (!(fvec.eof()))
-		{
-
-			fvec >> CMD;
-
-			if ((CMD == "") || (fvec.eof()))
-				break;
-
-			if (CMD == "VECTOR") // Create a new vector.
-			{
-				if (crc == NULL)
-					throw NullPointerException();
-
-				string tID;
-
-				fvec >> tID;
-
-				if (tID == "")
-					throw NullIDException();
-
-				Vector* tVec = NULL;
-
-				tVec = new Vector(tID);
-
-				if (tVec == NULL)
-					throw NullPointerException();
-
-				crc->setVector(tVec); // set the current circuit's Vector to the new Vector.
-
-				// loop through and create a PadState for each iPad and oPad in the circuit.
-
-				//iPads
-				for (int ipa = 0; ipa < crc->cntiPads(); ipa++)
-				{
-					iPadState *tpi = new iPadState(crc->getiPad(ipa)->getID(), indet, crc->getiPad(ipa));
-					tVec->addPadState(tpi);
-				}
-
-				for (int opa = 0; opa < crc->cntoPads(); opa++)
-				{
-					oPadState *tpo = new oPadState(crc->getoPad(opa)->getID(), indet, crc->getoPad(opa));
-					tVec->addPadState(tpo);
-				}
-			}
-			else if (CMD == "INPUT")	// An input change!
-			{
-				string tID;
-				string tdly;
-				int    tdly2;
-				string State;
-				state  State2;
-
-				fvec >> tID >> tdly >> State;
-
-				if (tdly.substr(tdly.size() - 1, 1) == "s") // has ns
-				{
-					tdly = tdly.substr(0, tdly.size() - 2);
-					tdly2 = atoi(tdly.c_str());
-				}
-				else // lacks ns.
-					tdly2 = atoi(tdly.c_str());
-
-
-				if (tdly2 < 0) // avoid invalid delay.
-					tdly2 = 0;
-
-				// Determine state.
-				if (State == "0")
-					State2 = low;
-				else if (State == "1")
-					State2 = high;
-				else if ((State == "2") || (State == "X") || (State == "x"))
-					State2 = indet;
-				else
-					throw UnknownState();
-
-				if (crc == NULL)	// Circuit Exists
-					throw NullPointerException();
-
-				if (crc->getVector() == NULL)	// Circuit has Vector
-					throw NullPointerException();
-
-				PadState *tPS = NULL;
-
-				try // There should already be a padstate for this input vector.
-				{
-					tPS = crc->getVector()->getPadState(tID);
-				}
-				catch (ElementNotFound e)
-				{
-					cout << "Vector definitions do not match with circuit definitions." << endl;
-					Terminate();
-					return 1;
-				}
-
-				tPS->addState(State2, tdly2);	// Add a new condition.
-			}
-			else
-			{
-				cout << "Unrecognized vector file command." << endl;
-				Terminate();
-				return 1;
-			}
-		}
+		crc->validate();
 	}
-	catch(BasicException g)
+	catch(InvalidCircuit v)
 	{
-		cout << "Error reading Vector File: " << g.getMessage() << endl;
+		cout << v.getMessage() << endl;
 		Terminate();
 		return 1;
 	}
 
-	if (crc->getVector() == NULL)
+	try // Now for the Vector File
 	{
-		cout << "Vector is undefined. Exiting." << endl;
+		loadVector(crc, fvec);
+	}
+	catch(BasicException g)
+	{
+		cout << "Error reading Vector File: " << g.getMessage() << endl;
 		Terminate();
 		return 1;
 	}
@@ -0,0 +1,942 @@
+//================================================================
+//Filename:		Compiled Simulation Engine Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the Engine: compiling
+//					a Netlist into a flat program, stepping it on one
+//					or more threads, and running it against a Vector.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "engine.h"
+
+using namespace std;
+
+// Program layout, per gate: kind, output wire, ring offset, delay,
+// input count, record length, binary truth table (4 bits, or -1 for a
+// gate that needs the general path), ring head, then the input wires.
+// A gLUT record goes on with its ternary and binary truth table offsets
+// and, per input, the offset, length and head of that input's skew ring
+// (length 0 for none).
+#define PG_TYPE		0
+#define PG_OUT		1
+#define PG_RING		2
+#define PG_DELAY	3
+#define PG_NIN		4
+#define PG_NEXT		5
+#define PG_TT		6
+#define PG_HEAD		7
+#define PG_IN		8
+
+// Offsets into a gLUT record's extension, which follows its input wires.
+#define LX_TERN		0
+#define LX_BIN		1
+#define LX_SKEW		2
+
+// Bytes in a cache line. Chunks of the program and state arrays handed
+// to different threads start on one, so no line is written by two.
+#define LINE		64
+
+//========================
+//Integer Power
+//========================
+//Parameters:
+//	int	b	-	base
+//	int	e	-	exponent, 0 or more
+//Summary:
+//	b raised to e, for truth table sizes.
+//Returns:
+//	int	-	b^e
+//========================
+static int	ipow(int b, int e)
+{
+	int v = 1;
+
+	while (e-- > 0)
+		v *= b;
+
+	return v;
+}
+
+//========================
+//Ternary Index
+//========================
+//Parameters:
+//	int	bdx	-	a binary truth table row, input 0 least significant
+//Summary:
+//	The row of the ternary truth table with the same 0/1 inputs.
+//Returns:
+//	int	-	the ternary row
+//========================
+static int	tern(int bdx)
+{
+	int idx = 0;
+	int mult = 1;
+
+	for (; bdx > 0; bdx >>= 1)
+	{
+		idx += (bdx & 1) * mult;
+		mult *= 3;
+	}
+
+	return idx;
+}
+
+//========================
+//Round Up
+//========================
+//Parameters:
+//	int	v	-	a count
+//	int	m	-	a multiple
+//Summary:
+//	v rounded up to a multiple of m.
+//Returns:
+//	int	-	the rounded count
+//========================
+static int	roundUp(int v, int m)
+{
+	return ((v + m - 1) / m) * m;
+}
+
+//========================
+//Line Skip
+//========================
+//Parameters:
+//	void	*base	-	the start of an array
+//	int		size	-	the size of one element
+//Summary:
+//	How many elements into the array the first cache line boundary falls.
+//Returns:
+//	int	-	the element count
+//========================
+static int	lineSkip(void *base, int size)
+{
+	unsigned long a = (unsigned long) base;
+
+	return (int) (((LINE - (a % LINE)) % LINE) / size);
+}
+
+//========================
+//Skewed Input
+//========================
+//Parameters:
+//	int				*q	-	a skew ring's offset, length and head
+//	unsigned char	*sr	-	the skew ring storage
+//	unsigned char	v	-	the input's value this step
+//Summary:
+//	Passes v through a gLUT input's skew ring: stores this step's value
+//		and returns the one from length steps ago, or v itself for an
+//		input with no skew.
+//Returns:
+//	int	-	the delayed value
+//========================
+static inline int	skewed(int *q, unsigned char *sr, unsigned char v)
+{
+	if (q[1] == 0)
+		return v;
+
+	unsigned char old = sr[q[0] + q[2]];
+
+	sr[q[0] + q[2]] = v;
+
+	if (++q[2] == q[1])
+		q[2] = 0;
+
+	return old;
+}
+
+//========================
+//Engine Constructor
+//========================
+//Parameters:
+//	Netlist	*n			-	the netlist to compile
+//	int		nt			-	how many threads evaluate each step
+//Summary:
+//	Lays the netlist's gates out as a program in netlist order and sizes
+//		the wire and delay ring arrays. The netlist must outlive the Engine
+//		and must not be reordered while the Engine is in use.
+//		For more than one thread, the gates are cut into that many chunks
+//		of about equal size, each cut moved forward to a gate whose output
+//		wire starts a cache line. Each chunk's program, delay rings and
+//		skew rings also start on a fresh line, so threads never write to
+//		the same line. The calling thread runs chunk 0; the others wait
+//		at a barrier between steps.
+//========================
+Engine::Engine(Netlist *n, int nt) throw (NullPointerException, BasicException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	if (nt < 1)
+		throw BasicException("Thread count must be at least 1.");
+
+	net = n;
+	nThreads = nt;
+	settle = 0;
+	binarySteps = 0;
+	quit = false;
+	seat = 0;
+
+	for (int t = gAND; t < gLUT; t++) // every one or two input gate as a 3x3 table.
+	{
+		for (int a = low; a <= indet; a++)
+		{
+			for (int b = low; b <= indet; b++)
+			{
+				state s;
+
+				switch (t)
+				{
+				case gAND:	s = AND((state) a, (state) b);			break;
+				case gNAND:	s = NOT(AND((state) a, (state) b));		break;
+				case gOR:	s = OR((state) a, (state) b);			break;
+				case gNOR:	s = NOT(OR((state) a, (state) b));		break;
+				case gXOR:	s = XOR((state) a, (state) b);			break;
+				case gXNOR:	s = NOT(XOR((state) a, (state) b));		break;
+				default:	s = NOT((state) a);						break; // b == a
+				}
+
+				pairTable[t * 9 + a * 3 + b] = s;
+			}
+		}
+	}
+
+	int nG = n->cntGates();
+
+	chunkGate = new vector<int>(nThreads + 1, nG);
+	chunkPC = new vector<int>(nThreads + 1, 0);
+	chunkX = new vector<int>(nThreads * (LINE / sizeof(int)), 0);
+
+	(*chunkGate)[0] = 0;
+
+	for (int c = 1; c < nThreads; c++)
+	{
+		int g = (int) (((long) nG * c) / nThreads);
+
+		if (g < (*chunkGate)[c - 1])
+			g = (*chunkGate)[c - 1];
+
+		for (int s = 0; (s < LINE) && (g + s < nG); s++)
+		{
+			if ((n->getOutput(g + s) % LINE) == 0)
+			{
+				g += s;
+				break;
+			}
+		}
+
+		(*chunkGate)[c] = g;
+	}
+
+	vector<int>				code;
+	vector<unsigned char>	luts;
+
+	int ring = 0;
+	int skew = 0;
+
+	for (int c = 0; c < nThreads; c++)
+	{
+		while ((code.size() % (LINE / sizeof(int))) != 0)
+			code.push_back(0);
+
+		ring = roundUp(ring, LINE);
+		skew = roundUp(skew, LINE);
+
+		(*chunkPC)[c] = code.size();
+
+		for (int g = (*chunkGate)[c]; g < (*chunkGate)[c + 1]; g++)
+		{
+			int nIn = n->cntInputs(g);
+
+			code.push_back(n->getType(g));
+			code.push_back(n->getOutput(g));
+			code.push_back(ring);
+			code.push_back(n->getDelay(g));
+			code.push_back(nIn);
+			code.push_back(PG_IN + nIn + ((n->getType(g) == gLUT) ? LX_SKEW + 3 * nIn : 0));
+
+			if ((n->getType(g) == gLUT) || (nIn > 2))
+				code.push_back(-1);
+			else
+			{
+				int tt = 0;
+
+				for (int ab = 0; ab < 4; ab++)
+					tt |= pairTable[n->getType(g) * 9 + (ab & 1) * 3 + (ab >> 1)] << ab;
+
+				code.push_back(tt);
+			}
+
+			code.push_back(0);
+
+			for (int k = 0; k < nIn; k++)
+				code.push_back(n->getInput(g, k));
+
+			if (n->getType(g) == gLUT)
+			{
+				code.push_back(luts.size());
+				code.push_back(luts.size() + ipow(3, nIn));
+
+				for (int k = 0; k < nIn; k++)
+				{
+					code.push_back(skew);
+					code.push_back(n->getSkew(g, k));
+					code.push_back(0);
+
+					skew += n->getSkew(g, k);
+
+					if (n->getSkew(g, k) > settle)
+						settle = n->getSkew(g, k);
+				}
+
+				for (int idx = 0; idx < ipow(3, nIn); idx++)
+					luts.push_back(n->getLUT(g, idx));
+
+				for (int bdx = 0; bdx < (1 << nIn); bdx++) // 0/1 rows, indexed base 2.
+					luts.push_back(n->getLUT(g, tern(bdx)));
+			}
+
+			if (n->getDelay(g) > settle)
+				settle = n->getDelay(g);
+
+			ring += n->getDelay(g);
+		}
+	}
+
+	(*chunkPC)[nThreads] = code.size();
+
+	settle = 2 * settle + 1;	// every ring and skew slot rewritten since.
+
+	// Copy into line aligned storage; the slack covers the alignment.
+	prog = new vector<int>(code.size() + LINE / sizeof(int));
+	wires = new vector<unsigned char>(n->cntWires() + LINE);
+	rings = new vector<unsigned char>(ring + LINE);
+	skews = new vector<unsigned char>(skew + LINE);
+	tables = new vector<unsigned char>(luts.size() + 1);
+
+	p = &(*prog)[0] + lineSkip(&(*prog)[0], sizeof(int));
+	w = &(*wires)[0] + lineSkip(&(*wires)[0], 1);
+	r = &(*rings)[0] + lineSkip(&(*rings)[0], 1);
+	sr = &(*skews)[0] + lineSkip(&(*skews)[0], 1);
+	tb = &(*tables)[0];
+
+	for (int pc = 0; pc < code.size(); pc++)
+		p[pc] = code[pc];
+
+	for (int idx = 0; idx < luts.size(); idx++)
+		tb[idx] = luts[idx];
+
+	reset();
+
+	threads = new pthread_t[nThreads];
+
+	if (nThreads > 1)
+	{
+		pthread_barrier_init(&barrier, NULL, nThreads);
+		pthread_mutex_init(&gate, NULL);
+
+		seat = 1;
+
+		// Workers pass the gate before their first barrier, so if one
+		// cannot be started those that were are sent home through it.
+		pthread_mutex_lock(&gate);
+
+		int c = 1;
+
+		while ((c < nThreads) && (pthread_create(&threads[c], NULL, worker, this) == 0))
+			c++;
+
+		quit = (c < nThreads);
+
+		pthread_mutex_unlock(&gate);
+
+		if (quit)
+		{
+			char buf[80];
+
+			for (int k = 1; k < c; k++)
+				pthread_join(threads[k], NULL);
+
+			pthread_barrier_destroy(&barrier);
+			pthread_mutex_destroy(&gate);
+			release();
+
+			sprintf(buf, "Unable to start simulation thread %d of %d.", c + 1, nThreads);
+			throw BasicException(buf);
+		}
+	}
+}
+
+//========================
+//Engine Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Stops the worker threads and releases the program and state arrays.
+//		The netlist is not deleted.
+//========================
+Engine::~Engine()
+{
+	if (nThreads > 1)
+	{
+		quit = true;
+
+		pthread_barrier_wait(&barrier);
+
+		for (int c = 1; c < nThreads; c++)
+			pthread_join(threads[c], NULL);
+
+		pthread_barrier_destroy(&barrier);
+		pthread_mutex_destroy(&gate);
+	}
+
+	release();
+}
+
+//========================
+//Engine Release
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Frees the thread table, program and state arrays, for the
+//		destructor or a constructor that could not start its threads.
+//Returns:
+//	n/a
+//========================
+void		Engine::release()
+{
+	delete [] threads;
+
+	delete prog;
+	delete wires;
+	delete rings;
+	delete tables;
+	delete skews;
+	delete chunkGate;
+	delete chunkPC;
+	delete chunkX;
+}
+
+//========================
+//Engine Reset
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Returns every wire, delay ring and skew ring entry to indeterminate,
+//		as for a freshly loaded circuit.
+//Returns:
+//	n/a
+//========================
+void		Engine::reset()
+{
+	wires->assign(wires->size(), indet);
+	rings->assign(rings->size(), indet);
+	skews->assign(skews->size(), indet);
+
+	binary = false;
+	clean = 0;
+
+	for (int c = 0; c < nThreads; c++)
+	{
+		int pc = (*chunkPC)[c];
+
+		for (int g = (*chunkGate)[c]; g < (*chunkGate)[c + 1]; g++)
+		{
+			p[pc + PG_HEAD] = 0;
+
+			if (p[pc + PG_TYPE] == gLUT)
+			{
+				for (int k = 0; k < p[pc + PG_NIN]; k++)
+					p[pc + PG_IN + p[pc + PG_NIN] + LX_SKEW + 3 * k + 2] = 0;
+			}
+
+			pc += p[pc + PG_NEXT];
+		}
+	}
+}
+
+//========================
+//Engine Set Input
+//========================
+//Parameters:
+//	int		p	-	an input pad index, in netlist order
+//	state	s	-	the state to drive
+//Summary:
+//	Drives input pad p for the next step. An indeterminate input drops
+//		the Engine back to its ternary kernel.
+//Returns:
+//	n/a
+//========================
+void		Engine::setInput(int p, state s)
+{
+	if (s == indet)
+	{
+		binary = false;
+		clean = 0;
+	}
+
+	w[net->getiPadWire(p)] = s;
+}
+
+//========================
+//Engine Get Output
+//========================
+//Parameters:
+//	int	p	-	an output pad index, in netlist order
+//Summary:
+//	Reads output pad p as of the last step.
+//Returns:
+//	state	-	the current on the pad's wire
+//========================
+state		Engine::getOutput(int p)
+{
+	return (state) w[net->getoPadWire(p)];
+}
+
+//========================
+//Engine Step
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Advances the circuit one nanosecond. The first half puts the oldest
+//		entry of each gate's delay ring on its output wire; the second
+//		evaluates each gate on the settled wires and stores the result
+//		in that same ring slot, now the newest. This is the Gate::tick
+//		delay table, laid flat. A gLUT gate reads each input through its
+//		skew ring, then looks its result up in its truth table.
+//		Gates with one or two inputs (all of those a circuit file can make)
+//		evaluate as a single table lookup rather than a branch on kind.
+//		The second half comes in two kernels. The ternary one handles X;
+//		once settle steps in a row have seen no X on an input pad or in
+//		any result, every ring and skew slot holds a 0 or 1 and the
+//		Engine moves to the binary one, which is plain bitwise logic.
+//		setInput moves it back when an X arrives.
+//		Neither half has dependencies between gates, so with threads each
+//		half runs on every chunk at once and a barrier separates them:
+//		one to start the step, one between halves, one to finish.
+//Returns:
+//	n/a
+//========================
+void		Engine::step()
+{
+	if (nThreads > 1)
+		pthread_barrier_wait(&barrier);
+
+	driveChunk(0);
+
+	if (nThreads > 1)
+		pthread_barrier_wait(&barrier);
+
+	if (binary)
+	{
+		binaryChunk(0);
+
+		if (nThreads > 1)
+			pthread_barrier_wait(&barrier);
+
+		binarySteps++;
+		return;
+	}
+
+	bool sawX = ternaryChunk(0);
+
+	if (nThreads > 1)
+	{
+		pthread_barrier_wait(&barrier);
+
+		for (int c = 1; c < nThreads; c++)
+		{
+			if ((*chunkX)[c * (LINE / sizeof(int))])
+				sawX = true;
+		}
+	}
+
+	for (int ip = 0; (ip < net->cntiPads()) && !sawX; ip++)
+	{
+		if (w[net->getiPadWire(ip)] == indet)
+			sawX = true;
+	}
+
+	clean = sawX ? 0 : clean + 1;
+
+	if (clean >= settle)
+		binary = true;
+}
+
+//========================
+//Engine Worker
+//========================
+//Parameters:
+//	void	*arg	-	the Engine
+//Summary:
+//	Thread entry point: waits at the gate until every thread has been
+//		started, then takes the next chunk number and works it, unless
+//		the constructor gave up.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		Engine::worker(void *arg)
+{
+	Engine* eng = (Engine*) arg;
+
+	pthread_mutex_lock(&eng->gate);
+	pthread_mutex_unlock(&eng->gate);
+
+	if (eng->quit)
+		return NULL;
+
+	eng->work(__sync_fetch_and_add(&eng->seat, 1));
+
+	return NULL;
+}
+
+//========================
+//Engine Work
+//========================
+//Parameters:
+//	int	c	-	this thread's chunk
+//Summary:
+//	A worker's life: meet the other threads at each of step()'s three
+//		barriers, doing its chunk's share of each half, until the
+//		destructor sets quit.
+//Returns:
+//	n/a
+//========================
+void		Engine::work(int c)
+{
+	for (;;)
+	{
+		pthread_barrier_wait(&barrier);
+
+		if (quit)
+			return;
+
+		driveChunk(c);
+
+		pthread_barrier_wait(&barrier);
+
+		if (binary)
+			binaryChunk(c);
+		else
+			(*chunkX)[c * (LINE / sizeof(int))] = ternaryChunk(c);
+
+		pthread_barrier_wait(&barrier);
+	}
+}
+
+//========================
+//Engine Drive Chunk
+//========================
+//Parameters:
+//	int	c	-	a chunk
+//Summary:
+//	The first half of a step for chunk c's gates: each output wire gets
+//		the oldest entry of its gate's delay ring.
+//Returns:
+//	n/a
+//========================
+void		Engine::driveChunk(int c)
+{
+	int pc = (*chunkPC)[c];
+
+	for (int g = (*chunkGate)[c]; g < (*chunkGate)[c + 1]; g++)
+	{
+		w[p[pc + PG_OUT]] = r[p[pc + PG_RING] + p[pc + PG_HEAD]];
+		pc += p[pc + PG_NEXT];
+	}
+}
+
+//========================
+//Engine Ternary Chunk
+//========================
+//Parameters:
+//	int	c	-	a chunk
+//Summary:
+//	The second half of a step for chunk c's gates, in full 0/1/X logic.
+//Returns:
+//	bool	-	true if any gate produced an X
+//========================
+bool		Engine::ternaryChunk(int c)
+{
+	int		pc = (*chunkPC)[c];
+	bool	sawX = false;
+
+	for (int g = (*chunkGate)[c]; g < (*chunkGate)[c + 1]; g++)
+	{
+		int*		in = p + pc + PG_IN;
+		int			nIn = p[pc + PG_NIN];
+		state		s = (state) w[in[0]];
+
+		if (p[pc + PG_TT] >= 0) // one or two inputs: one table lookup.
+			s = (state) pairTable[p[pc + PG_TYPE] * 9 + s * 3 + w[in[nIn - 1]]];
+		else switch (p[pc + PG_TYPE])
+		{
+		case gAND:
+			for (int k = 1; k < nIn; k++)
+				s = AND(s, (state) w[in[k]]);
+			break;
+		case gNAND:
+			for (int k = 1; k < nIn; k++)
+				s = AND(s, (state) w[in[k]]);
+			s = NOT(s);
+			break;
+		case gOR:
+			for (int k = 1; k < nIn; k++)
+				s = OR(s, (state) w[in[k]]);
+			break;
+		case gNOR:
+			for (int k = 1; k < nIn; k++)
+				s = OR(s, (state) w[in[k]]);
+			s = NOT(s);
+			break;
+		case gXOR:
+			for (int k = 1; k < nIn; k++)
+				s = XOR(s, (state) w[in[k]]);
+			break;
+		case gXNOR:
+			for (int k = 1; k < nIn; k++)
+				s = XOR(s, (state) w[in[k]]);
+			s = NOT(s);
+			break;
+		case gNOT:
+			s = NOT(s);
+			break;
+		case gLUT:
+			{
+				int*	lx = in + nIn;
+				int		idx = 0;
+				int		mult = 1;
+
+				for (int k = 0; k < nIn; k++)
+				{
+					idx += skewed(lx + LX_SKEW + 3 * k, sr, w[in[k]]) * mult;
+					mult *= 3;
+				}
+
+				s = (state) tb[lx[LX_TERN] + idx];
+			}
+			break;
+		}
+
+		if (s == indet)
+			sawX = true;
+
+		r[p[pc + PG_RING] + p[pc + PG_HEAD]] = s;
+
+		if (++p[pc + PG_HEAD] == p[pc + PG_DELAY])
+			p[pc + PG_HEAD] = 0;
+
+		pc += p[pc + PG_NEXT];
+	}
+
+	return sawX;
+}
+
+//========================
+//Engine Binary Chunk
+//========================
+//Parameters:
+//	int	c	-	a chunk
+//Summary:
+//	The second half of a step for chunk c's gates, for when every wire
+//		and ring slot holds a 0 or 1: a one or two input gate is a bit of
+//		its 4-bit truth table, others are bitwise operations on those
+//		bytes, and gLUT gates use their 2^n row binary table.
+//Returns:
+//	n/a
+//========================
+void		Engine::binaryChunk(int c)
+{
+	int pc = (*chunkPC)[c];
+
+	for (int g = (*chunkGate)[c]; g < (*chunkGate)[c + 1]; g++)
+	{
+		int*			in = p + pc + PG_IN;
+		int				nIn = p[pc + PG_NIN];
+		unsigned char	s = w[in[0]];
+
+		if (p[pc + PG_TT] >= 0) // one or two inputs: one bit of the table.
+			s = (p[pc + PG_TT] >> (s | (w[in[nIn - 1]] << 1))) & 1;
+		else switch (p[pc + PG_TYPE])
+		{
+		case gAND:
+			for (int k = 1; k < nIn; k++)
+				s &= w[in[k]];
+			break;
+		case gNAND:
+			for (int k = 1; k < nIn; k++)
+				s &= w[in[k]];
+			s ^= 1;
+			break;
+		case gOR:
+			for (int k = 1; k < nIn; k++)
+				s |= w[in[k]];
+			break;
+		case gNOR:
+			for (int k = 1; k < nIn; k++)
+				s |= w[in[k]];
+			s ^= 1;
+			break;
+		case gXOR:
+			for (int k = 1; k < nIn; k++)
+				s ^= w[in[k]];
+			break;
+		case gXNOR:
+			for (int k = 1; k < nIn; k++)
+				s ^= w[in[k]];
+			s ^= 1;
+			break;
+		case gNOT:
+			s ^= 1;
+			break;
+		case gLUT:
+			{
+				int*	lx = in + nIn;
+				int		idx = 0;
+
+				for (int k = 0; k < nIn; k++)
+					idx |= skewed(lx + LX_SKEW + 3 * k, sr, w[in[k]]) << k;
+
+				s = tb[lx[LX_BIN] + idx];
+			}
+			break;
+		}
+
+		r[p[pc + PG_RING] + p[pc + PG_HEAD]] = s;
+
+		if (++p[pc + PG_HEAD] == p[pc + PG_DELAY])
+			p[pc + PG_HEAD] = 0;
+
+		pc += p[pc + PG_NEXT];
+	}
+}
+
+//========================
+//Engine Binary Steps
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How many steps since construction ran the binary kernel.
+//Returns:
+//	long	-	the step count
+//========================
+long		Engine::getBinarySteps()
+{
+	return binarySteps;
+}
+
+//========================
+//Engine Thread Count
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How many threads share each step.
+//Returns:
+//	int	-	the thread count
+//========================
+int			Engine::cntThreads()
+{
+	return nThreads;
+}
+
+//========================
+//Engine Run
+//========================
+//Parameters:
+//	Vector	*v		-	the vector whose PadStates drive and record the run
+//	int		tEnd	-	the last time increment to simulate
+//Summary:
+//	The compiled counterpart of Circuit::run: for each time 0 through tEnd,
+//		drives the input pads from their iPadStates, steps, and records
+//		the output pads in their oPadStates. PadStates are matched to
+//		netlist pads by name.
+//Returns:
+//	n/a
+//========================
+void		Engine::run(Vector *v, int tEnd) throw (BasicException)
+{
+	if (v == NULL)
+		throw NullPointerException();
+
+	if (tEnd < 1)
+		throw BasicException("Time to run is zero or negative. INVALID!");
+
+	vector<int>			iIdx;
+	vector<PadState*>	iPS;
+	vector<int>			oIdx;
+	vector<PadState*>	oPS;
+
+	net->matchPads(v, iIdx, iPS, oIdx, oPS);
+
+	reset();
+
+	for (int ct = 0; ct < tEnd + 1; ct++)
+	{
+		for (int ip = 0; ip < iPS.size(); ip++)
+			setInput(iIdx[ip], (iPS[ip]->cntStates() == 0) ? indet : iPS[ip]->getState(ct));
+
+		step();
+
+		for (int op = 0; op < oPS.size(); op++)
+			oPS[op]->addState(getOutput(oIdx[op]), ct);
+	}
+}
+
+//========================
+//Engine Run Span
+//========================
+//Parameters:
+//	unsigned char	*in		-	input pad states, cntiPads() per time, from time 0
+//	unsigned char	*out	-	output pad states, cntoPads() per time, from time 0
+//	int				from	-	the time to start from a reset circuit
+//	int				keep	-	the first time to record
+//	int				to		-	the last time to simulate
+//Summary:
+//	Resets, then steps from time from through to, driving every input
+//		pad from in and recording every output pad into out from time
+//		keep on. Starting later than 0 treats the circuit as all X at
+//		from; for a circuit without feedback, outputs are exact once
+//		from + getPathDelay() has passed. in is only read, and only the
+//		out rows keep through to are written, so Engines on different
+//		threads may share both as long as their spans do not overlap.
+//Returns:
+//	n/a
+//========================
+void		Engine::runSpan(unsigned char *in, unsigned char *out, int from, int keep, int to)
+{
+	int nI = net->cntiPads();
+	int nO = net->cntoPads();
+
+	reset();
+
+	for (int ct = from; ct <= to; ct++)
+	{
+		for (int ip = 0; ip < nI; ip++)
+			setInput(ip, (state) in[(long) ct * nI + ip]);
+
+		step();
+
+		if (ct >= keep)
+		{
+			for (int op = 0; op < nO; op++)
+				out[(long) ct * nO + op] = getOutput(op);
+		}
+	}
+}
@@ -0,0 +1,107 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+//================================================================
+//Filename:		Compiled Simulation Engine Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of the Engine, which
+//					simulates a Netlist from a flat program and a
+//					byte-per-wire state array instead of walking the
+//					Gate objects.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+
+using namespace std;
+
+//==================================
+//Class:	Engine
+//Parent:	n/a
+//==================================
+//Description:
+//	The Engine compiles a Netlist into one array of integers (per gate:
+//		kind, output wire, delay ring offset, input count, input wires,
+//		plus truth table and skew ring details for gLUT gates)
+//		and steps it one nanosecond at a time. Each gate keeps a ring of
+//		its last delay results; a step first drives every gate's output
+//		with the result from delay steps ago, then evaluates every gate
+//		on the new wire states. Because every delay is at least 1ns, no
+//		gate's evaluation depends on another's in the same step, which
+//		is what lets the program run front to back in netlist order.
+//		The program follows the netlist's gate order, so reordering the
+//		netlist before compiling changes the memory access pattern only,
+//		never the results. While no X is anywhere in the circuit the
+//		Engine evaluates with plain boolean operations; see step().
+//		Given more than one thread, the gates are split into contiguous
+//		chunks, one per thread, and each half of a step runs on all
+//		chunks at once between barriers. See the constructor.
+//==================================
+class Engine
+{
+public:
+				Engine(Netlist *n, int nt = 1) throw (NullPointerException, BasicException);
+
+				~Engine();
+
+	void		reset();
+	void		setInput(int p, state s);
+	state		getOutput(int p);
+	void		step();
+	long		getBinarySteps();
+	int			cntThreads();
+
+	void		run(Vector *v, int tEnd) throw (BasicException);
+	void		runSpan(unsigned char *in, unsigned char *out, int from, int keep, int to);
+
+private:
+
+	void		driveChunk(int c);
+	bool		ternaryChunk(int c);
+	void		binaryChunk(int c);
+	void		work(int c);
+	void		release();
+
+static void*	worker(void *arg);
+
+	Netlist*				net;
+	bool					binary;
+	int						clean;
+	int						settle;
+	long					binarySteps;
+	unsigned char			pairTable[gLUT * 9];
+
+	vector<int>*			prog;
+	vector<unsigned char>*	wires;
+	vector<unsigned char>*	rings;
+	vector<unsigned char>*	tables;
+	vector<unsigned char>*	skews;
+
+	int*					p;		// the above, cache line aligned.
+	unsigned char*			w;
+	unsigned char*			r;
+	unsigned char*			tb;
+	unsigned char*			sr;
+
+	int						nThreads;
+	vector<int>*			chunkGate;
+	vector<int>*			chunkPC;
+	vector<int>*			chunkX;
+	pthread_t*				threads;
+	pthread_barrier_t		barrier;
+	pthread_mutex_t			gate;	// held while the workers are started.
+	volatile bool			quit;
+	int						seat;
+};
+
+#endif //ENGINE_H
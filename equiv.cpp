@@ -0,0 +1,1064 @@
+//================================================================
+//Filename:		Equivalence Checker Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for Equiv: the random and
+//					counterexample simulation, the Tseitin encoding
+//					of the gates, and the sweep that merges wires
+//					proved the same.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <map>
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "truthTable.h"
+#include "stimulus.h"
+#include "sat.h"
+#include "equiv.h"
+
+using namespace std;
+
+// What defines a Sat variable not yet loaded.
+#define EQ_AND		0
+#define EQ_XOR		1
+#define EQ_LUT		2
+
+//========================
+//Equiv Constructor
+//========================
+//Parameters:
+//	Netlist				*a		-	the first circuit, without feedback
+//	Netlist				*b		-	the second, likewise
+//	unsigned long long	seed	-	seed for the random patterns
+//	long				limit	-	conflicts allowed per internal check
+//Summary:
+//	Matches the pads by ID, gives each input a Sat variable and random
+//		words, and orders both circuits' gates. Both netlists must
+//		outlive the Equiv. Nodes are the first circuit's wires, then the
+//		second's, then constant 0.
+//========================
+Equiv::Equiv(Netlist *a, Netlist *b, unsigned long long seed, long limit) throw (NullPointerException, BasicException)
+{
+	if ((a == NULL) || (b == NULL))
+		throw NullPointerException();
+
+	if ((a->getPathDelay() < 0) || (b->getPathDelay() < 0))
+		throw BasicException("Equivalence checking needs circuits without feedback.");
+
+	net[0] = a;
+	net[1] = b;
+	this->limit = limit;
+
+	for (int side = 0; side < 2; side++)
+	{
+		vector<bool> isIn(net[side]->cntWires(), false);
+
+		for (int ip = 0; ip < net[side]->cntiPads(); ip++)
+			isIn[net[side]->getiPadWire(ip)] = true;
+
+		for (int g = 0; g < net[side]->cntGates(); g++)
+		{
+			for (int k = 0; k < net[side]->cntInputs(g); k++)
+			{
+				int w = net[side]->getInput(g, k);
+
+				if ((net[side]->getDriver(w) < 0) && !isIn[w])
+					throw BasicException("Equivalence checking found a wire nothing drives.");
+			}
+		}
+
+		for (int op = 0; op < net[side]->cntoPads(); op++)
+		{
+			int w = net[side]->getoPadWire(op);
+
+			if ((net[side]->getDriver(w) < 0) && !isIn[w])
+				throw BasicException("Equivalence checking found a wire nothing drives.");
+		}
+	}
+
+	sat = new Sat();
+	defKind = new vector<int>();
+	defIn = new vector< vector<int> >();
+	defLUT = new vector<pair<int, int> >();
+	strash = new map<vector<int>, int>();
+	repl = new vector<int>();
+	swept = new vector<bool>();
+	names = new vector<string>();
+	nameVar = new vector<int>();
+
+	for (int side = 0; side < 2; side++)
+	{
+		padName[side] = new vector<int>();
+
+		for (int ip = 0; ip < net[side]->cntiPads(); ip++)
+		{
+			string	id = net[side]->getiPadID(ip);
+			int		k = find(names->begin(), names->end(), id) - names->begin();
+
+			if (k == names->size())
+			{
+				names->push_back(id);
+				nameVar->push_back(fresh());
+			}
+
+			padName[side]->push_back(k);
+		}
+	}
+
+	pairs[0] = new vector<int>();
+	pairs[1] = new vector<int>();
+
+	for (int op = 0; op < a->cntoPads(); op++)
+	{
+		for (int op2 = 0; op2 < b->cntoPads(); op2++)
+		{
+			if (b->getoPadID(op2) == a->getoPadID(op))
+			{
+				pairs[0]->push_back(op);
+				pairs[1]->push_back(op2);
+				break;
+			}
+		}
+	}
+
+	order = new vector<pair<int, int> >();
+
+	for (int side = 0; side < 2; side++)
+	{
+		vector<pair<int, int> > lv;
+
+		for (int g = 0; g < net[side]->cntGates(); g++)
+			lv.push_back(make_pair(net[side]->getLevel(g), g));
+
+		sort(lv.begin(), lv.end());
+
+		for (int k = 0; k < lv.size(); k++)
+			order->push_back(make_pair(side, lv[k].second));
+	}
+
+	int nodes = a->cntWires() + b->cntWires() + 1;
+	int one = fresh();
+	vector<int> unit(1, 2 * one);
+
+	sat->addClause(unit);
+
+	lit = new vector<int>(nodes, -1);
+	(*lit)[nodes - 1] = 2 * one + 1;
+	sim = new vector< vector<lanes> >(nodes);
+	inSim = new vector< vector<lanes> >(names->size());
+	members = new map<vector<lanes>, vector<int> >();
+	nWords = EQ_WORDS;
+	nPending = 0;
+
+	Xoshiro rng(seed);
+
+	for (int k = 0; k < names->size(); k++)
+	{
+		for (int w = 0; w < nWords; w++)
+			(*inSim)[k].push_back(rng.next());
+	}
+
+	same = new vector<bool>(pairs[0]->size(), false);
+	cex = new vector< vector<unsigned char> >(pairs[0]->size());
+
+	nChecked = 0;
+	nProved = 0;
+	nRefuted = 0;
+	nGaveUp = 0;
+}
+
+//========================
+//Equiv Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the Sat and the simulation.
+//========================
+Equiv::~Equiv()
+{
+	delete sat;
+	delete defKind;
+	delete defIn;
+	delete defLUT;
+	delete strash;
+	delete repl;
+	delete swept;
+	delete names;
+	delete nameVar;
+	delete padName[0];
+	delete padName[1];
+	delete order;
+	delete lit;
+	delete sim;
+	delete inSim;
+	delete members;
+	delete pairs[0];
+	delete pairs[1];
+	delete same;
+	delete cex;
+}
+
+//========================
+//Equiv Accessors
+//========================
+//Parameters:
+//	int	k		-	an input, or a compared output pair
+//	int	side	-	0 for the first circuit, 1 for the second
+//Summary:
+//	The inputs of both circuits, the output pads compared (by their pad
+//		number in either circuit), and after run(), whether each pair is
+//		the same and how many are not.
+//Returns:
+//	varies	-	as named
+//========================
+int			Equiv::cntNames()
+{
+	return names->size();
+}
+
+string		Equiv::getName(int k)
+{
+	return (*names)[k];
+}
+
+int			Equiv::cntPairs()
+{
+	return pairs[0]->size();
+}
+
+int			Equiv::getPair(int k, int side)
+{
+	return (*pairs[side])[k];
+}
+
+bool		Equiv::isSame(int k)
+{
+	return (*same)[k];
+}
+
+int			Equiv::cntDiffer()
+{
+	return count(same->begin(), same->end(), false);
+}
+
+//========================
+//Equiv Statistics
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Patterns simulated, internal checks given to the Sat and how they
+//		came out (proved, refuted by a new pattern, or given up at the
+//		limit), and the Sat's conflicts and variables.
+//Returns:
+//	int or long	-	the count
+//========================
+long		Equiv::cntPatterns()
+{
+	return (long) (nWords - ((nPending > 0) ? 1 : 0)) * 64 + nPending;
+}
+
+int			Equiv::cntChecked()
+{
+	return nChecked;
+}
+
+int			Equiv::cntProved()
+{
+	return nProved;
+}
+
+int			Equiv::cntRefuted()
+{
+	return nRefuted;
+}
+
+int			Equiv::cntGaveUp()
+{
+	return nGaveUp;
+}
+
+long		Equiv::cntConflicts()
+{
+	return sat->cntConflicts();
+}
+
+int			Equiv::cntVars()
+{
+	return sat->cntVars();
+}
+
+//========================
+//Equiv Node
+//========================
+//Parameters:
+//	int	side	-	0 for the first circuit, 1 for the second
+//	int	w		-	a wire of that circuit
+//Summary:
+//	The wire's node.
+//Returns:
+//	int	-	the node
+//========================
+int			Equiv::node(int side, int w)
+{
+	return (side == 0) ? w : net[0]->cntWires() + w;
+}
+
+//========================
+//Equiv Run
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Simulates the random words, sweeps the gates in order merging each
+//		into an earlier wire the Sat proves it equal to, then decides
+//		each output pair.
+//Returns:
+//	n/a
+//========================
+void		Equiv::run()
+{
+	for (int side = 0; side < 2; side++)
+	{
+		for (int ip = 0; ip < net[side]->cntiPads(); ip++)
+			(*lit)[node(side, net[side]->getiPadWire(ip))] = 2 * (*nameVar)[(*padName[side])[ip]];
+	}
+
+	for (int w = 0; w < nWords; w++)
+		simulate(w);
+
+	classes(0);
+
+	vector<lanes>	k;
+	long			quick = ((limit >= 0) && (limit < EQ_QUICK)) ? limit : EQ_QUICK;
+
+	for (int pos = 0; pos < order->size(); pos++)
+	{
+		int side = (*order)[pos].first;
+		int g = (*order)[pos].second;
+		int n = node(side, net[side]->getOutput(g));
+
+		int f = define(side, g);
+
+		(*lit)[n] = f;
+
+		while (!(*swept)[f >> 1])
+		{
+			key(n, k);
+
+			vector<int>	mem((*members)[k]);
+			int			res = SAT_UNKNOWN;
+
+			for (int i = mem.size() - 1; (i >= 0) && (i + EQ_TRIES >= mem.size()) && (res == SAT_UNKNOWN); i--)
+				res = check(n, mem[i], quick, pos);
+
+			if ((res == SAT_UNKNOWN) && !mem.empty() && (quick != limit))
+				res = check(n, mem[0], limit, pos);
+
+			if ((res == SAT_UNKNOWN) && !mem.empty())
+				nGaveUp++;
+
+			if (res != SAT_TRUE)
+			{
+				join(n, k);
+				break;
+			}
+		}
+
+		(*swept)[f >> 1] = true;
+	}
+
+	for (int p = 0; p < cntPairs(); p++)
+	{
+		int a = node(0, net[0]->getoPadWire((*pairs[0])[p]));
+		int b = node(1, net[1]->getoPadWire((*pairs[1])[p]));
+
+		(*same)[p] = ((*lit)[a] == (*lit)[b]);
+
+		for (int w = 0; !(*same)[p] && (w < nWords) && (*cex)[p].empty(); w++)
+		{
+			lanes d = (*sim)[a][w] ^ (*sim)[b][w];
+
+			if (d == 0)
+				continue;
+
+			int bit = 0;
+
+			while (((d >> bit) & 1) == 0)
+				bit++;
+
+			for (int i = 0; i < names->size(); i++)
+				(*cex)[p].push_back(((*inSim)[i][w] >> bit) & 1);
+		}
+
+		if ((*same)[p] || !(*cex)[p].empty())
+			continue;
+
+		vector<unsigned char> pat;
+
+		if (differ((*lit)[a], (*lit)[b], pat, -1) == SAT_FALSE)
+			(*same)[p] = true;
+		else
+		{
+			(*cex)[p] = pat;
+			learn(pat);
+		}
+	}
+}
+
+//========================
+//Equiv Fresh
+//========================
+//Parameters:
+//	none
+//Summary:
+//	A new Sat variable, with nothing yet defining it.
+//Returns:
+//	int	-	the variable
+//========================
+int			Equiv::fresh()
+{
+	defKind->push_back(-1);
+	defIn->push_back(vector<int>());
+	defLUT->push_back(make_pair(-1, -1));
+	repl->push_back(-1);
+	swept->push_back(false);
+
+	return sat->newVar();
+}
+
+//========================
+//Equiv Check
+//========================
+//Parameters:
+//	int		n	-	the node being swept
+//	int		r	-	an earlier node of its class
+//	long	lim	-	conflicts allowed, or -1
+//	int		pos	-	n's gate's place in the order
+//Summary:
+//	Asks whether n is r, or r's opposite if their first patterns
+//		differ. If so, n takes r's literal from then on; if not, the
+//		setting that tells them apart is simulated and the classes are
+//		rebuilt.
+//Returns:
+//	int	-	SAT_FALSE if merged, SAT_TRUE if refuted, SAT_UNKNOWN past the
+//				limit
+//========================
+int			Equiv::check(int n, int r, long lim, int pos)
+{
+	int f = (*lit)[n];
+	int b = (*lit)[r] ^ (int) (((*sim)[n][0] ^ (*sim)[r][0]) & 1);
+
+	if (b == f)
+		return SAT_FALSE;
+
+	vector<unsigned char> pat;
+
+	nChecked++;
+
+	int res = differ(f, b, pat, lim);
+
+	if (res == SAT_FALSE)
+	{
+		(*repl)[f >> 1] = b ^ (f & 1);
+		(*lit)[n] = b;
+		nProved++;
+	}
+	else if (res == SAT_TRUE)
+	{
+		nRefuted++;
+		learn(pat);
+		classes(pos);
+	}
+
+	return res;
+}
+
+//========================
+//Equiv Define
+//========================
+//Parameters:
+//	int	side	-	0 for the first circuit, 1 for the second
+//	int	g		-	a gate whose inputs have literals
+//Summary:
+//	Gives g's output a literal. AND is shared(); OR is the negation of
+//		the AND of its inputs' negations; XOR is the shared XOR of its
+//		inputs' variables, negated if an odd number of them were
+//		negated; a gLUT gets a variable of its own. NOT, NAND, NOR and
+//		XNOR negate the literal of the function they invert. No clause is
+//		added until load() needs the gate.
+//Returns:
+//	int	-	g's output literal
+//========================
+int			Equiv::define(int side, int g)
+{
+	Netlist*	n = net[side];
+	gateType	type = n->getType(g);
+	vector<int>	in;
+
+	for (int k = 0; k < n->cntInputs(g); k++)
+		in.push_back((*lit)[node(side, n->getInput(g, k))]);
+
+	if (type == gLUT)
+	{
+		int v = fresh();
+
+		(*defKind)[v] = EQ_LUT;
+		(*defIn)[v] = in;
+		(*defLUT)[v] = make_pair(side, g);
+
+		return 2 * v;
+	}
+
+	int f;
+
+	if ((type == gAND) || (type == gNAND))
+		f = shared(EQ_AND, in);
+	else if ((type == gOR) || (type == gNOR))
+	{
+		for (int k = 0; k < in.size(); k++)
+			in[k] ^= 1;
+
+		f = shared(EQ_AND, in) ^ 1;
+	}
+	else
+	{
+		int odd = 0;
+
+		for (int k = 0; k < in.size(); k++)
+		{
+			odd ^= in[k] & 1;
+			in[k] &= ~1;
+		}
+
+		f = shared(EQ_XOR, in) ^ odd;
+	}
+
+	if ((type == gNOT) || (type == gNAND) || (type == gNOR) || (type == gXNOR))
+		f ^= 1;
+
+	return f;
+}
+
+//========================
+//Equiv Shared
+//========================
+//Parameters:
+//	int			kind	-	EQ_AND or EQ_XOR
+//	vector<int>	&in		-	the literals, in any order; XOR's not negated
+//Summary:
+//	A literal for the AND or XOR of in, the same literal for the same
+//		inputs however often it is asked for (or the literal it has since
+//		been proved equal to). Repeated inputs are dropped
+//		from an AND and cancel in pairs from an XOR; an AND of a literal
+//		and its negation, or an empty XOR, is constant 0, and one input is
+//		its own literal.
+//Returns:
+//	int	-	the literal
+//========================
+int			Equiv::shared(int kind, vector<int> &in)
+{
+	int			zero = (*lit)[sim->size() - 1];
+	vector<int>	c;
+
+	sort(in.begin(), in.end());
+
+	for (int k = 0; k < in.size(); k++)
+	{
+		if ((kind == EQ_XOR) && !c.empty() && (c.back() == in[k]))
+			c.pop_back();
+		else if ((kind == EQ_AND) && !c.empty() && (c.back() == in[k]))
+			continue;
+		else if ((kind == EQ_AND) && !c.empty() && (c.back() == (in[k] ^ 1)))
+			return zero;
+		else
+			c.push_back(in[k]);
+	}
+
+	if (c.empty())
+		return zero;
+
+	if (c.size() == 1)
+		return c[0];
+
+	c.push_back(kind);
+
+	map<vector<int>, int>::iterator it = strash->find(c);
+
+	if (it != strash->end())
+	{
+		int f = it->second;
+
+		while ((*repl)[f >> 1] >= 0)
+			f = (*repl)[f >> 1] ^ (f & 1);
+
+		return f;
+	}
+
+	int v = fresh();
+
+	c.pop_back();
+	(*defKind)[v] = kind;
+	(*defIn)[v] = c;
+	c.push_back(kind);
+	(*strash)[c] = 2 * v;
+
+	return 2 * v;
+}
+
+//========================
+//Equiv Load
+//========================
+//Parameters:
+//	int	f	-	a literal
+//Summary:
+//	Adds the clauses defining f's variable, after those of its inputs,
+//		unless they are in already. So the Sat holds only the gates some
+//		question has needed. An AND's variable implies each input and all
+//		of them imply it; an XOR is a chain of two input XORs, four
+//		clauses each; a gLUT has one clause per binary row, forcing the
+//		output where its inputs match the row.
+//Returns:
+//	n/a
+//========================
+void		Equiv::load(int f)
+{
+	int v = f >> 1;
+	int kind = (*defKind)[v];
+
+	if (kind < 0)
+		return;
+
+	(*defKind)[v] = -1;
+
+	vector<int>	in((*defIn)[v]);
+	int			y = 2 * v;
+
+	for (int k = 0; k < in.size(); k++)
+		load(in[k]);
+
+	if (kind == EQ_AND)
+	{
+		vector<int>	big(1, y);
+		vector<int>	c(2);
+
+		for (int k = 0; k < in.size(); k++)
+		{
+			c[0] = y ^ 1;
+			c[1] = in[k];
+			sat->addClause(c);
+			big.push_back(in[k] ^ 1);
+		}
+
+		sat->addClause(big);
+	}
+	else if (kind == EQ_XOR)
+	{
+		int acc = in[0];
+
+		for (int k = 1; k < in.size(); k++)
+		{
+			int			t = (k + 1 == in.size()) ? y : 2 * fresh();
+			vector<int>	c(3);
+
+			c[0] = t ^ 1; c[1] = acc;     c[2] = in[k];     sat->addClause(c);
+			c[0] = t ^ 1; c[1] = acc ^ 1; c[2] = in[k] ^ 1; sat->addClause(c);
+			c[0] = t;     c[1] = acc ^ 1; c[2] = in[k];     sat->addClause(c);
+			c[0] = t;     c[1] = acc;     c[2] = in[k] ^ 1; sat->addClause(c);
+			acc = t;
+		}
+	}
+	else
+	{
+		Netlist*	n = net[(*defLUT)[v].first];
+		int			g = (*defLUT)[v].second;
+
+		for (int row = 0; row < (1 << in.size()); row++)
+		{
+			vector<int>	c;
+			int			idx = 0;
+
+			for (int k = 0, step = 1; k < in.size(); k++, step *= 3)
+			{
+				if ((row >> k) & 1)
+				{
+					c.push_back(in[k] ^ 1);
+					idx += step;
+				}
+				else
+					c.push_back(in[k]);
+			}
+
+			c.push_back((n->getLUT(g, idx) == high) ? y : y ^ 1);
+			sat->addClause(c);
+		}
+	}
+}
+
+//========================
+//Equiv Simulate
+//========================
+//Parameters:
+//	int	word	-	the word to (re)compute, up to one past the last
+//Summary:
+//	Evaluates every node's word from the inputs' words, 64 patterns at
+//		once: gates fold their inputs' words and invert, and a gLUT ORs
+//		together the rows it sets high, each the AND of its inputs' words
+//		or their complements.
+//Returns:
+//	n/a
+//========================
+void		Equiv::simulate(int word)
+{
+	int nodes = sim->size();
+
+	for (int n = 0; n < nodes; n++)
+	{
+		if ((*sim)[n].size() <= word)
+			(*sim)[n].resize(word + 1, 0);
+	}
+
+	for (int side = 0; side < 2; side++)
+	{
+		for (int ip = 0; ip < net[side]->cntiPads(); ip++)
+			(*sim)[node(side, net[side]->getiPadWire(ip))][word] = (*inSim)[(*padName[side])[ip]][word];
+	}
+
+	for (int pos = 0; pos < order->size(); pos++)
+	{
+		int			side = (*order)[pos].first;
+		int			g = (*order)[pos].second;
+		Netlist*	n = net[side];
+		gateType	type = n->getType(g);
+		int			nin = n->cntInputs(g);
+		lanes		v;
+
+		if (type == gLUT)
+		{
+			v = 0;
+
+			for (int row = 0; row < (1 << nin); row++)
+			{
+				int		idx = 0;
+				lanes	m = ~0ULL;
+
+				for (int k = 0, step = 1; k < nin; k++, step *= 3)
+				{
+					lanes x = (*sim)[node(side, n->getInput(g, k))][word];
+
+					if ((row >> k) & 1)
+					{
+						m &= x;
+						idx += step;
+					}
+					else
+						m &= ~x;
+				}
+
+				if (n->getLUT(g, idx) == high)
+					v |= m;
+			}
+		}
+		else
+		{
+			v = (*sim)[node(side, n->getInput(g, 0))][word];
+
+			for (int k = 1; k < nin; k++)
+			{
+				lanes x = (*sim)[node(side, n->getInput(g, k))][word];
+
+				if ((type == gAND) || (type == gNAND))
+					v &= x;
+				else if ((type == gOR) || (type == gNOR))
+					v |= x;
+				else
+					v ^= x;
+			}
+
+			if ((type == gNOT) || (type == gNAND) || (type == gNOR) || (type == gXNOR))
+				v = ~v;
+		}
+
+		(*sim)[node(side, n->getOutput(g))][word] = v;
+	}
+}
+
+//========================
+//Equiv Key
+//========================
+//Parameters:
+//	int				n	-	a node
+//	vector<lanes>	&k	-	receives its class key
+//Summary:
+//	A node's words, complemented if its first pattern is 1, so a wire
+//		and its opposite share a key.
+//Returns:
+//	n/a
+//========================
+void		Equiv::key(int n, vector<lanes> &k)
+{
+	k = (*sim)[n];
+
+	if (k[0] & 1)
+	{
+		for (int w = 0; w < k.size(); w++)
+			k[w] = ~k[w];
+	}
+}
+
+//========================
+//Equiv Classes
+//========================
+//Parameters:
+//	int	upto	-	gates swept so far, in order
+//Summary:
+//	Rebuilds the classes from the current words: constant 0, the input
+//		pads, then the swept gates, each joining the class of its key.
+//Returns:
+//	n/a
+//========================
+void		Equiv::classes(int upto)
+{
+	vector<lanes> k;
+
+	members->clear();
+	key(sim->size() - 1, k);
+	join(sim->size() - 1, k);
+
+	for (int side = 0; side < 2; side++)
+	{
+		for (int ip = 0; ip < net[side]->cntiPads(); ip++)
+		{
+			int n = node(side, net[side]->getiPadWire(ip));
+
+			key(n, k);
+			join(n, k);
+		}
+	}
+
+	for (int pos = 0; pos < upto; pos++)
+	{
+		int side = (*order)[pos].first;
+		int n = node(side, net[side]->getOutput((*order)[pos].second));
+
+		key(n, k);
+		join(n, k);
+	}
+}
+
+//========================
+//Equiv Join
+//========================
+//Parameters:
+//	int				n	-	a node
+//	vector<lanes>	&k	-	its key
+//Summary:
+//	Adds n to the end of its class, unless a node already there carries
+//		the same variable, as a merged node or a shared gate does.
+//Returns:
+//	n/a
+//========================
+void		Equiv::join(int n, vector<lanes> &k)
+{
+	vector<int>& mem = (*members)[k];
+
+	for (int i = 0; i < mem.size(); i++)
+	{
+		if (((*lit)[mem[i]] >> 1) == ((*lit)[n] >> 1))
+			return;
+	}
+
+	mem.push_back(n);
+}
+
+//========================
+//Equiv Differ
+//========================
+//Parameters:
+//	int						a	-	a literal
+//	int						b	-	another
+//	vector<unsigned char>	&pat	-	receives, per input, a setting where
+//										they differ
+//	long					lim	-	conflicts allowed, or -1
+//Summary:
+//	Asks the Sat for a setting where a and b differ, through a fresh
+//		variable that switches the question's two clauses on for this
+//		call; it is switched off for good after. When they cannot
+//		differ, a and b are also tied together for later questions.
+//Returns:
+//	int	-	SAT_TRUE with pat set, SAT_FALSE, or SAT_UNKNOWN
+//========================
+int			Equiv::differ(int a, int b, vector<unsigned char> &pat, long lim)
+{
+	int			m = 2 * fresh();
+	vector<int>	c(3);
+	vector<int>	assume(1, m);
+
+	load(a);
+	load(b);
+	c[0] = m ^ 1; c[1] = a;     c[2] = b;     sat->addClause(c);
+	c[0] = m ^ 1; c[1] = a ^ 1; c[2] = b ^ 1; sat->addClause(c);
+	focus(a, EQ_FOCUS);
+	focus(b, EQ_FOCUS);
+
+	int res = sat->solve(assume, lim);
+
+	if (res == SAT_TRUE)
+	{
+		pat.clear();
+
+		for (int k = 0; k < names->size(); k++)
+			pat.push_back(sat->getValue((*nameVar)[k]) ? 1 : 0);
+	}
+
+	c.resize(1);
+	c[0] = m ^ 1;
+	sat->addClause(c);
+
+	if (res == SAT_FALSE)
+	{
+		c.resize(2);
+		c[0] = a ^ 1; c[1] = b;     sat->addClause(c);
+		c[0] = a;     c[1] = b ^ 1; sat->addClause(c);
+	}
+
+	return res;
+}
+
+//========================
+//Equiv Focus
+//========================
+//Parameters:
+//	int	f		-	a literal
+//	int	depth	-	how many gates back from it to go
+//Summary:
+//	Has the Sat decide f's variable first, and before it those of the
+//		gates feeding it, depth gates back. A question about two wires
+//		is usually settled by the few gates just behind them; left to
+//		itself, the Sat may branch on the inputs first and search the
+//		whole cone.
+//Returns:
+//	n/a
+//========================
+void		Equiv::focus(int f, int depth)
+{
+	if (depth > 0)
+	{
+		vector<int>& in = (*defIn)[f >> 1];
+
+		for (int k = 0; k < in.size(); k++)
+			focus(in[k], depth - 1);
+	}
+
+	sat->prefer(f >> 1);
+}
+
+//========================
+//Equiv Learn
+//========================
+//Parameters:
+//	vector<unsigned char>	&pat	-	per input, a setting
+//Summary:
+//	Adds a pattern to the last word and simulates it again. A new word
+//		starts as 64 copies of its first pattern, so its unused bits
+//		repeat a real pattern and no class is split by them.
+//Returns:
+//	n/a
+//========================
+void		Equiv::learn(vector<unsigned char> &pat)
+{
+	if ((nPending == 0) || (nPending == 64))
+	{
+		for (int k = 0; k < names->size(); k++)
+			(*inSim)[k].push_back(pat[k] ? ~0ULL : 0);
+
+		nWords++;
+		nPending = 1;
+	}
+	else
+	{
+		for (int k = 0; k < names->size(); k++)
+		{
+			lanes bit = 1ULL << nPending;
+
+			if (pat[k])
+				(*inSim)[k].back() |= bit;
+			else
+				(*inSim)[k].back() &= ~bit;
+		}
+
+		nPending++;
+	}
+
+	simulate(nWords - 1);
+}
+
+//========================
+//Equiv Counterexample
+//========================
+//Parameters:
+//	int				k	-	a compared output pair found different
+//	vector<state>	&in	-	receives, per input, its state
+//Summary:
+//	An input setting where the pair's outputs differ.
+//Returns:
+//	n/a
+//========================
+void		Equiv::getCex(int k, vector<state> &in)
+{
+	in.clear();
+
+	for (int i = 0; i < (*cex)[k].size(); i++)
+		in.push_back((*cex)[k][i] ? high : low);
+}
+
+//========================
+//Equiv Write
+//========================
+//Parameters:
+//	ostream	&out	-	where to write
+//	string	name	-	the vector's name
+//	int		side	-	0 for the first circuit's pads, 1 for the second's
+//Summary:
+//	Writes the pairs' counterexamples as a vector file for one circuit,
+//		one pattern for each pair found different, each held long enough
+//		for both circuits to settle. Only changes are written after the
+//		first.
+//Returns:
+//	n/a
+//========================
+void		Equiv::write(ostream &out, string name, int side)
+{
+	int hold = max(net[0]->getPathDelay(), net[1]->getPathDelay()) + 1;
+	int t = 0;
+	int last = -1;
+
+	out << "VECTOR " << name << endl;
+
+	for (int p = 0; p < cntPairs(); p++)
+	{
+		if ((*same)[p])
+			continue;
+
+		for (int ip = 0; ip < net[side]->cntiPads(); ip++)
+		{
+			int k = (*padName[side])[ip];
+
+			if ((last < 0) || ((*cex)[p][k] != (*cex)[last][k]))
+				out << "INPUT\t" << (*names)[k] << "\t" << t * hold << "\t" << (int) (*cex)[p][k] << endl;
+		}
+
+		last = p;
+		t++;
+	}
+}
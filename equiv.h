@@ -0,0 +1,153 @@
+#ifndef EQUIV_H
+#define EQUIV_H
+
+//================================================================
+//Filename:		Equivalence Checker Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of Equiv, which proves two
+//					circuits without feedback compute the same outputs
+//					or finds input settings where they do not.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <map>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "truthTable.h"
+#include "sat.h"
+
+using namespace std;
+
+// Conflicts allowed proving one pair of internal wires the same.
+#define EQ_CONFLICTS	100
+
+// A wire is first tried, EQ_QUICK conflicts each, against the latest
+// EQ_TRIES wires of its class, then against the earliest with the full
+// limit.
+#define EQ_QUICK		10
+#define EQ_TRIES		4
+
+// Gates back from the two wires of a question whose variables the Sat
+// decides first.
+#define EQ_FOCUS		3
+
+// Words of 64 random patterns simulated before any proving.
+#define EQ_WORDS		8
+
+//==================================
+//Class:	Equiv
+//Parent:	n/a
+//==================================
+//Description:
+//	Equiv checks two circuits without feedback against each other. Input
+//		pads with the same ID are the same input, and output pads with the
+//		same ID are compared; a pad in only one circuit is a free input
+//		there, or an output with nothing to compare.
+//		Both circuits are first simulated 64 patterns to a word on random
+//		inputs. Wires whose patterns match, or are opposite, in every
+//		word may well be the same function, and are put in one class.
+//		Then the gates of the first circuit and of the second are taken
+//		in level order and given literals for a Sat: ANDs and XORs of
+//		the same literals share a variable (OR, NOT, NAND, NOR and XNOR
+//		being negations around them), and a gate's Tseitin clauses are
+//		only added once a question reaches it. A gate whose class holds
+//		earlier wires is checked against them by asking the Sat for a
+//		setting where the two differ, first briefly against the latest
+//		few, then in full against the earliest: if there is none, the
+//		gate's output takes the earlier wire's literal, so the gates
+//		after it are built on the merged circuit and the later questions
+//		stay small; if there is one, it is simulated as a new pattern,
+//		which splits the class, and the gate is checked against what it
+//		then matches. A question that runs past its conflict limit
+//		leaves the gate as it is.
+//		Output pairs whose literals end up the same are equivalent. Any
+//		other pair is different if some simulated pattern tells them
+//		apart, and is otherwise given to the Sat with no limit. Each
+//		pair found different keeps an input setting that shows it.
+//==================================
+class Equiv
+{
+public:
+				Equiv(Netlist *a, Netlist *b, unsigned long long seed = 1, long limit = EQ_CONFLICTS)
+					throw (NullPointerException, BasicException);
+
+				~Equiv();
+
+	void		run();
+
+	int			cntNames();
+	string		getName(int k);
+	int			cntPairs();
+	int			getPair(int k, int side);
+	bool		isSame(int k);
+	int			cntDiffer();
+	void		getCex(int k, vector<state> &in);
+	void		write(ostream &out, string name, int side);
+
+	long		cntPatterns();
+	int			cntChecked();
+	int			cntProved();
+	int			cntRefuted();
+	int			cntGaveUp();
+	long		cntConflicts();
+	int			cntVars();
+
+private:
+
+	int			node(int side, int w);
+	int			fresh();
+	int			define(int side, int g);
+	int			shared(int kind, vector<int> &in);
+	void		load(int f);
+	void		simulate(int word);
+	void		classes(int upto);
+	void		join(int n, vector<lanes> &k);
+	void		key(int n, vector<lanes> &k);
+	int			check(int n, int r, long lim, int pos);
+	int			differ(int a, int b, vector<unsigned char> &pat, long lim);
+	void		focus(int f, int depth);
+	void		learn(vector<unsigned char> &pat);
+
+	Netlist*				net[2];
+	Sat*					sat;
+	long					limit;
+	vector<int>*			defKind;	// per variable: what defines it, or -1 once
+										//   loaded or if nothing does.
+	vector< vector<int> >*	defIn;		// per variable: the literals it is defined on.
+	vector<pair<int, int> >* defLUT;	// per variable: the gLUT defining it.
+	map<vector<int>, int>*	strash;		// per AND or XOR of literals: its literal.
+	vector<int>*			repl;		// per variable: the literal it was merged
+										//   into, or -1.
+	vector<bool>*			swept;		// per variable: whether a wire carrying it
+										//   has been checked.
+
+	vector<string>*			names;		// the inputs of both circuits.
+	vector<int>*			nameVar;	// per input: its Sat variable.
+	vector<int>*			padName[2];	// per circuit, per input pad: its input.
+	vector<pair<int, int> >* order;		// gates of both, circuit then level order.
+	vector<int>*			lit;		// per node: its literal in the Sat.
+	vector< vector<lanes> >* sim;		// per node: its simulated words.
+	vector< vector<lanes> >* inSim;		// per input: its words.
+	int						nWords;
+	int						nPending;	// patterns in the last word, 0 if none.
+	map<vector<lanes>, vector<int> >* members;	// per class key: its nodes, earliest first.
+
+	vector<int>*			pairs[2];	// per compared output: its pad in each.
+	vector<bool>*			same;
+	vector< vector<unsigned char> >* cex;	// per pair found different: an input setting.
+
+	int						nChecked;
+	int						nProved;
+	int						nRefuted;
+	int						nGaveUp;
+};
+
+#endif //EQUIV_H
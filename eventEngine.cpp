@@ -0,0 +1,634 @@
+//================================================================
+//Filename:		Parallel Event Engine Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the EventEngine:
+//					partitioning a Netlist, finding its lookahead,
+//					and running it window by window on threads.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <iostream>
+#include <climits>
+#include <cstdio>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "eventEngine.h"
+
+using namespace std;
+
+// Ints between per-thread slots of chunkNext and chunkEvents, so that
+// each thread's slot sits on its own cache line.
+#define STRIDE		16
+
+//========================
+//Make Event
+//========================
+//Parameters:
+//	int		t	-	the event's time
+//	int		pin	-	the pin it sets
+//	int		s	-	the state it sets it to
+//Summary:
+//	Packs an event so that events sort by time.
+//Returns:
+//	event	-	the packed event
+//========================
+static inline event	mkEvent(int t, int pin, int s)
+{
+	return (((event) t) << 32) | (((event) pin) << 2) | s;
+}
+
+//========================
+//EventEngine Constructor
+//========================
+//Parameters:
+//	Netlist	*n	-	the netlist to simulate
+//	int		nt	-	how many threads, and so partitions
+//Summary:
+//	Numbers every gate input as a pin, lists each wire's fan-out pins,
+//		cuts the gates into nt partitions of about equal size in netlist
+//		order (so an order that keeps fan-ins near their gates, like dfs,
+//		also keeps most connections inside a partition), and finds the
+//		lookahead. The netlist must outlive the EventEngine and must not
+//		be changed while it is in use.
+//========================
+EventEngine::EventEngine(Netlist *n, int nt) throw (NullPointerException, BasicException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	if (nt < 1)
+		throw BasicException("Thread count must be at least 1.");
+
+	net = n;
+	nThreads = nt;
+	tStop = 0;
+	windows = 0;
+	seat = 0;
+	quit = false;
+
+	int nG = n->cntGates();
+	int nW = n->cntWires();
+
+	chunkGate = new vector<int>(nThreads + 1, nG);
+	gOwner = new vector<int>(nG, 0);
+
+	for (int c = 0; c < nThreads; c++)
+	{
+		(*chunkGate)[c] = (int) (((long) nG * c) / nThreads);
+
+		for (int g = (*chunkGate)[c]; g < (int) (((long) nG * (c + 1)) / nThreads); g++)
+			(*gOwner)[g] = c;
+	}
+
+	gPin = new vector<int>(nG + 1, 0);
+	pGate = new vector<int>();
+	pSkew = new vector<int>();
+
+	vector<int> pWire;
+
+	for (int g = 0; g < nG; g++)
+	{
+		(*gPin)[g] = pGate->size();
+
+		for (int k = 0; k < n->cntInputs(g); k++)
+		{
+			pGate->push_back(g);
+			pSkew->push_back(n->getSkew(g, k));
+			pWire.push_back(n->getInput(g, k));
+		}
+	}
+
+	(*gPin)[nG] = pGate->size();
+
+	wPinStart = new vector<int>(nW + 1, 0);
+	wPin = new vector<int>(pWire.size(), 0);
+
+	for (int pin = 0; pin < pWire.size(); pin++)
+		(*wPinStart)[pWire[pin] + 1]++;
+
+	for (int wr = 0; wr < nW; wr++)
+		(*wPinStart)[wr + 1] += (*wPinStart)[wr];
+
+	vector<int> fill(wPinStart->begin(), wPinStart->end() - 1);
+
+	for (int pin = 0; pin < pWire.size(); pin++)
+		(*wPin)[fill[pWire[pin]]++] = pin;
+
+	gPads = new vector<int>(nG, -1);
+	oPadNext = new vector<int>(n->cntoPads(), -1);
+
+	for (int op = n->cntoPads() - 1; op >= 0; op--)
+	{
+		int g = n->getDriver(n->getoPadWire(op));
+
+		if (g >= 0)
+		{
+			(*oPadNext)[op] = (*gPads)[g];
+			(*gPads)[g] = op;
+		}
+	}
+
+	lookahead = INT_MAX;
+
+	for (int pin = 0; pin < pWire.size(); pin++)
+	{
+		int g = n->getDriver(pWire[pin]);
+
+		if ((g >= 0) && ((*gOwner)[g] != (*gOwner)[(*pGate)[pin]]))
+		{
+			if (n->getDelay(g) + (*pSkew)[pin] < lookahead)
+				lookahead = n->getDelay(g) + (*pSkew)[pin];
+		}
+	}
+
+	gStamp = new vector<int>(nG, -1);
+	gLast = new vector<unsigned char>(nG, indet);
+	pState = new vector<unsigned char>(pGate->size(), indet);
+
+	queues = new vector<eventQueue>(nThreads);
+	boxes = new vector<vector<event> >(nThreads * nThreads);
+	dirty = new vector<vector<int> >(nThreads);
+	oChanges = new vector<vector<event> >(n->cntoPads());
+	chunkEvents = new vector<long>(nThreads * STRIDE, 0);
+	chunkNext = new vector<int>(nThreads * STRIDE, 0);
+
+	threads = new pthread_t[nThreads];
+}
+
+//========================
+//EventEngine Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the partition and event storage. The netlist is not deleted.
+//========================
+EventEngine::~EventEngine()
+{
+	delete [] threads;
+
+	delete gOwner;
+	delete gPin;
+	delete gStamp;
+	delete gLast;
+	delete pGate;
+	delete pSkew;
+	delete pState;
+	delete wPinStart;
+	delete wPin;
+	delete gPads;
+	delete oPadNext;
+	delete chunkGate;
+	delete queues;
+	delete boxes;
+	delete dirty;
+	delete oChanges;
+	delete chunkEvents;
+	delete chunkNext;
+}
+
+//========================
+//EventEngine Thread Count
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How many threads, and so partitions, share the run.
+//Returns:
+//	int	-	the thread count
+//========================
+int			EventEngine::cntThreads()
+{
+	return nThreads;
+}
+
+//========================
+//EventEngine Lookahead
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The smallest delay plus skew on any connection between partitions,
+//		which is the length of a time window. INT_MAX with one partition.
+//Returns:
+//	int	-	the lookahead in ns
+//========================
+int			EventEngine::getLookahead()
+{
+	return lookahead;
+}
+
+//========================
+//EventEngine Windows
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How many time windows the last run took.
+//Returns:
+//	long	-	the window count
+//========================
+long		EventEngine::getWindows()
+{
+	return windows;
+}
+
+//========================
+//EventEngine Events
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How many pin events the last run processed.
+//Returns:
+//	long	-	the event count
+//========================
+long		EventEngine::getEvents()
+{
+	long sum = 0;
+
+	for (int c = 0; c < nThreads; c++)
+		sum += (*chunkEvents)[c * STRIDE];
+
+	return sum;
+}
+
+//========================
+//EventEngine Evaluate
+//========================
+//Parameters:
+//	int	g	-	a gate
+//Summary:
+//	Gate g's result on its pins' current states.
+//Returns:
+//	state	-	the result
+//========================
+state		EventEngine::eval(int g)
+{
+	int		first = (*gPin)[g];
+	int		last = (*gPin)[g + 1];
+	state	s = (state) (*pState)[first];
+
+	switch (net->getType(g))
+	{
+	case gAND:
+	case gNAND:
+		for (int pin = first + 1; pin < last; pin++)
+			s = AND(s, (state) (*pState)[pin]);
+		break;
+	case gOR:
+	case gNOR:
+		for (int pin = first + 1; pin < last; pin++)
+			s = OR(s, (state) (*pState)[pin]);
+		break;
+	case gXOR:
+	case gXNOR:
+		for (int pin = first + 1; pin < last; pin++)
+			s = XOR(s, (state) (*pState)[pin]);
+		break;
+	case gNOT:
+		break;
+	case gLUT:
+		{
+			int idx = 0;
+			int mult = 1;
+
+			for (int pin = first; pin < last; pin++)
+			{
+				idx += (*pState)[pin] * mult;
+				mult *= 3;
+			}
+
+			return net->getLUT(g, idx);
+		}
+	}
+
+	if ((net->getType(g) == gNAND) || (net->getType(g) == gNOR) ||
+		(net->getType(g) == gXNOR) || (net->getType(g) == gNOT))
+		s = NOT(s);
+
+	return s;
+}
+
+//========================
+//EventEngine Process
+//========================
+//Parameters:
+//	int	c	-	a partition
+//	int	t	-	the time of its earliest pending event
+//Summary:
+//	Applies every event partition c has at time t, then evaluates each
+//		gate whose pins changed (every gate, at time 0). A result that
+//		differs from the gate's last one is recorded on its output pads
+//		and sent to its fan-out pins delay and skew later: into this
+//		partition's queue, or the mailbox of the partition that owns the
+//		pin. Mailboxes have one writer and one reader and are only read
+//		after the window's barrier, so they need no locking.
+//Returns:
+//	n/a
+//========================
+void		EventEngine::process(int c, int t)
+{
+	eventQueue&		q = (*queues)[c];
+	vector<int>&	d = (*dirty)[c];
+
+	while (!q.empty() && ((int) (q.top() >> 32) == t))
+	{
+		int pin = (int) ((q.top() >> 2) & 0x3fffffff);
+		int g = (*pGate)[pin];
+
+		(*pState)[pin] = (unsigned char) (q.top() & 3);
+		q.pop();
+
+		(*chunkEvents)[c * STRIDE]++;
+
+		if ((*gStamp)[g] != t)
+		{
+			(*gStamp)[g] = t;
+			d.push_back(g);
+		}
+	}
+
+	if (t == 0)
+	{
+		for (int g = (*chunkGate)[c]; g < (*chunkGate)[c + 1]; g++)
+		{
+			if ((*gStamp)[g] != t)
+			{
+				(*gStamp)[g] = t;
+				d.push_back(g);
+			}
+		}
+	}
+
+	for (int k = 0; k < d.size(); k++)
+	{
+		int		g = d[k];
+		state	s = eval(g);
+		int		to = t + net->getDelay(g);
+		int		wr = net->getOutput(g);
+
+		if ((s == (*gLast)[g]) || (to > tStop))
+			continue;
+
+		(*gLast)[g] = s;
+
+		for (int op = (*gPads)[g]; op >= 0; op = (*oPadNext)[op])
+			(*oChanges)[op].push_back((((event) to) << 2) | s);
+
+		for (int f = (*wPinStart)[wr]; f < (*wPinStart)[wr + 1]; f++)
+		{
+			int pin = (*wPin)[f];
+			int tp = to + (*pSkew)[pin];
+			int owner = (*gOwner)[(*pGate)[pin]];
+
+			if (tp > tStop)
+				continue;
+
+			if (owner == c)
+				q.push(mkEvent(tp, pin, s));
+			else
+				(*boxes)[c * nThreads + owner].push_back(mkEvent(tp, pin, s));
+		}
+	}
+
+	d.clear();
+}
+
+//========================
+//EventEngine Worker
+//========================
+//Parameters:
+//	void	*arg	-	the EventEngine
+//Summary:
+//	Thread entry point: waits at the gate until every thread has been
+//		started, then takes the next partition number and works it,
+//		unless run gave up.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		EventEngine::worker(void *arg)
+{
+	EventEngine* eng = (EventEngine*) arg;
+
+	pthread_mutex_lock(&eng->gate);
+	pthread_mutex_unlock(&eng->gate);
+
+	if (eng->quit)
+		return NULL;
+
+	eng->work(__sync_fetch_and_add(&eng->seat, 1));
+
+	return NULL;
+}
+
+//========================
+//EventEngine Work
+//========================
+//Parameters:
+//	int	c	-	this thread's partition
+//Summary:
+//	One partition's share of a run. Each window: take in the events
+//		other partitions sent during the last one, post this partition's
+//		earliest pending time, and wait for the others. The earliest of
+//		all, T, starts the window; nothing can arrive from another
+//		partition before T + lookahead, so every local event before that
+//		is safe to process. A second barrier closes the window so every
+//		mailbox is complete before it is read. The run ends when T passes
+//		the end time.
+//Returns:
+//	n/a
+//========================
+void		EventEngine::work(int c)
+{
+	eventQueue& q = (*queues)[c];
+
+	process(c, 0);
+
+	if (nThreads > 1)
+		pthread_barrier_wait(&barrier);	// time 0's mailboxes are complete.
+
+	for (;;)
+	{
+		for (int s = 0; s < nThreads; s++)
+		{
+			vector<event>& box = (*boxes)[s * nThreads + c];
+
+			for (int e = 0; e < box.size(); e++)
+				q.push(box[e]);
+
+			box.clear();
+		}
+
+		(*chunkNext)[c * STRIDE] = q.empty() ? INT_MAX : (int) (q.top() >> 32);
+
+		if (nThreads > 1)
+			pthread_barrier_wait(&barrier);
+
+		int t = INT_MAX;
+
+		for (int s = 0; s < nThreads; s++)
+		{
+			if ((*chunkNext)[s * STRIDE] < t)
+				t = (*chunkNext)[s * STRIDE];
+		}
+
+		if (t > tStop)
+			return;
+
+		if (c == 0)
+			windows++;
+
+		long limit = (long) t + lookahead;
+
+		while (!q.empty() && ((q.top() >> 32) < limit))
+			process(c, (int) (q.top() >> 32));
+
+		if (nThreads > 1)
+			pthread_barrier_wait(&barrier);
+	}
+}
+
+//========================
+//EventEngine Run
+//========================
+//Parameters:
+//	Vector	*v		-	the vector whose PadStates drive and record the run
+//	int		tEnd	-	the last time increment to simulate
+//Summary:
+//	The event driven counterpart of Engine::run. Turns each input pad's
+//		states into events at the times they change, runs the partitions
+//		to tEnd, one per thread, and writes each output pad's changes out
+//		as a state per nanosecond.
+//Returns:
+//	n/a
+//========================
+void		EventEngine::run(Vector *v, int tEnd) throw (BasicException)
+{
+	if (v == NULL)
+		throw NullPointerException();
+
+	if (tEnd < 1)
+		throw BasicException("Time to run is zero or negative. INVALID!");
+
+	vector<int>			iIdx;
+	vector<PadState*>	iPS;
+	vector<int>			oIdx;
+	vector<PadState*>	oPS;
+
+	net->matchPads(v, iIdx, iPS, oIdx, oPS);
+
+	tStop = tEnd;
+	windows = 0;
+
+	gStamp->assign(gStamp->size(), -1);
+	gLast->assign(gLast->size(), indet);
+	pState->assign(pState->size(), indet);
+	chunkEvents->assign(chunkEvents->size(), 0);
+
+	for (int c = 0; c < nThreads; c++)
+		(*queues)[c] = eventQueue();
+
+	for (int op = 0; op < oChanges->size(); op++)
+		(*oChanges)[op].clear();
+
+	for (int ip = 0; ip < iPS.size(); ip++)
+	{
+		int		wr = net->getiPadWire(iIdx[ip]);
+		state	last = indet;
+
+		for (int ct = 0; ct < tEnd + 1; ct++)
+		{
+			state s = (iPS[ip]->cntStates() == 0) ? indet : iPS[ip]->getState(ct);
+
+			if (s == last)
+				continue;
+
+			last = s;
+
+			for (int f = (*wPinStart)[wr]; f < (*wPinStart)[wr + 1]; f++)
+			{
+				int pin = (*wPin)[f];
+
+				if (ct + (*pSkew)[pin] <= tEnd)
+					(*queues)[(*gOwner)[(*pGate)[pin]]].push(mkEvent(ct + (*pSkew)[pin], pin, s));
+			}
+
+			for (int op = 0; op < net->cntoPads(); op++)
+			{
+				if (net->getoPadWire(op) == wr)
+					(*oChanges)[op].push_back((((event) ct) << 2) | s);
+			}
+		}
+	}
+
+	if (nThreads > 1)
+	{
+		pthread_barrier_init(&barrier, NULL, nThreads);
+		pthread_mutex_init(&gate, NULL);
+
+		seat = 1;
+
+		// As in the Engine: if a worker cannot be started, those that
+		// were leave through the gate before touching the barrier.
+		pthread_mutex_lock(&gate);
+
+		int c = 1;
+
+		while ((c < nThreads) && (pthread_create(&threads[c], NULL, worker, this) == 0))
+			c++;
+
+		quit = (c < nThreads);
+
+		pthread_mutex_unlock(&gate);
+
+		if (quit)
+		{
+			char buf[80];
+
+			for (int k = 1; k < c; k++)
+				pthread_join(threads[k], NULL);
+
+			pthread_barrier_destroy(&barrier);
+			pthread_mutex_destroy(&gate);
+
+			sprintf(buf, "Unable to start simulation thread %d of %d.", c + 1, nThreads);
+			throw BasicException(buf);
+		}
+	}
+
+	work(0);
+
+	if (nThreads > 1)
+	{
+		for (int c = 1; c < nThreads; c++)
+			pthread_join(threads[c], NULL);
+
+		pthread_barrier_destroy(&barrier);
+		pthread_mutex_destroy(&gate);
+	}
+
+	for (int op = 0; op < oPS.size(); op++)
+	{
+		vector<event>&	chg = (*oChanges)[oIdx[op]];
+		state			s = indet;
+		int				k = 0;
+
+		for (int ct = 0; ct < tEnd + 1; ct++)
+		{
+			for (; (k < chg.size()) && ((int) (chg[k] >> 2) <= ct); k++)
+				s = (state) (chg[k] & 3);
+
+			oPS[op]->addState(s, ct);
+		}
+	}
+}
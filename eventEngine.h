@@ -0,0 +1,111 @@
+#ifndef EVENTENGINE_H
+#define EVENTENGINE_H
+
+//================================================================
+//Filename:		Parallel Event Engine Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of the EventEngine, which
+//					simulates a Netlist event by event, with the
+//					gates partitioned across threads that keep in
+//					step through conservative time windows.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <iostream>
+#include <functional>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+
+using namespace std;
+
+// A pending event, ordered by time: the time in the high 32 bits, then
+// the pin the event sets, then the state it sets it to in the low 2 bits.
+typedef long long	event;
+
+// A min-heap of events, earliest first.
+typedef priority_queue<event, vector<event>, greater<event> >	eventQueue;
+
+//==================================
+//Class:	EventEngine
+//Parent:	n/a
+//==================================
+//Description:
+//	The EventEngine simulates a Netlist by events rather than steps: a
+//		gate is evaluated only at times one of its input pins changes,
+//		and a changed result becomes events on its fan-out pins delay
+//		(plus any gLUT input skew) later. Results match the Engine's.
+//		The gates are cut into one contiguous partition per thread, each
+//		with its own event queue. Since every delay is at least 1ns,
+//		an event a gate sends across partitions always lands at least
+//		the lookahead (the smallest delay plus skew on any such crossing)
+//		after the time that caused it. So the threads agree on the
+//		earliest pending time T, each processes its own events before
+//		T + lookahead without waiting on the others, then they swap the
+//		events they sent each other and agree on the next window. This
+//		works the same for circuits with feedback, like flipflop.txt.
+//==================================
+class EventEngine
+{
+public:
+				EventEngine(Netlist *n, int nt = 1) throw (NullPointerException, BasicException);
+
+				~EventEngine();
+
+	int			cntThreads();
+	int			getLookahead();
+	long		getWindows();
+	long		getEvents();
+
+	void		run(Vector *v, int tEnd) throw (BasicException);
+
+private:
+
+	void		work(int c);
+	void		process(int c, int t);
+	state		eval(int g);
+
+static void*	worker(void *arg);
+
+	Netlist*				net;
+	int						nThreads;
+	int						lookahead;
+	int						tStop;
+	long					windows;
+
+	vector<int>*			gOwner;		// partition of each gate.
+	vector<int>*			gPin;		// first input pin of each gate, plus one past the end.
+	vector<int>*			gStamp;		// last time each gate was marked for evaluation.
+	vector<unsigned char>*	gLast;		// last result each gate scheduled.
+	vector<int>*			pGate;		// gate of each pin.
+	vector<int>*			pSkew;		// skew of each pin.
+	vector<unsigned char>*	pState;		// current state of each pin.
+	vector<int>*			wPinStart;	// fan-out pins of each wire, packed.
+	vector<int>*			wPin;
+	vector<int>*			gPads;		// output pad driven by each gate, or -1.
+	vector<int>*			oPadNext;	// next output pad on the same wire, or -1.
+
+	vector<int>*			chunkGate;
+	vector<eventQueue>*		queues;
+	vector<vector<event> >*	boxes;		// sender * nThreads + receiver.
+	vector<vector<int> >*	dirty;
+	vector<vector<event> >*	oChanges;	// per output pad: time << 2 | state.
+	vector<long>*			chunkEvents;
+	vector<int>*			chunkNext;
+
+	pthread_t*				threads;
+	pthread_barrier_t		barrier;
+	pthread_mutex_t			gate;	// held while the workers are started.
+	volatile bool			quit;
+	int						seat;
+};
+
+#endif //EVENTENGINE_H
@@ -0,0 +1,964 @@
+//================================================================
+//Filename:		Stuck-at Fault Simulator Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the FaultSim: the
+//					fault list, the patterns, good simulation, and
+//					single fault propagation on the threads.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <iostream>
+#include <functional>
+#include <algorithm>
+#include <cstdio>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "truthTable.h"
+#include "faultSim.h"
+
+using namespace std;
+
+// Words of 64 patterns simulated between fault list passes.
+#define BLOCK_WORDS	64
+
+// Faults a thread takes at a time.
+#define FAULT_CHUNK	32
+
+//========================
+//FaultSim Constructor
+//========================
+//Parameters:
+//	Netlist	*n	-	the netlist to grade against; put into level order
+//	int		nt	-	how many threads to share the fault list
+//Summary:
+//	Puts the netlist in level order and lists the faults: for every
+//		wire, stuck-at-0 and stuck-at-1, then, for every gate input on a
+//		wire read in more than one place, the branch stuck-at-0 and 1.
+//		The netlist must outlive the FaultSim.
+//========================
+FaultSim::FaultSim(Netlist *n, int nt) throw (NullPointerException, BasicException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	if (nt < 1)
+		throw BasicException("Thread count must be at least 1.");
+
+	if (n->getPathDelay() < 0)
+		throw BasicException("Fault simulation needs a circuit without feedback.");
+
+	net = n;
+	nThreads = nt;
+	nPatterns = 0;
+	blockWord = 0;
+	blockWords = 0;
+	nextChunk = 0;
+
+	net->reorder(oLevel);
+
+	fWire = new vector<int>();
+	fGate = new vector<int>();
+	fPin = new vector<int>();
+	fStuck = new vector<int>();
+	fDetect = new vector<int>();
+	wOut = new vector<bool>(net->cntWires(), false);
+	pats = new vector<unsigned char>();
+	goods = new vector<lanes>();
+	threads = new pthread_t[nThreads];
+
+	vector<int> reads(net->cntWires(), 0);
+
+	for (int op = 0; op < net->cntoPads(); op++)
+	{
+		(*wOut)[net->getoPadWire(op)] = true;
+		reads[net->getoPadWire(op)]++;
+	}
+
+	for (int g = 0; g < net->cntGates(); g++)
+	{
+		for (int k = 0; k < net->cntInputs(g); k++)
+			reads[net->getInput(g, k)]++;
+	}
+
+	for (int w = 0; w < net->cntWires(); w++)
+	{
+		for (int s = 0; s < 2; s++)
+		{
+			fWire->push_back(w);
+			fGate->push_back(-1);
+			fPin->push_back(0);
+			fStuck->push_back(s);
+		}
+	}
+
+	for (int g = 0; g < net->cntGates(); g++)
+	{
+		for (int k = 0; k < net->cntInputs(g); k++)
+		{
+			if (reads[net->getInput(g, k)] < 2)
+				continue;
+
+			for (int s = 0; s < 2; s++)
+			{
+				fWire->push_back(net->getInput(g, k));
+				fGate->push_back(g);
+				fPin->push_back(k);
+				fStuck->push_back(s);
+			}
+		}
+	}
+
+	fDetect->assign(fWire->size(), -1);
+	nUncollapsed = fWire->size();
+}
+
+//========================
+//FaultSim Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the fault list and patterns. The netlist is not deleted.
+//========================
+FaultSim::~FaultSim()
+{
+	delete [] threads;
+
+	delete fWire;
+	delete fGate;
+	delete fPin;
+	delete fStuck;
+	delete fDetect;
+	delete wOut;
+	delete pats;
+	delete goods;
+}
+
+//========================
+//FaultSim Accessors
+//========================
+//Parameters:
+//	int	f	-	a fault
+//Summary:
+//	Thread, fault, pre-collapse fault, pattern and detected fault
+//		counts; a fault's name,
+//		"wire/0" or "wire/1" for a wire and "wire>gate.k/0" or /1 for
+//		input k of gate; the first pattern to detect a fault, -1 if
+//		none did; and a fault's wire, gate and input (-1 and 0 for a
+//		wire's own fault) and stuck-at value.
+//Returns:
+//	varies
+//========================
+int			FaultSim::cntThreads()
+{
+	return nThreads;
+}
+
+int			FaultSim::cntFaults()
+{
+	return fWire->size();
+}
+
+int			FaultSim::cntUncollapsed()
+{
+	return nUncollapsed;
+}
+
+int			FaultSim::cntPatterns()
+{
+	return nPatterns;
+}
+
+int			FaultSim::cntDetected()
+{
+	int d = 0;
+
+	for (int f = 0; f < cntFaults(); f++)
+	{
+		if ((*fDetect)[f] >= 0)
+			d++;
+	}
+
+	return d;
+}
+
+string		FaultSim::getFaultName(int f)
+{
+	char	buf[24];
+	string	name = net->getWireID((*fWire)[f]);
+
+	if ((*fGate)[f] >= 0)
+	{
+		sprintf(buf, ".%d", (*fPin)[f]);
+		name += ">" + net->getGateID((*fGate)[f]) + buf;
+	}
+
+	sprintf(buf, "/%d", (*fStuck)[f]);
+
+	return name + buf;
+}
+
+int			FaultSim::getDetectedBy(int f)
+{
+	return (*fDetect)[f];
+}
+
+void		FaultSim::getFault(int f, int &wire, int &gate, int &pin, int &stuck)
+{
+	wire = (*fWire)[f];
+	gate = (*fGate)[f];
+	pin = (*fPin)[f];
+	stuck = (*fStuck)[f];
+}
+
+// Finds the class a fault is in, flattening the path as it goes.
+static int	findClass(vector<int> &cls, int f)
+{
+	while (cls[f] != f)
+	{
+		cls[f] = cls[cls[f]];
+		f = cls[f];
+	}
+
+	return f;
+}
+
+//========================
+//FaultSim Collapse
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Merges equivalent faults gate by gate (see the class description)
+//		and keeps the first fault of each class, which is a wire's fault
+//		where the class has one. Call before run().
+//Returns:
+//	int	-	how many faults were removed
+//========================
+int			FaultSim::collapse()
+{
+	int			nF = cntFaults();
+	vector<int>	cls(nF);
+	vector<int>	stem(2 * net->cntWires(), -1);
+	vector<int>	pinBase(net->cntGates(), -1);	// first branch fault on each gate.
+
+	for (int f = 0; f < nF; f++)
+	{
+		cls[f] = f;
+
+		if ((*fGate)[f] < 0)
+			stem[2 * (*fWire)[f] + (*fStuck)[f]] = f;
+		else if (pinBase[(*fGate)[f]] < 0)
+			pinBase[(*fGate)[f]] = f;
+	}
+
+	for (int g = 0; g < net->cntGates(); g++)
+	{
+		gateType	type = net->getType(g);
+		int			o = net->getOutput(g);
+		int			in;		// input stuck-at that matches
+		int			out;	// this output stuck-at.
+
+		if ((type == gAND) || (type == gNAND))
+			in = 0;
+		else if ((type == gOR) || (type == gNOR))
+			in = 1;
+		else if (type != gNOT)
+			continue;
+
+		for (int k = 0; k < net->cntInputs(g); k++)
+		{
+			for (int s = 0; s < 2; s++)
+			{
+				if ((type != gNOT) && (s != in))
+					continue;
+
+				out = s;
+
+				if ((type == gNOT) || (type == gNAND) || (type == gNOR))
+					out = 1 - s;
+
+				int f = stem[2 * net->getInput(g, k) + s];
+
+				for (int b = pinBase[g]; (b >= 0) && (b < nF) && ((*fGate)[b] == g); b++)
+				{
+					if (((*fPin)[b] == k) && ((*fStuck)[b] == s))
+						f = b;
+				}
+
+				int a = findClass(cls, f);
+				int c = findClass(cls, stem[2 * o + out]);
+
+				if (a < c)
+					cls[c] = a;
+				else
+					cls[a] = c;
+			}
+		}
+	}
+
+	vector<int> keep;
+
+	for (int f = 0; f < nF; f++)
+	{
+		if (findClass(cls, f) == f)
+			keep.push_back(f);
+	}
+
+	for (int k = 0; k < keep.size(); k++)
+	{
+		(*fWire)[k] = (*fWire)[keep[k]];
+		(*fGate)[k] = (*fGate)[keep[k]];
+		(*fPin)[k] = (*fPin)[keep[k]];
+		(*fStuck)[k] = (*fStuck)[keep[k]];
+	}
+
+	fWire->resize(keep.size());
+	fGate->resize(keep.size());
+	fPin->resize(keep.size());
+	fStuck->resize(keep.size());
+	fDetect->assign(keep.size(), -1);
+
+	return nF - keep.size();
+}
+
+//========================
+//FaultSim Patterns
+//========================
+//Parameters:
+//	Vector	*v	-	the vector to take patterns from
+//Summary:
+//	Reads the input pads' states at time 0 and at each time any of them
+//		changes, one pattern per time.
+//Returns:
+//	n/a
+//========================
+void		FaultSim::patterns(Vector *v) throw (BasicException)
+{
+	vector<int>			iIdx;
+	vector<PadState*>	iPS;
+	vector<int>			oIdx;
+	vector<PadState*>	oPS;
+
+	net->matchPads(v, iIdx, iPS, oIdx, oPS);
+
+	int nI = net->cntiPads();
+	int tEnd = 0;
+
+	for (int ip = 0; ip < iPS.size(); ip++)
+	{
+		if (iPS[ip]->cntStates() > tEnd)
+			tEnd = iPS[ip]->cntStates();
+	}
+
+	vector<unsigned char> row(nI, indet);
+	vector<unsigned char> last(nI, indet);
+
+	pats->clear();
+	nPatterns = 0;
+
+	for (int ct = 0; ct < tEnd; ct++)
+	{
+		for (int ip = 0; ip < iPS.size(); ip++)
+			row[iIdx[ip]] = ((iPS[ip]->cntStates() == 0) ? indet : iPS[ip]->getState(ct));
+
+		if ((ct > 0) && (row == last))
+			continue;
+
+		pats->insert(pats->end(), row.begin(), row.end());
+		last = row;
+		nPatterns++;
+	}
+}
+
+//========================
+//FaultSim Evaluate Gate
+//========================
+//Parameters:
+//	int		g		-	a gate
+//	lanes	*v		-	wire words, 1s then 0s per wire
+//	int		pin		-	an input to hold stuck, or -1
+//	int		stuck	-	what pin is stuck at
+//	lanes	&one	-	receives the rows where the output is 1
+//	lanes	&zero	-	receives the rows where the output is 0
+//Summary:
+//	Evaluates one gate on 64 patterns in 0/1/X, as TruthTable::eval does.
+//Returns:
+//	n/a
+//========================
+void		FaultSim::evalGate(int g, lanes *v, int pin, int stuck, lanes &one, lanes &zero)
+{
+	gateType	type = net->getType(g);
+	int			nin = net->cntInputs(g);
+
+	for (int k = 0; k < nin; k++)
+	{
+		int		w = net->getInput(g, k);
+		lanes	bOne = v[2 * w];
+		lanes	bZero = v[2 * w + 1];
+
+		if (k == pin)
+		{
+			bOne = (stuck ? ~0ULL : 0ULL);
+			bZero = ~bOne;
+		}
+
+		if (k == 0)
+		{
+			one = bOne;
+			zero = bZero;
+		}
+		else if ((type == gAND) || (type == gNAND))
+		{
+			one &= bOne;
+			zero |= bZero;
+		}
+		else if ((type == gOR) || (type == gNOR))
+		{
+			one |= bOne;
+			zero &= bZero;
+		}
+		else
+		{
+			lanes tOne = (one & bZero) | (zero & bOne);
+
+			zero = (one & bOne) | (zero & bZero);
+			one = tOne;
+		}
+	}
+
+	if ((type == gNOT) || (type == gNAND) || (type == gNOR) || (type == gXNOR))
+	{
+		lanes t = one;
+
+		one = zero;
+		zero = t;
+	}
+}
+
+//========================
+//FaultSim Good
+//========================
+//Parameters:
+//	int		w	-	a word of patterns
+//	lanes	*v	-	receives every wire's words
+//Summary:
+//	Simulates the fault-free circuit on patterns 64w through 64w+63;
+//		rows past the last pattern are all X.
+//Returns:
+//	n/a
+//========================
+void		FaultSim::good(int w, lanes *v)
+{
+	int nI = net->cntiPads();
+
+	for (int ip = 0; ip < nI; ip++)
+	{
+		lanes one = 0;
+		lanes zero = 0;
+
+		for (int l = 0; l < 64; l++)
+		{
+			long p = (long) w * 64 + l;
+
+			if (p >= nPatterns)
+				break;
+
+			if ((*pats)[p * nI + ip] == high)
+				one |= 1ULL << l;
+			else if ((*pats)[p * nI + ip] == low)
+				zero |= 1ULL << l;
+		}
+
+		v[2 * net->getiPadWire(ip)] = one;
+		v[2 * net->getiPadWire(ip) + 1] = zero;
+	}
+
+	for (int g = 0; g < net->cntGates(); g++)
+	{
+		int o = net->getOutput(g);
+
+		evalGate(g, v, -1, 0, v[2 * o], v[2 * o + 1]);
+	}
+}
+
+//========================
+//FaultSim Inject
+//========================
+//Parameters:
+//	int			f		-	a fault
+//	int			word	-	the word of the block being simulated
+//	lanes		*v		-	that word's wires, good values; the fault's
+//							values are worked on and put back
+//	vector<int>	&stamp	-	per wire, the mark of the last fault to change it
+//	vector<lanes>	&fv	-	good values of the wires a fault changes
+//	priority_queue	&heap	-	gates waiting, lowest (earliest level) first
+//	vector<int>	&queued	-	per gate, the mark of the last fault to queue it
+//	int			&mark	-	a number unique to this injection; advanced
+//Summary:
+//	Puts the fault on the wire or gate input, then re-evaluates just the
+//		gates downstream of a change, in level order, and records the
+//		first pattern where an output pad's 0 and 1 are swapped. The
+//		good values are restored before returning.
+//Returns:
+//	n/a
+//========================
+void		FaultSim::inject(int f, int word, lanes *v, vector<int> &stamp, vector<lanes> &fv,
+				priority_queue<int, vector<int>, greater<int> > &heap, vector<int> &queued, int &mark)
+{
+	vector<int>	touched;
+	lanes		one;
+	lanes		zero;
+	lanes		det = 0;
+	int			w;
+
+	mark++;
+
+	if ((*fGate)[f] < 0)
+	{
+		w = (*fWire)[f];
+		one = ((*fStuck)[f] ? ~0ULL : 0ULL);
+		zero = ~one;
+	}
+	else
+	{
+		w = net->getOutput((*fGate)[f]);
+		evalGate((*fGate)[f], v, (*fPin)[f], (*fStuck)[f], one, zero);
+	}
+
+	while (true)
+	{
+		if ((one != v[2 * w]) || (zero != v[2 * w + 1]))
+		{
+			if (stamp[w] != mark)
+			{
+				stamp[w] = mark;
+				fv[2 * w] = v[2 * w];
+				fv[2 * w + 1] = v[2 * w + 1];
+				touched.push_back(w);
+			}
+
+			v[2 * w] = one;
+			v[2 * w + 1] = zero;
+
+			for (int k = 0; k < net->cntFanout(w); k++)
+			{
+				int r = net->getFanout(w, k);
+
+				if (queued[r] != mark)
+				{
+					queued[r] = mark;
+					heap.push(r);
+				}
+			}
+		}
+
+		if (heap.empty())
+			break;
+
+		int g = heap.top();
+
+		heap.pop();
+
+		w = net->getOutput(g);
+		evalGate(g, v, -1, 0, one, zero);
+	}
+
+	for (int t = 0; t < touched.size(); t++)
+	{
+		w = touched[t];
+
+		if ((*wOut)[w])
+			det |= (fv[2 * w] & v[2 * w + 1]) | (fv[2 * w + 1] & v[2 * w]);
+
+		v[2 * w] = fv[2 * w];
+		v[2 * w + 1] = fv[2 * w + 1];
+	}
+
+	if (det != 0)
+	{
+		int l = 0;
+
+		while (!((det >> l) & 1))
+			l++;
+
+		(*fDetect)[f] = (blockWord + word) * 64 + l;
+	}
+}
+
+//========================
+//FaultSim Worker
+//========================
+//Parameters:
+//	void	*arg	-	the FaultSim
+//Summary:
+//	Thread entry point.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		FaultSim::worker(void *arg)
+{
+	((FaultSim*) arg)->work();
+
+	return NULL;
+}
+
+//========================
+//FaultSim Work
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Takes chunks of the fault list until none are left, and runs every
+//		fault of a chunk not yet detected through the block's words, on
+//		a private copy of each word's good values.
+//Returns:
+//	n/a
+//========================
+void		FaultSim::work()
+{
+	int			nW = net->cntWires();
+	int			nF = cntFaults();
+	int			mark = 0;
+	vector<lanes>	v(2 * nW);
+	vector<lanes>	fv(2 * nW);
+	vector<int>	stamp(nW, 0);
+	vector<int>	queued(net->cntGates(), 0);
+	priority_queue<int, vector<int>, greater<int> >	heap;
+
+	while (true)
+	{
+		int from = __sync_fetch_and_add(&nextChunk, 1) * FAULT_CHUNK;
+
+		if (from >= nF)
+			break;
+
+		int to = (from + FAULT_CHUNK < nF) ? from + FAULT_CHUNK : nF;
+
+		for (int word = 0; word < blockWords; word++)
+		{
+			bool live = false;
+
+			for (int f = from; f < to; f++)
+				live = live || ((*fDetect)[f] < 0);
+
+			if (!live)
+				break;
+
+			copy(goods->begin() + (long) word * 2 * nW, goods->begin() + (long) (word + 1) * 2 * nW, v.begin());
+
+			for (int f = from; f < to; f++)
+			{
+				if ((*fDetect)[f] < 0)
+					inject(f, word, &v[0], stamp, fv, heap, queued, mark);
+			}
+		}
+	}
+}
+
+//========================
+//FaultSim Run
+//========================
+//Parameters:
+//	Vector	*v	-	the vector to grade
+//Summary:
+//	Grades the vector's patterns. See grade().
+//Returns:
+//	n/a
+//========================
+void		FaultSim::run(Vector *v) throw (BasicException)
+{
+	if (v == NULL)
+		throw NullPointerException();
+
+	patterns(v);
+
+	fDetect->assign(cntFaults(), -1);
+
+	grade();
+}
+
+//========================
+//FaultSim Run Patterns
+//========================
+//Parameters:
+//	vector<unsigned char>	&p		-	cntiPads() states per pattern,
+//										in netlist pad order
+//	bool					drop	-	keep earlier detections
+//Summary:
+//	Grades patterns made elsewhere, as ATPG does. With drop, a fault
+//		an earlier run detected stays detected, is not simulated again,
+//		and its getDetectedBy still names a pattern of that run.
+//Returns:
+//	n/a
+//========================
+void		FaultSim::run(vector<unsigned char> &p, bool drop) throw (BasicException)
+{
+	*pats = p;
+	nPatterns = (net->cntiPads() == 0) ? 0 : p.size() / net->cntiPads();
+
+	if (!drop)
+		fDetect->assign(cntFaults(), -1);
+
+	grade();
+}
+
+//========================
+//FaultSim Grade
+//========================
+//Parameters:
+//	none
+//Summary:
+//	A block of 64 words of patterns at a time, simulates the good
+//		circuit and hands the fault list to the threads. Stops early
+//		once every fault is detected.
+//Returns:
+//	n/a
+//========================
+void		FaultSim::grade()
+{
+	int nW = net->cntWires();
+	int words = (nPatterns + 63) / 64;
+
+	for (blockWord = 0; blockWord < words; blockWord += BLOCK_WORDS)
+	{
+		if (cntDetected() == cntFaults())
+			break;
+
+		blockWords = words - blockWord;
+
+		if (blockWords > BLOCK_WORDS)
+			blockWords = BLOCK_WORDS;
+
+		goods->assign((long) blockWords * 2 * nW, 0);
+
+		for (int word = 0; word < blockWords; word++)
+			good(blockWord + word, &(*goods)[(long) word * 2 * nW]);
+
+		nextChunk = 0;
+
+		int started = 1;
+
+		while ((started < nThreads) && (pthread_create(&threads[started], NULL, worker, this) == 0))
+			started++;
+
+		if (started < nThreads)
+		{
+			char buf[80];
+
+			for (int c = 1; c < started; c++)
+				pthread_join(threads[c], NULL);
+
+			sprintf(buf, "Unable to start fault simulation thread %d of %d.", started + 1, nThreads);
+			throw BasicException(buf);
+		}
+
+		work();
+
+		for (int c = 1; c < nThreads; c++)
+			pthread_join(threads[c], NULL);
+	}
+}
+
+//========================
+//FaultSim Run Concurrent
+//========================
+//Parameters:
+//	Vector	*v	-	the vector to grade
+//Summary:
+//	Grades the vector by concurrent fault simulation (see the class
+//		description). Each wire keeps its good state and a list, sorted
+//		by fault, of (fault << 2 | state) for the faults it differs
+//		under. A pattern sets the input pad wires, their own faults
+//		included; changed wires queue their readers, which are evaluated
+//		in level order for the good circuit and for every fault in
+//		their inputs' lists or on the gate (its inputs' branch faults
+//		and its output wire's faults). Every gate is evaluated for the
+//		first pattern. After each pattern, a fault listed on an output
+//		pad wire with both states known is detected, and dropped from
+//		then on. Runs on one thread; results match run().
+//Returns:
+//	n/a
+//========================
+void		FaultSim::runConcurrent(Vector *v) throw (BasicException)
+{
+	if (v == NULL)
+		throw NullPointerException();
+
+	patterns(v);
+
+	int nW = net->cntWires();
+	int nG = net->cntGates();
+	int nI = net->cntiPads();
+	int nF = cntFaults();
+
+	fDetect->assign(nF, -1);
+
+	vector<unsigned char>	gv(nW, indet);
+	vector<vector<int> >	lists(nW);
+	vector<vector<int> >	wFaults(nW);	// stem faults of each wire.
+	vector<vector<int> >	gFaults(nG);	// branch and output faults of each gate.
+	vector<bool>			queued(nG, true);
+	vector<int>				cand;
+	vector<int>				next;
+	vector<int>				at;
+	vector<state>			in;
+	priority_queue<int, vector<int>, greater<int> >	heap;
+
+	for (int f = 0; f < nF; f++)
+	{
+		if ((*fGate)[f] >= 0)
+			gFaults[(*fGate)[f]].push_back(f);
+		else if (net->getDriver((*fWire)[f]) >= 0)
+			gFaults[net->getDriver((*fWire)[f])].push_back(f);
+		else
+			wFaults[(*fWire)[f]].push_back(f);
+	}
+
+	for (int g = 0; g < nG; g++)
+		heap.push(g);
+
+	for (int p = 0; p < nPatterns; p++)
+	{
+		for (int ip = 0; ip < nI; ip++)
+		{
+			int		w = net->getiPadWire(ip);
+			state	s = (state) (*pats)[(long) p * nI + ip];
+
+			next.clear();
+
+			for (int k = 0; k < wFaults[w].size(); k++)
+			{
+				int f = wFaults[w][k];
+
+				if (((*fDetect)[f] < 0) && ((*fStuck)[f] != s))
+					next.push_back(f << 2 | (*fStuck)[f]);
+			}
+
+			if ((s == gv[w]) && (next == lists[w]))
+				continue;
+
+			gv[w] = s;
+			lists[w].swap(next);
+
+			for (int k = 0; k < net->cntFanout(w); k++)
+			{
+				int r = net->getFanout(w, k);
+
+				if (!queued[r])
+				{
+					queued[r] = true;
+					heap.push(r);
+				}
+			}
+		}
+
+		while (!heap.empty())
+		{
+			int g = heap.top();
+			int o = net->getOutput(g);
+			int nin = net->cntInputs(g);
+
+			heap.pop();
+			queued[g] = false;
+
+			in.resize(nin);
+			at.assign(nin, 0);
+			cand.clear();
+			next.clear();
+
+			for (int k = 0; k < nin; k++)
+			{
+				int w = net->getInput(g, k);
+
+				in[k] = (state) gv[w];
+
+				for (int e = 0; e < lists[w].size(); e++)
+					cand.push_back(lists[w][e] >> 2);
+			}
+
+			state good = evalType(net->getType(g), in);
+
+			for (int k = 0; k < gFaults[g].size(); k++)
+				cand.push_back(gFaults[g][k]);
+
+			sort(cand.begin(), cand.end());
+			cand.erase(unique(cand.begin(), cand.end()), cand.end());
+
+			for (int c = 0; c < cand.size(); c++)
+			{
+				int		f = cand[c];
+				state	res;
+
+				if ((*fDetect)[f] >= 0)
+					continue;
+
+				for (int k = 0; k < nin; k++)
+				{
+					vector<int> &l = lists[net->getInput(g, k)];
+
+					while ((at[k] < l.size()) && ((l[at[k]] >> 2) < f))
+						at[k]++;
+
+					if ((at[k] < l.size()) && ((l[at[k]] >> 2) == f))
+						in[k] = (state) (l[at[k]] & 3);
+					else
+						in[k] = (state) gv[net->getInput(g, k)];
+
+					if (((*fGate)[f] == g) && ((*fPin)[f] == k))
+						in[k] = (state) (*fStuck)[f];
+				}
+
+				if (((*fGate)[f] < 0) && ((*fWire)[f] == o))
+					res = (state) (*fStuck)[f];
+				else
+					res = evalType(net->getType(g), in);
+
+				if (res != good)
+					next.push_back(f << 2 | res);
+			}
+
+			if ((good == gv[o]) && (next == lists[o]))
+				continue;
+
+			gv[o] = good;
+			lists[o].swap(next);
+
+			for (int k = 0; k < net->cntFanout(o); k++)
+			{
+				int r = net->getFanout(o, k);
+
+				if (!queued[r])
+				{
+					queued[r] = true;
+					heap.push(r);
+				}
+			}
+		}
+
+		for (int op = 0; op < net->cntoPads(); op++)
+		{
+			int w = net->getoPadWire(op);
+
+			if (gv[w] == indet)
+				continue;
+
+			for (int e = 0; e < lists[w].size(); e++)
+			{
+				int f = lists[w][e] >> 2;
+
+				if (((lists[w][e] & 3) != indet) && ((*fDetect)[f] < 0))
+					(*fDetect)[f] = p;
+			}
+		}
+	}
+}
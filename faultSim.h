@@ -0,0 +1,124 @@
+#ifndef FAULTSIM_H
+#define FAULTSIM_H
+
+//================================================================
+//Filename:		Stuck-at Fault Simulator Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of the FaultSim, which
+//					grades a vector file by the stuck-at faults its
+//					input patterns detect.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <iostream>
+#include <functional>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "truthTable.h"
+
+using namespace std;
+
+//==================================
+//Class:	FaultSim
+//Parent:	n/a
+//==================================
+//Description:
+//	The FaultSim finds which single stuck-at-0 and stuck-at-1 faults a
+//		vector file detects in a circuit without feedback. The faults are
+//		every wire stuck at 0 and at 1, plus, where a wire feeds more than
+//		one gate or pad, every gate input it feeds (a branch), stuck at 0
+//		and at 1.
+//		A pattern is one setting of the input pads: the vector's inputs
+//		at time 0 and after every time any of them changes. Each pattern
+//		is judged by the outputs it settles to, so glitches along the way
+//		count for nothing. A fault is detected by a pattern when some
+//		output pad settles to 0 in the good circuit and 1 with the fault,
+//		or the other way round; X on either side detects nothing.
+//		Simulation is parallel-pattern single-fault propagation: wires
+//		carry 64 patterns per word, as in the TruthTable with X, the good
+//		circuit is evaluated once per word, and then each fault not yet
+//		detected is injected alone and carried forward only through the
+//		gates whose inputs it changes, in level order, until it dies out
+//		or reaches an output pad. A detected fault is dropped. The
+//		patterns go through in blocks; within a block, threads take
+//		chunks of the fault list in turn.
+//		runConcurrent() grades the same faults another way, suited to
+//		long functional vectors whose patterns differ in a few inputs:
+//		the good circuit is simulated one pattern at a time by events,
+//		and each wire carries, beside its good state, the list of faults
+//		under which it differs. A gate is evaluated only when an input's
+//		state or list changes, for the good circuit and for just the
+//		faults in its inputs' lists or on the gate itself, so faults
+//		that go nowhere cost nothing after their first pattern.
+//		collapse() first merges faults that no pattern can tell apart,
+//		keeping one of each class: an AND input stuck at 0 and its output
+//		stuck at 0, an OR's at 1, a NAND input at 0 and its output at 1,
+//		a NOR input at 1 and its output at 0, and a NOT input at either
+//		and its output at the other. A gate input is the wire's fault
+//		when the wire feeds nothing else, its branch fault otherwise.
+//==================================
+class FaultSim
+{
+public:
+				FaultSim(Netlist *n, int nt = 1) throw (NullPointerException, BasicException);
+
+				~FaultSim();
+
+	int			cntThreads();
+	int			cntFaults();
+	int			cntUncollapsed();
+	int			cntPatterns();
+	int			cntDetected();
+	string		getFaultName(int f);
+	int			getDetectedBy(int f);
+	void		getFault(int f, int &wire, int &gate, int &pin, int &stuck);
+
+	int			collapse();
+	void		run(Vector *v) throw (BasicException);
+	void		run(vector<unsigned char> &p, bool drop = false) throw (BasicException);
+	void		runConcurrent(Vector *v) throw (BasicException);
+
+private:
+
+	void		patterns(Vector *v) throw (BasicException);
+	void		grade();
+	void		good(int w, lanes *v);
+	void		evalGate(int g, lanes *v, int pin, int stuck, lanes &one, lanes &zero);
+	void		work();
+	void		inject(int f, int word, lanes *v, vector<int> &stamp, vector<lanes> &fv,
+					priority_queue<int, vector<int>, greater<int> > &heap, vector<int> &queued, int &mark);
+
+static void*	worker(void *arg);
+
+	Netlist*				net;
+	int						nThreads;
+
+	vector<int>*			fWire;		// per fault: the wire.
+	vector<int>*			fGate;		// per fault: the gate for a branch, or -1.
+	vector<int>*			fPin;		// per fault: the gate input for a branch.
+	vector<int>*			fStuck;		// per fault: 0 or 1.
+	vector<int>*			fDetect;	// per fault: first detecting pattern, or -1.
+	vector<bool>*			wOut;		// per wire: drives an output pad.
+	int						nUncollapsed;
+
+	int						nPatterns;
+	vector<unsigned char>*	pats;		// cntiPads() states per pattern.
+
+	int						blockWord;	// first word of the current block.
+	int						blockWords;	// words in the current block.
+	vector<lanes>*			goods;		// per word of the block, per wire: 1s then 0s.
+	int						nextChunk;
+
+	pthread_t*				threads;
+};
+
+#endif //FAULTSIM_H
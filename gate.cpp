@@ -18,6 +18,9 @@
 
 using namespace std;
 
+// Current propagation pass. See Gate::newEpoch().
+unsigned long	Gate::epoch = 1;
+
 // This file contains the logic for Gates
 // Note gates are defined as follows:
 //
@@ -37,6 +40,15 @@ using namespace std;
 // asso = associative property ... XYZ = (XY)Z = X(YZ) etc.
 // sing = single input
 
+// The simulation loop only ever sees valid states (Connections and PadStates
+// check them on the way in), so the logic functions below are plain lookups
+// into the table above, indexed [a][b] by the state enumeration.
+
+static const state	tblAND[3][3] = {{low, low, low}, {low, high, indet}, {low, indet, indet}};
+static const state	tblOR[3][3] = {{low, high, indet}, {high, high, high}, {indet, high, indet}};
+static const state	tblXOR[3][3] = {{low, high, indet}, {high, low, indet}, {indet, indet, indet}};
+static const state	tblNOT[3] = {high, low, indet};
+
 //========================
 //XOR Logic
 //========================
@@ -44,24 +56,14 @@ using namespace std;
 //	state	a	-	first logic value
 //	state	b	-	second logic value
 //Summary:
-//	This function performs (a XOR b) and returns the result. Note that
-//		XOR is really a composite function defined as ((a(~b))+((~a)b))
-//		and is built as such in this routine.
+//	This function performs (a XOR b) and returns the result. XOR is really
+//		the composite ((a(~b))+((~a)b)); the table holds its ternary result.
 //Returns:
 //	state	-	a XOR b
 //========================
-state XOR(state a, state b) throw (UnknownState)
+state XOR(state a, state b)
 { // XOR
-	state c;
-
-	if ((a != low) && (a != high) && (a != indet))
-		throw UnknownState();
-	if ((b != low) && (b != high) && (b != indet))
-		throw UnknownState();
-
-	c = OR(AND(a, NOT(b)), AND(b, NOT(a)));
-
-	return c;
+	return tblXOR[a][b];
 }
 
 //========================
@@ -72,23 +74,14 @@ state XOR(state a, state b) throw (UnknownState)
 //	state	b	-	second logic value
 //Summary:
 //	This function performs (a XNOR b) and returns the result. Note that
-//		XNOR is really a composite function defined as ((ab)+((~a)(~b)))
-//		and is built as such in this routine.
+//		XNOR is really a composite function defined as ((ab)+((~a)(~b))),
+//		which is the inverse of XOR for all three states.
 //Returns:
 //	state	-	a XNOR b
 //========================
-state XNOR(state a, state b) throw (UnknownState)
+state XNOR(state a, state b)
 { // XNOR
-	state c;
-
-	if ((a != low) && (a != high) && (a != indet))
-		throw UnknownState();
-	if ((b != low) && (b != high) && (b != indet))
-		throw UnknownState();
-
-	c = OR(AND(a, b), AND(NOT(a), NOT(b)));
-
-	return c;
+	return tblNOT[tblXOR[a][b]];
 }
 
 //========================
@@ -102,23 +95,9 @@ state XNOR(state a, state b) throw (UnknownState)
 //Returns:
 //	state	-	a OR b
 //========================
-state OR(state a, state b) throw (UnknownState)
+state OR(state a, state b)
 { // OR
-	state c;
-
-	if ((a != low) && (a != high) && (a != indet))
-		throw UnknownState();
-	if ((b != low) && (b != high) && (b != indet))
-		throw UnknownState();
-
-	if ((a == high) || (b == high))
-		c = high;
-	else if ((a == low) && (b == low))
-		c = low;
-	else
-		c = indet;
-
-	return c;
+	return tblOR[a][b];
 }
 
 //========================
@@ -132,23 +111,9 @@ state OR(state a, state b) throw (UnknownState)
 //Returns:
 //	state	-	a AND b
 //========================
-state AND(state a, state b) throw (UnknownState)
+state AND(state a, state b)
 { // AND
-	state c;
-
-	if ((a != low) && (a != high) && (a != indet))
-		throw UnknownState();
-	if ((b != low) && (b != high) && (b != indet))
-		throw UnknownState();
-
-	if ((a == low) || (b == low))
-		c = low;
-	else if ((a == high) && (b == high))
-		c = high;
-	else
-		c = indet;
-
-	return c;
+	return tblAND[a][b];
 }
 
 //========================
@@ -157,24 +122,15 @@ state AND(state a, state b) throw (UnknownState)
 //Parameters:
 //	state	a	-	logic value
 //Summary:
-//	This function performs (NOT a) and returns the result.
+//	This function performs (NOT a) and returns the result. I'm not driving
+//		this gate, so indet in = indet out. (True logic would demand
+//		indet in = high out.)
 //Returns:
 //	state	-	NOT a (logical inverse)
 //========================
-state NOT(state a) throw (UnknownState)
+state NOT(state a)
 { // Logical Inversion.
-	state b;
-
-	if (a == low)
-		b = high;
-	else if (a == high)
-		b = low;
-	else if (a == indet) // I'm not driving this gate. Indet in = Indet out.
-		b = indet;			// True logic would demand indet in = high out.
-	else
-		throw UnknownState();
-
-	return b;
+	return tblNOT[a];
 }
 
 
@@ -210,9 +166,7 @@ Gate::Gate(string tID, state def, int delay) throw (UnknownState, InvalidDelay)
 
 	output = NULL;
 
-	nTick = false;
-	mTick = false;
-	tTick = false;
+	stamp = 0; // epoch starts at 1, so a new gate is never "visited".
 }
 
 //========================
@@ -246,9 +200,7 @@ Gate&		Gate::operator= (const Gate &g)
 	this->output = g.output;
 	delete this->inputs;
 	this->inputs = new vector<Wire*>(*(g.inputs));
-	this->nTick = g.nTick;
-	this->mTick = g.mTick;
-	this->tTick = g.tTick;
+	this->stamp = g.stamp;
 
 	return *this;
 }
@@ -615,6 +567,26 @@ int			Gate::cntInputs()
 	return inputs->size();
 }
 
+//========================
+//Gate New Epoch
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Starts a new propagation pass. Every gate carries the epoch of the
+//		last pass that visited it, so a gate has already run this pass
+//		exactly when its stamp equals the current epoch. Bumping the
+//		counter "clears" every gate at once, with no reset traversal.
+//		Both tick and trace passes draw from the same counter, since
+//		they never interleave.
+//Returns:
+//	n/a
+//========================
+void	Gate::newEpoch()
+{
+	epoch++;
+}
+
 //========================
 //Gate Tick
 //========================
@@ -630,39 +602,32 @@ int			Gate::cntInputs()
 //Returns:
 //	n/a
 //========================
-void	Gate::tick(int ct) throw (BasicException)
+void	Gate::tick(int ct)
 {
-	debugMSG(LogicObj::getID() + getStateSnapshot() + " - ");
+	if (debug)
+		debugMSG(LogicObj::getID() + getStateSnapshot() + " - ");
 
-	if (output == NULL)
-		throw NoOutputException();
-
-	state tState = getState();
-
-	if ((tState != low) && (tState != high) && (tState != indet))
-		throw UnknownState();
-
-	if (nTick)
+	if (stamp == epoch)
 	{
-		// Don't rerun it if it's already been run. Don't call its dependencies either. They
-		// have already been called.
+		// Don't rerun it if it's already been run this pass. Don't call its dependencies
+		// either. They have already been called.
 		return;
 	}
 
 	// Call transform(true) if rerunning, e.g. ct <= getTime();
 	// Call transform(false) if not rerunning, e.g. ct > getTime();
+	// The output and inputs were checked once by Circuit::validate.
 
 	if (ct > LogicObj::getTime())
 	{
-		output->setCurrent(tState); // need to take end of stack first. Then
-									// perform transform to shift stack.
+		output->setCurrent(delayTable->back());	// need to take end of stack first. Then
+												// perform transform to shift stack.
 		this->transform(false);
 	}
 	else
 		this->transform(true);
 
-	nTick = true;
-	mTick = false;
+	stamp = epoch;
 
 	output->tick(ct); // Tick output object.
 
@@ -670,51 +635,42 @@ void	Gate::tick(int ct) throw (BasicException)
 }
 
 //========================
-//Gate Inverse Tick
+//Gate Input State
 //========================
 //Parameters:
-//	int	ct	-	the current time of the latest tick.
+//	int	idx	-	the index of the input wire to read
 //Summary:
-//	This function resets the various tick guards, so that each gate will
-//		be ready to run again next tick. Note that this function calls the
-//		itick of its output wire.
+//	Unchecked read of an input wire's current, for use by transform.
+//		Circuit::validate has already guaranteed the inputs exist.
 //Returns:
-//	n/a
+//	state	-	the current on input idx
 //========================
-void Gate::itick(int ct) throw (BasicException)
+state		Gate::inState(int idx)
 {
-	debugMSG(LogicObj::getID() + getStateSnapshot() + " + ");
-
-	if (mTick)
-		return;
-
-	mTick = true;
-	nTick = false;
-	tTick = false;
-
-	output->itick(ct);
-
-	LogicObj::itick(ct);
+	return (*inputs)[idx]->getCurrent();
 }
 
 //========================
-//Gate Transform (virtual, base level template)
+//Gate Push State
 //========================
 //Parameters:
-//	bool	r	-	whether or not this function is being rerun.
+//	state	a	-	the newly computed state
+//	bool	r	-	whether or not transform is being rerun
 //Summary:
-//	This is the most basic shared functionality between all the various
-//		Gate derivatives. Note that this is solely exception handling.
+//	Unchecked edition of setState/modState for use by transform: a first
+//		run shifts a onto the delay table, a rerun replaces the front.
 //Returns:
 //	n/a
 //========================
-void	Gate::transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState)
+void		Gate::pushState(state a, bool r)
 {
-	if (output == NULL)
-		throw NoOutputException();
-
-	if (inputs->size() == 0)
-		throw NoInputsException();
+	if (r)
+		delayTable->front() = a;
+	else
+	{
+		delayTable->push_front(a); // add to front and remove from back.
+		delayTable->pop_back();
+	}
 }
 
 //========================
@@ -730,19 +686,18 @@ void	Gate::transform(bool r) throw (NoInputsException, NoOutputException, NullPo
 //		biggest is returned. Note that for functional consistency (and
 //		since this is a virtual function) the parent LogicObj function
 //		is also called. Note also that trace is only called once per
-//		function per trace execution. Trace's retrace preventer is reset
-//		by itick(int ct).
+//		gate per trace pass; the caller starts each pass with newEpoch().
 //Returns:
 //	int	-	the new biggest pathway length
 //========================
 int		Gate::trace(int oB) throw (BasicException)
 {
-	if (tTick)
+	if (stamp == epoch)
 		return oB;
 
 	int big = oB + getDelaySize();
 
-	tTick = true;
+	stamp = epoch;
 
 	int t = getOutput()->trace(big);
 
@@ -778,24 +733,29 @@ logicNOT::logicNOT(string tID, state def, int delay) throw (UnknownState, Invali
 //Returns:
 //	n/a
 //========================
-void	logicNOT::transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState)
+void	logicNOT::transform(bool r)
 {
-	Gate::transform(r);	//	Parent function called first, as it contains global
-						//		features.
-
-	state ttState = Gate::getInput(0)->getCurrent(); // only cares about one input.
-
-	if ((ttState != low) && (ttState != high) && (ttState != indet))
-		throw UnknownState();
+	state ttState = NOT(Gate::inState(0)); // only cares about one input.
 
-	ttState = NOT(ttState);
+	Gate::pushState(ttState, r);
 
-	if (r)
-		Gate::modState(ttState);
-	else
-		Gate::setState(ttState);
+	if (debug)
+		debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+}
 
-	debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+//========================
+//Logic NOT Type
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Identifies this Gate as a NOT gate.
+//Returns:
+//	gateType	-	gNOT
+//========================
+gateType	logicNOT::getType()
+{
+	return gNOT;
 }
 
 //========================
@@ -824,41 +784,32 @@ logicAND::logicAND(string tID, state def, int delay) throw (UnknownState, Invali
 //Returns:
 //	n/a
 //========================
-void	logicAND::transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState)
+void	logicAND::transform(bool r)
 {
-	Gate::transform(r);
-
-	if (Gate::cntInputs() < 2)		// need at least two inputs.
-		throw NoInputsException();
+	state tStateF = Gate::inState(0);
 
-	state tState1 = Gate::getInput(0)->getCurrent();
-	if ((tState1 != low) && (tState1 != high) && (tState1 != indet))
-		throw UnknownState();
-
-	state tState2 = Gate::getInput(1)->getCurrent();
-	if ((tState2 != low) && (tState2 != high) && (tState2 != indet))
-		throw UnknownState();
+	for (int ktS = 1; ktS < Gate::cntInputs(); ktS++) // Associative. Take past Final, and AND with
+		tStateF = AND(tStateF, Gate::inState(ktS));		// new input.
 
-	state tStateF = AND(tState1, tState2);
+	Gate::pushState(tStateF, r);
 
-	state tState3;
-
-	for (int ktS = 2; ktS < Gate::cntInputs(); ktS++) // Associative. Take past Final, and AND with
-	{													// new input.
-		tState3 = Gate::getInput(ktS)->getCurrent();
-
-		if ((tState3 != low) && (tState3 != high) && (tState3 != indet))
-			throw UnknownState();
-
-		tStateF = AND(tStateF, tState3);
-	}
-
-	if (r)
-		Gate::modState(tStateF);
-	else
-		Gate::setState(tStateF);
+	if (debug)
+		debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+}
 
-	debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+//========================
+//Logic AND Type
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Identifies this Gate as a AND gate.
+//Returns:
+//	gateType	-	gAND
+//========================
+gateType	logicAND::getType()
+{
+	return gAND;
 }
 
 //========================
@@ -887,41 +838,32 @@ logicOR::logicOR(string tID, state def, int delay) throw (UnknownState, InvalidD
 //Returns:
 //	n/a
 //========================
-void	logicOR::transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState)
+void	logicOR::transform(bool r)
 {
-	Gate::transform(r);
-
-	if (Gate::cntInputs() < 2)		// need at least two inputs.
-		throw NoInputsException();
-
-	state tState1 = Gate::getInput(0)->getCurrent();
-	if ((tState1 != low) && (tState1 != high) && (tState1 != indet))
-		throw UnknownState();
-
-	state tState2 = Gate::getInput(1)->getCurrent();
-	if ((tState2 != low) && (tState2 != high) && (tState2 != indet))
-		throw UnknownState();
-
-	state tStateF = OR(tState1, tState2);
-
-	state tState3;
-
-	for (int ktS = 2; ktS < Gate::cntInputs(); ktS++)
-	{
-		tState3 = Gate::getInput(ktS)->getCurrent();
+	state tStateF = Gate::inState(0);
 
-		if ((tState3 != low) && (tState3 != high) && (tState3 != indet))
-			throw UnknownState();
+	for (int ktS = 1; ktS < Gate::cntInputs(); ktS++)
+		tStateF = OR(tStateF, Gate::inState(ktS));
 
-		tStateF = OR(tStateF, tState3);
-	}
+	Gate::pushState(tStateF, r);
 
-	if (r)
-		Gate::modState(tStateF);
-	else
-		Gate::setState(tStateF);
+	if (debug)
+		debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+}
 
-	debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+//========================
+//Logic OR Type
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Identifies this Gate as a OR gate.
+//Returns:
+//	gateType	-	gOR
+//========================
+gateType	logicOR::getType()
+{
+	return gOR;
 }
 
 //========================
@@ -950,41 +892,32 @@ logicNAND::logicNAND(string tID, state def, int delay) throw (UnknownState, Inva
 //Returns:
 //	n/a
 //========================
-void	logicNAND::transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState)
+void	logicNAND::transform(bool r)
 {
-	Gate::transform(r);
-
-	if (Gate::cntInputs() < 2)		// need at least two inputs.
-		throw NoInputsException();
+	state tStateF = Gate::inState(0);
 
-	state tState1 = Gate::getInput(0)->getCurrent();
-	if ((tState1 != low) && (tState1 != high) && (tState1 != indet))
-		throw UnknownState();
+	for (int ktS = 1; ktS < Gate::cntInputs(); ktS++)
+		tStateF = AND(tStateF, Gate::inState(ktS));
 
-	state tState2 = Gate::getInput(1)->getCurrent();
-	if ((tState2 != low) && (tState2 != high) && (tState2 != indet))
-		throw UnknownState();
+	Gate::pushState(NOT(tStateF), r);	// Logical Inverse of AND gate.
 
-	state tStateF = AND(tState1, tState2);
-
-	state tState3;
-
-	for (int ktS = 2; ktS < Gate::cntInputs(); ktS++)
-	{
-		tState3 = Gate::getInput(ktS)->getCurrent();
-
-		if ((tState3 != low) && (tState3 != high) && (tState3 != indet))
-			throw UnknownState();
-
-		tStateF = AND(tStateF, tState3);
-	}
-
-	if (r)
-		Gate::modState(NOT(tStateF)); // Logical Inverse of AND gate.
-	else
-		Gate::setState(NOT(tStateF));
+	if (debug)
+		debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+}
 
-	debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+//========================
+//Logic NAND Type
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Identifies this Gate as a NAND gate.
+//Returns:
+//	gateType	-	gNAND
+//========================
+gateType	logicNAND::getType()
+{
+	return gNAND;
 }
 
 //========================
@@ -1013,41 +946,32 @@ logicNOR::logicNOR(string tID, state def, int delay) throw (UnknownState, Invali
 //Returns:
 //	n/a
 //========================
-void	logicNOR::transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState)
+void	logicNOR::transform(bool r)
 {
-	Gate::transform(r);
-
-	if (Gate::cntInputs() < 2)		// need at least two inputs.
-		throw NoInputsException();
-
-	state tState1 = Gate::getInput(0)->getCurrent();
-	if ((tState1 != low) && (tState1 != high) && (tState1 != indet))
-		throw UnknownState();
+	state tStateF = Gate::inState(0);
 
-	state tState2 = Gate::getInput(1)->getCurrent();
-	if ((tState2 != low) && (tState2 != high) && (tState2 != indet))
-		throw UnknownState();
-
-	state tStateF = OR(tState1, tState2);
+	for (int ktS = 1; ktS < Gate::cntInputs(); ktS++)
+		tStateF = OR(tStateF, Gate::inState(ktS));
 
-	state tState3;
-
-	for (int ktS = 2; ktS < Gate::cntInputs(); ktS++)
-	{
-		tState3 = Gate::getInput(ktS)->getCurrent();
+	Gate::pushState(NOT(tStateF), r);	// Logical Inverse of OR gate.
 
-		if ((tState3 != low) && (tState3 != high) && (tState3 != indet))
-			throw UnknownState();
-
-		tStateF = OR(tStateF, tState3);
-	}
-
-	if (r)
-		Gate::modState(NOT(tStateF)); // Logical Inverse of AND gate.
-	else
-		Gate::setState(NOT(tStateF));
+	if (debug)
+		debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+}
 
-	debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+//========================
+//Logic NOR Type
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Identifies this Gate as a NOR gate.
+//Returns:
+//	gateType	-	gNOR
+//========================
+gateType	logicNOR::getType()
+{
+	return gNOR;
 }
 
 //========================
@@ -1076,41 +1000,32 @@ logicXOR::logicXOR(string tID, state def, int delay) throw (UnknownState, Invali
 //Returns:
 //	n/a
 //========================
-void	logicXOR::transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState)
+void	logicXOR::transform(bool r)
 {
-	Gate::transform(r);
-
-	if (Gate::cntInputs() < 2)		// need at least two inputs.
-		throw NoInputsException();
-
-	state tState1 = Gate::getInput(0)->getCurrent();
-	if ((tState1 != low) && (tState1 != high) && (tState1 != indet))
-		throw UnknownState();
-
-	state tState2 = Gate::getInput(1)->getCurrent();
-	if ((tState2 != low) && (tState2 != high) && (tState2 != indet))
-		throw UnknownState();
-
-	state tStateF = XOR(tState1, tState2);
-
-	state tState3;
+	state tStateF = Gate::inState(0);
 
-	for (int ktS = 2; ktS < Gate::cntInputs(); ktS++)
-	{
-		tState3 = Gate::getInput(ktS)->getCurrent();
-
-		if ((tState3 != low) && (tState3 != high) && (tState3 != indet))
-			throw UnknownState();
+	for (int ktS = 1; ktS < Gate::cntInputs(); ktS++)
+		tStateF = XOR(tStateF, Gate::inState(ktS));
 
-		tStateF = XOR(tStateF, tState3);
-	}
+	Gate::pushState(tStateF, r);
 
-	if (r)
-		Gate::modState(tStateF);
-	else
-		Gate::setState(tStateF);
+	if (debug)
+		debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+}
 
-	debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+//========================
+//Logic XOR Type
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Identifies this Gate as a XOR gate.
+//Returns:
+//	gateType	-	gXOR
+//========================
+gateType	logicXOR::getType()
+{
+	return gXOR;
 }
 
 //========================
@@ -1139,39 +1054,30 @@ logicXNOR::logicXNOR(string tID, state def, int delay) throw (UnknownState, Inva
 //Returns:
 //	n/a
 //========================
-void	logicXNOR::transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState)
+void	logicXNOR::transform(bool r)
 {
-	Gate::transform(r);
-
-	if (Gate::cntInputs() < 2)		// need at least two inputs.
-		throw NoInputsException();
-
-	state tState1 = Gate::getInput(0)->getCurrent();
-	if ((tState1 != low) && (tState1 != high) && (tState1 != indet))
-		throw UnknownState();
-
-	state tState2 = Gate::getInput(1)->getCurrent();
-	if ((tState2 != low) && (tState2 != high) && (tState2 != indet))
-		throw UnknownState();
+	state tStateF = Gate::inState(0);
 
-	state tStateF = XOR(tState1, tState2);
+	for (int ktS = 1; ktS < Gate::cntInputs(); ktS++)
+		tStateF = XOR(tStateF, Gate::inState(ktS));
 
-	state tState3;
-
-	for (int ktS = 2; ktS < Gate::cntInputs(); ktS++)
-	{
-		tState3 = Gate::getInput(ktS)->getCurrent();
-
-		if ((tState3 != low) && (tState3 != high) && (tState3 != indet))
-			throw UnknownState();
-
-		tStateF = XOR(tStateF, tState3);
-	}
+	Gate::pushState(NOT(tStateF), r);	// Logical Inverse of XOR gate.
 
-	if (r)
-		Gate::modState(NOT(tStateF)); // Logical Inverse of XOR gate.
-	else
-		Gate::setState(NOT(tStateF));
+	if (debug)
+		debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
+}
 
-	debugMSG(Gate::getID() + ": " + Gate::getStateSnapshot());
-}
\ No newline at end of file
+//========================
+//Logic XNOR Type
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Identifies this Gate as a XNOR gate.
+//Returns:
+//	gateType	-	gXNOR
+//========================
+gateType	logicXNOR::getType()
+{
+	return gXNOR;
+}
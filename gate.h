@@ -19,11 +19,16 @@
 
 using namespace std;
 
-state XOR(state a, state b) throw (UnknownState);
-state XNOR(state a, state b) throw (UnknownState);
-state OR(state a, state b) throw (UnknownState);
-state AND(state a, state b) throw (UnknownState);
-state NOT(state a) throw (UnknownState);
+// Gate kinds, for code that works from a compiled copy of the netlist
+// rather than the Gate objects themselves. See Gate::getType(). gLUT
+// exists only in a compiled netlist; see Netlist::collapse().
+enum gateType {gAND, gOR, gNOT, gNAND, gNOR, gXOR, gXNOR, gLUT};
+
+state XOR(state a, state b);
+state XNOR(state a, state b);
+state OR(state a, state b);
+state AND(state a, state b);
+state NOT(state a);
 
 //==================================
 //Class:	Gate
@@ -32,8 +37,9 @@ state NOT(state a) throw (UnknownState);
 //Description:
 //	The Gate class is the parent class for all the Gate derivatives and
 //		provides a full-featured function set for all Gate behaviors, as
-//		well as basic global instantiations of the tick, itick, trace, and
-//		transform virtual functions.
+//		well as basic global instantiations of the tick and trace virtual
+//		functions; transform is left to each derivative. Visitation during
+//		a propagation pass is tracked with an epoch stamp; see newEpoch().
 //==================================
 class Gate : public LogicObj
 {
@@ -62,10 +68,17 @@ public:
 	void		clrInputs();
 	int			cntInputs();
 
-virtual void	tick(int ct) throw (BasicException);
-virtual	void	itick(int ct) throw (BasicException);
+virtual void	tick(int ct);
 virtual int		trace(int oB) throw (BasicException);
-virtual void	transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState);
+virtual void	transform(bool r) = 0;
+virtual gateType	getType() = 0;
+
+static void		newEpoch();
+
+protected:
+
+	state		inState(int idx);
+	void		pushState(state a, bool r);
 
 private:
 
@@ -75,9 +88,9 @@ list<state>*	delayTable;
 	Wire*		output;
 vector<Wire*>*	inputs;
 
-	bool		nTick;
-	bool		mTick;
-	bool		tTick;
+unsigned long	stamp;
+
+static unsigned long	epoch;
 };
 
 //==================================
@@ -95,7 +108,8 @@ class logicOR : public Gate
 public:
 					logicOR(string tID, state def, int delay) throw (UnknownState, InvalidDelay, NullPointerException);
 
-	virtual void	transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState);
+	virtual void	transform(bool r);
+	virtual gateType	getType();
 };
 
 //==================================
@@ -113,7 +127,8 @@ class logicAND : public Gate
 public:
 					logicAND(string tID, state def, int delay) throw (UnknownState, InvalidDelay, NullPointerException);
 
-	virtual void	transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState);
+	virtual void	transform(bool r);
+	virtual gateType	getType();
 };
 
 //==================================
@@ -131,7 +146,8 @@ class logicNOT : public Gate
 public:
 					logicNOT(string tID, state def, int delay) throw (UnknownState, InvalidDelay, NullPointerException);
 
-	virtual void	transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState);
+	virtual void	transform(bool r);
+	virtual gateType	getType();
 };
 
 //==================================
@@ -149,7 +165,8 @@ class logicNAND : public Gate
 public:
 					logicNAND(string tID, state def, int delay) throw (UnknownState, InvalidDelay, NullPointerException);
 
-	virtual void	transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState);
+	virtual void	transform(bool r);
+	virtual gateType	getType();
 };
 
 //==================================
@@ -167,7 +184,8 @@ class logicNOR : public Gate
 public:
 					logicNOR(string tID, state def, int delay) throw (UnknownState, InvalidDelay, NullPointerException);
 
-	virtual void	transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState);
+	virtual void	transform(bool r);
+	virtual gateType	getType();
 };
 
 //==================================
@@ -185,7 +203,8 @@ class logicXOR : public Gate
 public:
 					logicXOR(string tID, state def, int delay) throw (UnknownState, InvalidDelay, NullPointerException);
 
-	virtual void	transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState);
+	virtual void	transform(bool r);
+	virtual gateType	getType();
 };
 
 //==================================
@@ -203,7 +222,8 @@ class logicXNOR : public Gate
 public:
 					logicXNOR(string tID, state def, int delay) throw (UnknownState, InvalidDelay, NullPointerException);
 
-	virtual void	transform(bool r) throw (NoInputsException, NoOutputException, NullPointerException, UnknownState);
+	virtual void	transform(bool r);
+	virtual gateType	getType();
 };
 
 
@@ -0,0 +1,571 @@
+//================================================================
+//Filename:		Circuit and Vector File Loader Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Reads circuit and vector files into the logic object
+//					graph. This is the parsing half of the original
+//					ApiMain, pulled out so the batch front end can load
+//					files the same way the interactive program does.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <list>
+#include <string>
+#include <iostream>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <queue>
+#include <functional>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "loader.h"
+#include "binVector.h"
+
+using namespace std;
+
+// See Implementation
+static Wire*	findWire(Circuit *crc, string wName) throw (BasicException);
+
+// An INPUT line held for sorting: (time, line number) then "pad state".
+typedef pair<pair<int, long>, string>	sortRec;
+
+// Longest pad name or state sortVector accepts, for its scratch files.
+#define SORT_ID		255
+
+//========================
+//Find or Create Wire
+//========================
+//Parameters:
+//	Circuit	*crc	-	the circuit being built
+//	string	wName	-	the wire's name in the circuit file
+//Summary:
+//	Wires are created the first time a circuit file mentions them;
+//		later mentions return the same Wire.
+//Returns:
+//	Wire*	-	the named wire
+//========================
+static Wire*	findWire(Circuit *crc, string wName) throw (BasicException)
+{
+	Wire* t = NULL;
+
+	try
+	{
+		t = (Wire*) crc->getLogicObj(wName);
+	}
+	catch (ElementNotFound e) // It's not already in the circuit
+	{
+		t = new Wire(wName, indet);
+		crc->addLogicObj(t);
+	}
+
+	if (t == NULL)
+		throw NullPointerException();
+
+	return t;
+}
+
+//========================
+//Parse Time
+//========================
+//Parameters:
+//	string	tT	-	a time or delay, with or without an "ns" suffix
+//Summary:
+//	Converts a circuit or vector file time field to nanoseconds.
+//Returns:
+//	int	-	the time in nanoseconds
+//========================
+int			parseTime(string tT)
+{
+	if ((tT.size() > 0) && (tT.substr(tT.size() - 1, 1) == "s")) // has ns
+		tT = tT.substr(0, tT.size() - 2);
+
+	return atoi(tT.c_str());
+}
+
+//========================
+//Parse State
+//========================
+//Parameters:
+//	string	tS	-	a state field from a vector file
+//Summary:
+//	Converts 0, 1, and 2/X/x to low, high and indet.
+//Returns:
+//	state	-	the state named by tS
+//========================
+state		parseState(string tS) throw (UnknownState)
+{
+	if (tS == "0")
+		return low;
+	else if (tS == "1")
+		return high;
+	else if ((tS == "2") || (tS == "X") || (tS == "x"))
+		return indet;
+	else
+		throw UnknownState();
+}
+
+//========================
+//Load Circuit
+//========================
+//Parameters:
+//	istream	&in	-	an open circuit file
+//Summary:
+//	Builds a Circuit from a circuit file -- pads, wires, and gates, each
+//		piece building on the pieces around it. See README for the format.
+//Returns:
+//	Circuit*	-	the new circuit (not yet validated)
+//========================
+Circuit*	loadCircuit(istream &in) throw (BasicException)
+{
+	Circuit* crc = NULL;
+
+	string CMD;
+
+	while (!(in.eof()))
+	{
+		CMD = "";
+
+		in >> CMD;
+
+		if ((CMD == "") || in.eof()) // Final Blank line or EOF
+			break;
+
+		if (CMD == "CIRCUIT") // Create a new circuit.
+		{
+			string tname;
+			in >> tname;
+
+			if (tname == "")
+				throw NullIDException();
+
+			crc = new Circuit(tname);
+		}
+		else if (CMD == "INPUT") // Input Pad
+		{
+			string tname;
+			string wName;
+			in >> tname >> wName;
+
+			if (crc == NULL)
+				throw NullPointerException();
+
+			Wire* t = findWire(crc, wName);
+
+			iPad* tPad = new iPad(tname, indet);
+
+			tPad->setIO(t);		// Link the Wire and the Pad.
+			t->setInput(tPad);
+
+			crc->addiPad(tPad);
+		}
+		else if (CMD == "OUTPUT") // Output Pad
+		{
+			string tname;
+			string wName;
+			in >> tname >> wName;
+
+			if (crc == NULL)
+				throw NullPointerException();
+
+			Wire* t = findWire(crc, wName);
+
+			oPad* tPad = new oPad(tname, indet);
+
+			tPad->setIO(t);		// Link the wire and the Pad
+			t->addOutput(tPad);
+
+			crc->addoPad(tPad);
+		}
+		else
+		{ // It's a gate
+			if (crc == NULL)
+				throw NullPointerException();
+
+			Gate*	gt = NULL;
+
+			string	tdly;
+			string	twi1;
+			string	twi2;
+			string	two;
+
+			in >> tdly;
+
+			int tdly2 = parseTime(tdly);
+
+			if (tdly2 <= 0) // avoid invalid delay.
+				tdly2 = 1;
+
+			string tID = CMD;	// ID will be constructed.
+
+			// Single input
+			if (CMD == "NOT" || CMD == "INVERTER" || CMD == "INV")
+			{
+				in >> twi1 >> two;
+
+				tID = tID.append(twi1).append(two); // ID is generated by GateType[W][W].
+
+				Wire* wi1 = findWire(crc, twi1);
+				Wire* wo = findWire(crc, two);
+
+				gt = new logicNOT(tID, indet, tdly2);
+
+				crc->addLogicObj(gt);
+
+				gt->setOutput(wo);	// Link the Gate with its wires.
+				wo->setInput(gt);
+				gt->addInput(wi1);
+				wi1->addOutput(gt);
+				//Done making Gate
+			}
+			else
+			{
+				in >> twi1 >> twi2 >> two;
+
+				tID = tID.append(twi1).append(twi2).append(two); // see above.
+
+				Wire* wi1 = findWire(crc, twi1);
+				Wire* wi2 = findWire(crc, twi2);
+				Wire* wo = findWire(crc, two);
+
+				//Evaluate for Gate Type and create it.
+				if (CMD == "OR")
+					gt = new logicOR(tID, indet, tdly2);
+				else if (CMD == "AND")
+					gt = new logicAND(tID, indet, tdly2);
+				else if (CMD == "NAND")
+					gt = new logicNAND(tID, indet, tdly2);
+				else if (CMD == "NOR")
+					gt = new logicNOR(tID, indet, tdly2);
+				else if (CMD == "XOR")
+					gt = new logicXOR(tID, indet, tdly2);
+				else if (CMD == "XNOR")
+					gt = new logicXNOR(tID, indet, tdly2);
+				else
+					throw BasicException("Invalid Gate Type.");
+
+				crc->addLogicObj(gt);
+
+				gt->setOutput(wo);	//Link the Gate with its wires.
+				gt->addInput(wi1);
+				gt->addInput(wi2);
+
+				wo->setInput(gt);	//And the wires to the Gate.
+				wi1->addOutput(gt);
+				wi2->addOutput(gt);
+				//Done making Gate
+			}
+		}
+	}
+
+	if (crc == NULL)
+		throw NullPointerException();
+
+	return crc;
+}
+
+//========================
+//New Vector
+//========================
+//Parameters:
+//	Circuit	*crc	-	the circuit the vector is for
+//	string	tID		-	the vector's ID
+//Summary:
+//	Creates an empty Vector with a PadState for each iPad and oPad in the
+//		circuit, as a VECTOR line does. The circuit is not changed.
+//Returns:
+//	Vector*	-	the new vector
+//========================
+Vector*		newVector(Circuit *crc, string tID) throw (BasicException)
+{
+	if (crc == NULL)
+		throw NullPointerException();
+
+	Vector* tVec = new Vector(tID);
+
+	// loop through and create a PadState for each iPad and oPad in the circuit.
+
+	for (int ipa = 0; ipa < crc->cntiPads(); ipa++)
+	{
+		iPadState *tpi = new iPadState(crc->getiPad(ipa)->getID(), indet, crc->getiPad(ipa));
+		tVec->addPadState(tpi);
+	}
+
+	for (int opa = 0; opa < crc->cntoPads(); opa++)
+	{
+		oPadState *tpo = new oPadState(crc->getoPad(opa)->getID(), indet, crc->getoPad(opa));
+		tVec->addPadState(tpo);
+	}
+
+	return tVec;
+}
+
+//========================
+//Load Vector
+//========================
+//Parameters:
+//	Circuit	*crc	-	the circuit the vector drives
+//	istream	&in		-	an open vector file
+//Summary:
+//	Builds a Vector holding a PadState for every pad in crc, then records
+//		each INPUT transition of the vector file in its pad's history.
+//		Binary vector files are handed to loadBinaryVector.
+//Returns:
+//	n/a
+//========================
+void		loadVector(Circuit *crc, istream &in) throw (BasicException)
+{
+	if (crc == NULL)
+		throw NullPointerException();
+
+	if (isBinaryVector(in))
+	{
+		loadBinaryVector(crc, in);
+		return;
+	}
+
+	string CMD;
+
+	while (!(in.eof()))
+	{
+		CMD = "";
+
+		in >> CMD;
+
+		if ((CMD == "") || (in.eof()))
+			break;
+
+		if (CMD == "VECTOR") // Create a new vector.
+		{
+			string tID;
+
+			in >> tID;
+
+			if (tID == "")
+				throw NullIDException();
+
+			crc->setVector(newVector(crc, tID)); // set the current circuit's Vector to the new Vector.
+		}
+		else if (CMD == "INPUT")	// An input change!
+		{
+			string tID;
+			string tdly;
+			string State;
+
+			in >> tID >> tdly >> State;
+
+			int tdly2 = parseTime(tdly);
+
+			if (tdly2 < 0) // avoid invalid delay.
+				tdly2 = 0;
+
+			state State2 = parseState(State);
+
+			if (crc->getVector() == NULL)	// Circuit has Vector
+				throw NullPointerException();
+
+			PadState *tPS = NULL;
+
+			try // There should already be a padstate for this input vector.
+			{
+				tPS = crc->getVector()->getPadState(tID);
+			}
+			catch (ElementNotFound e)
+			{
+				throw BasicException("Vector definitions do not match with circuit definitions.");
+			}
+
+			tPS->addState(State2, tdly2);	// Add a new condition.
+		}
+		else
+			throw BasicException("Unrecognized vector file command.");
+	}
+
+	if (crc->getVector() == NULL)
+		throw BasicException("Vector is undefined.");
+}
+
+//========================
+//Write Sorted Run
+//========================
+//Parameters:
+//	vector<sortRec>	&recs	-	the records read so far; emptied
+//	vector<FILE*>	&runs	-	receives the new run's scratch file
+//Summary:
+//	Sorts one memory load of INPUT lines and writes it to a scratch file
+//		as "time line pad state" lines, for sortVector to merge.
+//Returns:
+//	n/a
+//========================
+static void	writeRun(vector<sortRec> &recs, vector<FILE*> &runs) throw (BasicException)
+{
+	FILE* f = tmpfile();
+
+	if (f == NULL)
+		throw BasicException("Unable to create a scratch file for sorting.");
+
+	sort(recs.begin(), recs.end());
+
+	for (int r = 0; r < recs.size(); r++)
+		fprintf(f, "%d %ld %s\n", recs[r].first.first, recs[r].first.second, recs[r].second.c_str());
+
+	if ((fflush(f) != 0) || ferror(f))
+	{
+		fclose(f);
+		throw BasicException("Unable to write a scratch file for sorting.");
+	}
+
+	rewind(f);
+	runs.push_back(f);
+	recs.clear();
+}
+
+//========================
+//Read Sorted Run
+//========================
+//Parameters:
+//	FILE	*f	-	a scratch file from writeRun
+//	sortRec	&r	-	receives its next record
+//Summary:
+//	Reads the next record of a sorted run.
+//Returns:
+//	bool	-	false at the end of the run
+//========================
+static bool	readRun(FILE *f, sortRec &r)
+{
+	char	id[SORT_ID + 1];
+	char	st[SORT_ID + 1];
+
+	if (fscanf(f, "%d %ld %255s %255s", &r.first.first, &r.first.second, id, st) != 4)
+		return false;
+
+	r.second = string(id) + " " + st;
+
+	return true;
+}
+
+//========================
+//Sort Vector
+//========================
+//Parameters:
+//	istream	&in		-	an open vector file, in any order
+//	ostream	&out	-	receives the same vector, sorted by time
+//	long	runLen	-	INPUT lines to hold in memory at once
+//Summary:
+//	An external merge sort for vector files too big to sort in memory.
+//		INPUT lines are read runLen at a time, sorted, and written to
+//		scratch files; the scratch files are then merged into out, after
+//		the VECTOR line. Lines with equal times keep their file order, so
+//		where a pad is given two states at the same time the later line
+//		still wins. Memory use is runLen lines plus one per scratch file.
+//		Sorting does change what an out of order file means: loadVector
+//		writes a late line for an earlier time over that one nanosecond
+//		only, while a sorted file holds each state until the next line.
+//Returns:
+//	n/a
+//========================
+void		sortVector(istream &in, ostream &out, long runLen) throw (BasicException)
+{
+	if (runLen < 1)
+		throw BasicException("Sort must hold at least one line.");
+
+	vector<sortRec>	recs;
+	vector<FILE*>	runs;
+	string			CMD;
+	string			name = "";
+	long			line = 0;
+
+	try
+	{
+		while (!(in.eof()))
+		{
+			CMD = "";
+
+			in >> CMD;
+
+			if ((CMD == "") || (in.eof()))
+				break;
+
+			if (CMD == "VECTOR")
+			{
+				in >> name;
+
+				if (name == "")
+					throw NullIDException();
+			}
+			else if (CMD == "INPUT")
+			{
+				string tID;
+				string tdly;
+				string State;
+
+				in >> tID >> tdly >> State;
+
+				int tdly2 = parseTime(tdly);
+
+				if (tdly2 < 0) // avoid invalid delay.
+					tdly2 = 0;
+
+				parseState(State); // reject bad states here, not mid-merge.
+
+				if ((tID.size() > SORT_ID) || (State.size() > SORT_ID))
+					throw BasicException("Vector file name too long to sort.");
+
+				recs.push_back(sortRec(pair<int, long>(tdly2, line++), tID + " " + State));
+
+				if (recs.size() >= runLen)
+					writeRun(recs, runs);
+			}
+			else
+				throw BasicException("Unrecognized vector file command.");
+		}
+
+		if (name == "")
+			throw BasicException("Vector is undefined.");
+
+		if (!recs.empty())
+			writeRun(recs, runs);
+
+		out << "VECTOR " << name << "\n";
+
+		priority_queue< pair<pair<int, long>, int>, vector< pair<pair<int, long>, int> >,
+			greater< pair<pair<int, long>, int> > > next;
+
+		vector<sortRec> head(runs.size());
+
+		for (int r = 0; r < runs.size(); r++)
+		{
+			if (readRun(runs[r], head[r]))
+				next.push(pair<pair<int, long>, int>(head[r].first, r));
+		}
+
+		while (!next.empty())
+		{
+			int r = next.top().second;
+
+			next.pop();
+
+			int sp = head[r].second.find(' ');
+
+			out << "INPUT\t" << head[r].second.substr(0, sp) << "\t" << head[r].first.first
+				<< "\t" << head[r].second.substr(sp + 1) << "\n";
+
+			if (readRun(runs[r], head[r]))
+				next.push(pair<pair<int, long>, int>(head[r].first, r));
+		}
+	}
+	catch(BasicException e)
+	{
+		for (int r = 0; r < runs.size(); r++)
+			fclose(runs[r]);
+
+		throw;
+	}
+
+	for (int r = 0; r < runs.size(); r++)
+		fclose(runs[r]);
+}
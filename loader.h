@@ -0,0 +1,43 @@
+#ifndef LOADER_H
+#define LOADER_H
+
+//================================================================
+//Filename:		Circuit and Vector File Loader Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Prototypes for the routines that read circuit and
+//					vector files into Circuit, Vector and PadState
+//					objects. Shared by the interactive program and the
+//					batch front end.
+//Revisions:
+//
+//================================================================
+
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+
+using namespace std;
+
+// See Implementation
+Circuit*	loadCircuit(istream &in) throw (BasicException);
+
+// See Implementation
+Vector*		newVector(Circuit *crc, string tID) throw (BasicException);
+
+// See Implementation
+void		loadVector(Circuit *crc, istream &in) throw (BasicException);
+
+// See Implementation
+void		sortVector(istream &in, ostream &out, long runLen) throw (BasicException);
+
+// See Implementation
+state		parseState(string tS) throw (UnknownState);
+
+// See Implementation
+int			parseTime(string tT);
+
+#endif //LOADER_H
@@ -111,7 +111,7 @@ void	LogicObj::clrTime()
 //Returns:
 //	n/a
 //========================
-void	LogicObj::tick(int ct) throw (BasicException)
+void	LogicObj::tick(int ct)
 {
 	if (ct == time)
 		return;
@@ -121,19 +121,6 @@ void	LogicObj::tick(int ct) throw (BasicException)
 		time = ct;
 }
 
-//========================
-//Logic Object Inverse Tick
-//========================
-//Parameters:
-//	int	ct	-	the circuit's current time
-//Summary:
-//	Empty Function.
-//Returns:
-//	n/a
-//========================
-void	LogicObj::itick(int ct) throw (BasicException)
-{}
-
 //========================
 //Logic Object Trace
 //========================
@@ -234,26 +221,11 @@ void	Connection::resetCurrent()
 //Returns:
 //	n/a
 //========================
-void	Connection::tick(int ct) throw (BasicException)
+void	Connection::tick(int ct)
 {
 	LogicObj::tick(ct);
 }
 
-//========================
-//Connection Inverse Tick
-//========================
-//Parameters:
-//	int	ct	-	circuit time.
-//Summary:
-//	Wrapper. See LogicObj::itick and derived classes ::itick.
-//Returns:
-//	n/a
-//========================
-void	Connection::itick(int ct) throw (BasicException)
-{
-	LogicObj::itick(ct);
-}
-
 //========================
 //Connection Trace
 //========================
@@ -532,12 +504,13 @@ LogicObj*	Wire::getOutput(int idx) throw (IndexOutOfBounds)
 //Returns:
 //	n/a
 //========================
-void	Wire::tick(int ct) throw (BasicException)
+void	Wire::tick(int ct)
 {
 	//Wire is a very simple device. It merely calls the tick() function of its outputs.
 	//	Nothing fancy here.
 
-	debugMSG(LogicObj::getID() + " - ");
+	if (debug)
+		debugMSG(LogicObj::getID() + " - ");
 
 	vector<LogicObj*>::iterator oI = outputs->begin();
 
@@ -550,31 +523,6 @@ void	Wire::tick(int ct) throw (BasicException)
 	Connection::tick(ct);
 }
 
-//========================
-//Wire Inverse Tick
-//========================
-//Parameters:
-//	int	ct	-	circuit time
-//Summary:
-//	This function loops through all its outputs and calls the itick of each.
-//Returns:
-//	n/a
-//========================
-void Wire::itick(int ct) throw (BasicException)
-{
-	debugMSG(LogicObj::getID() + " + ");
-
-	vector<LogicObj*>::iterator oI = outputs->begin();
-
-	while (oI != outputs->end())
-	{
-		(*oI)->itick(ct);
-		oI++;
-	}
-
-	Connection::itick(ct);
-}
-
 //========================
 //Wire Trace
 //========================
@@ -665,26 +613,11 @@ Wire*	Pad::getIO()
 //Returns:
 //	n/a
 //========================
-void	Pad::tick(int ct) throw (BasicException)
+void	Pad::tick(int ct)
 {
 	Connection::tick(ct);
 }
 
-//========================
-//Pad Inverse Tick
-//========================
-//Parameters:
-//	int ct	-	circuit time
-//Summary:
-//	Wrapper function. See Connection::tick and derivative classes :: tick
-//Returns:
-//	n/a
-//========================
-void Pad::itick(int ct) throw (BasicException)
-{
-	Connection::itick(ct);
-}
-
 //========================
 //Pad Trace
 //========================
@@ -722,48 +655,24 @@ iPad::iPad(string tID, state def) throw (NullIDException, UnknownState) :
 //	int	ct	-	circuit time
 //Summary:
 //	This function sets the Pad's output Wire's state to that held by the Pad.
+//		The Pad's wiring is checked once by Circuit::validate, not here.
 //Returns:
 //	n/a
 //========================
-void	iPad::tick(int ct) throw (BasicException)
+void	iPad::tick(int ct)
 {
-	debugMSG(LogicObj::getID() + " - ");
+	if (debug)
+		debugMSG(LogicObj::getID() + " - ");
 
 	Wire* t = Pad::getIO();
 
 	// Since this is an input pad, after it is set, its tick is called. It forcably sets its
 	// output wire to its current charge before calling the tick of its output wire.
 
-	state tS = Connection::getCurrent();
+	t->setCurrent(Connection::getCurrent());
+	t->tick(ct);
 
-	if ((tS != low) && (tS != high) && (tS != indet))
-		throw UnknownState();
-	else
-	{
-		t->setCurrent(tS);
-		t->tick(ct);
-
-		Pad::tick(ct);
-	}
-}
-
-//========================
-//Input Pad Inverse Tick
-//========================
-//Parameters:
-//	int	ct	-	circuit time
-//Summary:
-//	Calls the iTick of the Connection Wire.
-//Returns:
-//	n/a
-//========================
-void iPad::itick(int ct) throw (BasicException)
-{
-	debugMSG(LogicObj::getID() + " + ");
-
-	Pad::getIO()->itick(ct);
-
-	Pad::itick(ct);
+	Pad::tick(ct);
 }
 
 //========================
@@ -809,9 +718,10 @@ oPad::oPad(string tID, state def) throw (NullIDException, UnknownState) :
 //Returns:
 //	n/a
 //========================
-void	oPad::tick(int ct) throw (BasicException)
+void	oPad::tick(int ct)
 {
-	debugMSG(LogicObj::getID() + " - ");
+	if (debug)
+		debugMSG(LogicObj::getID() + " - ");
 
 	Wire* t = Pad::getIO();
 
@@ -820,32 +730,9 @@ void	oPad::tick(int ct) throw (BasicException)
 
 	// This is a terminal unit. No external tick functions are called, only its own inherited tick.
 
-	state tS = t->getCurrent();
+	Connection::setCurrent(t->getCurrent());
 
-	if ((tS != low) && (tS != high) && (tS != indet))
-		throw UnknownState();
-	else
-	{
-		Connection::setCurrent(tS);
-
-		Pad::tick(ct);
-	}
-}
-
-//========================
-//Output Pad Inverse Tick
-//========================
-//Parameters:
-//	int	ct	-	circuit time
-//Summary:
-//	Calls the iTick of the Connection Wire.
-//Returns:
-//	n/a
-//========================
-void oPad::itick(int ct) throw (BasicException)
-{
-	debugMSG(LogicObj::getID() + " + ");
-	Pad::itick(ct);
+	Pad::tick(ct);
 }
 
 //========================
@@ -1137,35 +1024,72 @@ void		PadState::clrStates()
 }
 
 //========================
-//PadState	Tick
+//PadState Peek State
 //========================
 //Parameters:
-//	int	ct	-	circuit time
+//	int	idx	-	the (non-negative) index from which to retrieve a state
 //Summary:
-//	This function is a wrapper function. It adds no functionality, and
-//		merely calls its parent's tick function.
+//	Unchecked edition of getState(int) for the simulation loop. Beyond
+//		the end of the history it returns the last recorded state, and
+//		with no history at all it returns the default state, so it
+//		never needs to throw.
+//Returns:
+//	state	-	the state in effect at idx
+//========================
+state		PadState::peekState(int idx)
+{
+	int n = stateTable->size();
+
+	if (n == 0)
+		return defState;
+
+	if (idx >= n)
+		return (*stateTable)[n - 1];
+
+	return (*stateTable)[idx];
+}
+
+//========================
+//PadState Put State
+//========================
+//Parameters:
+//	state	t	-	a valid state to record
+//	int		idx	-	the (non-negative) index at which to record it
+//Summary:
+//	Unchecked edition of addState(state, int) for the simulation loop.
+//		Overwrites idx if it is inside the history; otherwise pads the
+//		history with its last (or default) state up to idx and appends t.
 //Returns:
 //	n/a
 //========================
-void PadState::tick(int ct) throw (BasicException)
+void		PadState::putState(state t, int idx)
 {
-	LogicObj::tick(ct);
+	int n = stateTable->size();
+
+	if (idx < n)
+	{
+		(*stateTable)[idx] = t;
+		return;
+	}
+
+	stateTable->resize(idx, (n == 0) ? defState : (*stateTable)[n - 1]);
+	stateTable->push_back(t);
 }
 
 //========================
-//PadState Inverse Tick
+//PadState	Tick
 //========================
 //Parameters:
 //	int	ct	-	circuit time
 //Summary:
 //	This function is a wrapper function. It adds no functionality, and
-//		merely calls its parent's itick function.
+//		merely calls its parent's tick function.
 //Returns:
 //	n/a
 //========================
-void PadState::itick(int ct) throw (BasicException)
+void PadState::tick(int ct)
 {
-	LogicObj::itick(ct);
+	LogicObj::tick(ct);
 }
 
 //========================
@@ -1211,54 +1135,23 @@ iPadState::iPadState(string tID, state def, iPad* tLink) throw (NullIDException,
 //		linked iPad. Therefore, this function retrieves the
 //		history assumed to be stored for time ct and pushes
 //		it onto the input Pad it is linked to. Then it calls
-//		that Pad's tick function.
+//		that Pad's tick function. A pad with no history yet
+//		gives its default state.
 //Returns:
 //	n/a
 //========================
-void iPadState::tick(int ct) throw (BasicException)
+void iPadState::tick(int ct)
 {
-	debugMSG(LogicObj::getID() +  " - ");
+	if (debug)
+		debugMSG(LogicObj::getID() +  " - ");
 
-	state tempS = indet;
-
-	try
-	{
-		tempS = PadState::getState(ct);
-	}
-	catch (BasicException e)
-	{
-		cout << "Unable to getState in PadState" << endl;
-		throw e;
-	}
-
-	PadState::getLink()->setCurrent(tempS);
+	PadState::getLink()->setCurrent(PadState::peekState(ct));
 
 	PadState::getLink()->tick(ct);
 
 	PadState::tick(ct);
 }
 
-//========================
-//Input PadState Inverse Tick
-//========================
-//Parameters:
-//	int	ct	-	circuit time
-//Summary:
-//	This function doesn't do anything besides call the itick function
-//		of its linked iPad, therefore starting the process of the itick
-//		on its way.
-//Returns:
-//	n/a
-//========================
-void iPadState::itick(int ct) throw (BasicException)
-{
-	debugMSG(LogicObj::getID() +  " + ");
-
-	PadState::getLink()->itick(ct);
-
-	PadState::itick(ct);
-}
-
 //========================
 //Input PadState Trace
 //========================
@@ -1306,46 +1199,16 @@ oPadState::oPadState(string tID, state def, oPad* tLink) throw (NullIDException,
 //Returns:
 //	n/a
 //========================
-void oPadState::tick(int ct) throw (BasicException)
+void oPadState::tick(int ct)
 {
-	debugMSG(LogicObj::getID() +  " - ");
+	if (debug)
+		debugMSG(LogicObj::getID() +  " - ");
 
-	state tempS = indet;
-
-	try
-	{
-		tempS = PadState::getLink()->getCurrent();
-	}
-	catch (BasicException e)
-	{
-		cout << "Unable to getState in PadState" << endl;
-		throw e;
-	}
-
-	PadState::addState(tempS, ct);
+	PadState::putState(PadState::getLink()->getCurrent(), ct);
 
 	PadState::tick(ct);
 }
 
-//========================
-//Output PadState Inverse Tick
-//========================
-//Parameters:
-//	int	ct	-	circuit time
-//Summary:
-//	As this is assumed to be called last, it does nothing, thereby
-//		allowing all the potential earlier branching functions to
-//		attempt a new branch.
-//Returns:
-//	n/a
-//========================
-void oPadState::itick(int ct) throw (BasicException)
-{
-	debugMSG(LogicObj::getID() +  " + ");
-
-	PadState::itick(ct);
-}
-
 //========================
 //Output PadState Trace
 //========================
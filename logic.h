@@ -41,8 +41,7 @@ public:
 	void		incTime();
 	void		clrTime();
 
-virtual	void	tick(int ct) throw (BasicException);
-virtual	void	itick(int ct) throw (BasicException);
+virtual	void	tick(int ct);
 virtual int		trace(int oB) throw (BasicException);
 
 private:
@@ -58,8 +57,8 @@ private:
 //==================================
 //Description:
 //	The Connection object definition extends on the Logic Object
-//		by adding a new layer of functionality to the tick, itick,
-//		and trace functions, as well as adding the concept of
+//		by adding a new layer of functionality to the tick and
+//		trace functions, as well as adding the concept of
 //		single state and default state to the Logic Object.
 //==================================
 class Connection : public LogicObj
@@ -71,8 +70,7 @@ public:
 	state		getCurrent();
 	void		resetCurrent();
 
-virtual	void	tick(int ct) throw (BasicException);
-virtual	void	itick(int ct) throw (BasicException);
+virtual	void	tick(int ct);
 virtual int		trace(int oB) throw (BasicException);
 
 private:
@@ -110,8 +108,7 @@ public:
 	LogicObj*	getOutput(string tID) throw (NullIDException, ElementNotFound);
 	LogicObj*	getOutput(int idx) throw (IndexOutOfBounds);
 
-virtual void	tick(int ct) throw (BasicException);
-virtual	void	itick(int ct) throw (BasicException);
+virtual void	tick(int ct);
 virtual int		trace(int oB) throw (BasicException);
 
 private:
@@ -137,8 +134,7 @@ public:
 	void	setIO(Wire *t) throw (NullPointerException);
 	Wire*	getIO();
 
-virtual void	tick(int ct) throw (BasicException);
-virtual	void	itick(int ct) throw (BasicException);
+virtual void	tick(int ct);
 virtual int		trace(int oB) throw (BasicException);
 
 private:
@@ -159,8 +155,7 @@ class iPad : public Pad
 public:
 				iPad(string tID, state def) throw (NullIDException, UnknownState);
 
-virtual void	tick(int ct) throw (BasicException);
-virtual	void	itick(int ct) throw (BasicException);
+virtual void	tick(int ct);
 virtual int		trace(int oB) throw (BasicException);
 };
 
@@ -177,8 +172,7 @@ class oPad : public Pad
 public:
 				oPad(string tID, state def) throw (NullIDException, UnknownState);
 
-virtual void	tick(int ct) throw (BasicException);
-virtual	void	itick(int ct) throw (BasicException);
+virtual void	tick(int ct);
 virtual int		trace(int oB) throw (BasicException);
 };
 
@@ -211,10 +205,14 @@ public:
 	int			cntStates();
 	void		clrStates();
 
-virtual void	tick(int ct) throw (BasicException);
-virtual	void	itick(int ct) throw (BasicException);
+virtual void	tick(int ct);
 virtual int		trace(int oB) throw (BasicException);
 
+protected:
+
+	state		peekState(int idx);
+	void		putState(state t, int idx);
+
 private:
 
 	Pad*		link;
@@ -236,8 +234,7 @@ class iPadState : public PadState
 public:
 				iPadState(string tID, state def, iPad* Link) throw (NullIDException, NullPointerException, UnknownState);
 
-virtual void	tick(int ct) throw (BasicException);
-virtual	void	itick(int ct) throw (BasicException);
+virtual void	tick(int ct);
 virtual int		trace(int oB) throw (BasicException);
 };
 
@@ -255,8 +252,7 @@ class oPadState : public PadState
 public:
 				oPadState(string tID, state def, oPad* Link) throw (NullIDException, NullPointerException, UnknownState);
 
-virtual void	tick(int ct) throw (BasicException);
-virtual	void	itick(int ct) throw (BasicException);
+virtual void	tick(int ct);
 virtual int		trace(int oB) throw (BasicException);
 };
 
@@ -219,6 +219,18 @@ ElementNotFound::ElementNotFound(int elem) :
 	BasicException(string("Element Not Found: ").append(itoa(elem, new char[12], 10)))
 {}
 
+//========================
+//Invalid Circuit Constructor
+//========================
+//Parameters:
+//	string	msg	-	a description of the structural fault
+//Summary:
+//	Reports a circuit that failed Circuit::validate.
+//========================
+InvalidCircuit::InvalidCircuit(string msg) :
+	BasicException(string("Invalid circuit: ").append(msg))
+{}
+
 //========================
 //Source List Empty Constructor
 //========================
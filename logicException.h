@@ -176,6 +176,20 @@ public:
 			ElementNotFound(int elem);
 };
 
+//==================================
+//Class:	InvalidCircuit
+//Parent:	BasicException
+//==================================
+//Description:
+//	Warns of a structural fault in a circuit, such as a gate with
+//		the wrong number of inputs or a wire nobody drives.
+//==================================
+class InvalidCircuit : public BasicException
+{
+public:
+			InvalidCircuit(string msg);
+};
+
 //==================================
 //Class:	SourceListEmpty
 //Parent:	BasicException
@@ -189,6 +203,10 @@ public:
 			SourceListEmpty();
 };
 
+// Debug Output control variable, see Implementation. Test it before
+// building a debugMSG string inside the simulation loop.
+extern bool debug;
+
 // See Implementation
 void debugMSG(string temp);
 
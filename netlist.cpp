@@ -0,0 +1,1869 @@
+//================================================================
+//Filename:		Compiled Netlist Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the Netlist, its
+//					construction from a Circuit, its gate orderings,
+//					and the index distance measures used to compare them.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+
+using namespace std;
+
+// Orders gate indices by how many neighbours they have, for RCM.
+struct byDegree
+{
+	vector< vector<int> >*	adj;
+
+	bool operator() (int a, int b) const
+	{
+		return (*adj)[a].size() < (*adj)[b].size();
+	}
+};
+
+// Adds a (wire, delay) leaf to a cone's input list unless already there.
+static void	addLeaf(vector<int> &lw, vector<int> &ld, int w, int d)
+{
+	for (int l = 0; l < lw.size(); l++)
+	{
+		if ((lw[l] == w) && (ld[l] == d))
+			return;
+	}
+
+	lw.push_back(w);
+	ld.push_back(d);
+}
+
+// Follows a wire's replacements to the wire that now stands for it.
+static int	resolve(vector<int> &repl, int w)
+{
+	while (repl[w] != w)
+		w = repl[w];
+
+	return w;
+}
+
+//========================
+//Parse Order
+//========================
+//Parameters:
+//	string	tO	-	the name of an ordering, as given on a command line
+//Summary:
+//	Converts file, level, dfs, rcm or best to its orderType.
+//Returns:
+//	orderType	-	the named ordering
+//========================
+orderType	parseOrder(string tO) throw (BasicException)
+{
+	if (tO == "file")
+		return oFile;
+	else if (tO == "level")
+		return oLevel;
+	else if (tO == "dfs")
+		return oDFS;
+	else if (tO == "rcm")
+		return oRCM;
+	else if (tO == "best")
+		return oBest;
+	else
+		throw BasicException(string("Unknown gate order: ").append(tO).append("."));
+}
+
+//========================
+//Order Name
+//========================
+//Parameters:
+//	orderType	o	-	an ordering
+//Summary:
+//	The inverse of parseOrder.
+//Returns:
+//	string	-	the ordering's name
+//========================
+string		orderName(orderType o)
+{
+	switch (o)
+	{
+	case oLevel:	return "level";
+	case oDFS:		return "dfs";
+	case oRCM:		return "rcm";
+	case oBest:		return "best";
+	default:		return "file";
+	}
+}
+
+//========================
+//Eval Type
+//========================
+//Parameters:
+//	gateType		t	-	a primitive gate kind
+//	vector<state>	&v	-	the gate's input values, in fan-in order
+//Summary:
+//	Evaluates one primitive gate kind on ternary inputs, as its
+//		transform would. Shared by the optimizer, ATPG and the fault
+//		simulator so they all agree on gate behavior.
+//Returns:
+//	state	-	the gate's output
+//========================
+state	evalType(gateType t, vector<state> &v)
+{
+	state s = v[0];
+
+	for (int k = 1; k < v.size(); k++)
+	{
+		if ((t == gAND) || (t == gNAND))
+			s = AND(s, v[k]);
+		else if ((t == gOR) || (t == gNOR))
+			s = OR(s, v[k]);
+		else
+			s = XOR(s, v[k]);
+	}
+
+	if ((t == gNOT) || (t == gNAND) || (t == gNOR) || (t == gXNOR))
+		s = NOT(s);
+
+	return s;
+}
+
+//========================
+//Netlist Constructor
+//========================
+//Parameters:
+//	Circuit	*crc	-	a validated circuit
+//Summary:
+//	Flattens crc into index arrays, keeping gates in circuit file order.
+//		The circuit must have passed Circuit::validate, which guarantees
+//		every wire has exactly one driver and every gate has its inputs.
+//========================
+Netlist::Netlist(Circuit *crc) throw (NullPointerException)
+{
+	if (crc == NULL)
+		throw NullPointerException();
+
+	order = oFile;
+	maxLevel = 0;
+
+	gType = new vector<gateType>;
+	gDelay = new vector<int>;
+	gOut = new vector<int>;
+	gInStart = new vector<int>;
+	gIn = new vector<int>;
+	gLevel = new vector<int>;
+	gIDs = new vector<string>;
+	gFile = new vector<int>;
+	gSkew = new vector<int>;
+	gTable = new vector<int>;
+	luts = new vector<unsigned char>;
+
+	wDriver = new vector<int>;
+	wFanStart = new vector<int>;
+	wFan = new vector<int>;
+	wIDs = new vector<string>;
+
+	iWire = new vector<int>;
+	iIDs = new vector<string>;
+	oWire = new vector<int>;
+	oIDs = new vector<string>;
+
+	map<LogicObj*, int> wIdx;	// Wire object to its provisional index.
+
+	for (int lo = 0; lo < crc->cntLogicObjs(); lo++)
+	{
+		Wire* w = dynamic_cast<Wire*>(crc->getLogicObj(lo));
+
+		if (w != NULL)
+		{
+			wIdx[w] = wIDs->size();
+			wIDs->push_back(w->getID());
+		}
+	}
+
+	gInStart->push_back(0);
+
+	for (int lo = 0; lo < crc->cntLogicObjs(); lo++)
+	{
+		Gate* g = dynamic_cast<Gate*>(crc->getLogicObj(lo));
+
+		if (g != NULL)
+		{
+			gFile->push_back(gIDs->size());
+			gIDs->push_back(g->getID());
+			gType->push_back(g->getType());
+			gDelay->push_back(g->getDelaySize());
+			gOut->push_back(wIdx[g->getOutput()]);
+
+			gTable->push_back(-1);
+
+			for (int k = 0; k < g->cntInputs(); k++)
+			{
+				gIn->push_back(wIdx[g->getInput(k)]);
+				gSkew->push_back(0);
+			}
+
+			gInStart->push_back(gIn->size());
+		}
+	}
+
+	for (int ip = 0; ip < crc->cntiPads(); ip++)
+	{
+		iWire->push_back(wIdx[crc->getiPad(ip)->getIO()]);
+		iIDs->push_back(crc->getiPad(ip)->getID());
+	}
+
+	for (int op = 0; op < crc->cntoPads(); op++)
+	{
+		oWire->push_back(wIdx[crc->getoPad(op)->getIO()]);
+		oIDs->push_back(crc->getoPad(op)->getID());
+	}
+
+	gLevel->assign(gType->size(), 0);
+
+	vector<int> perm(gType->size());
+
+	for (int g = 0; g < perm.size(); g++)
+		perm[g] = g;
+
+	renumber(perm);	// settles the pad-wires-first wire numbering.
+	levelize();
+}
+
+//========================
+//Netlist Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the index arrays.
+//========================
+Netlist::~Netlist()
+{
+	delete gType;
+	delete gDelay;
+	delete gOut;
+	delete gInStart;
+	delete gIn;
+	delete gLevel;
+	delete gIDs;
+	delete gFile;
+	delete gSkew;
+	delete gTable;
+	delete luts;
+
+	delete wDriver;
+	delete wFanStart;
+	delete wFan;
+	delete wIDs;
+
+	delete iWire;
+	delete iIDs;
+	delete oWire;
+	delete oIDs;
+}
+
+//========================
+//Netlist Counts
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Number of gates, wires, input pads and output pads respectively.
+//Returns:
+//	int	-	the count
+//========================
+int			Netlist::cntGates()
+{
+	return gType->size();
+}
+
+int			Netlist::cntWires()
+{
+	return wIDs->size();
+}
+
+int			Netlist::cntiPads()
+{
+	return iWire->size();
+}
+
+int			Netlist::cntoPads()
+{
+	return oWire->size();
+}
+
+//========================
+//Netlist Gate Accessors
+//========================
+//Parameters:
+//	int	g	-	a gate index
+//	int	k	-	an input index on that gate
+//	int	idx	-	a truth table index
+//Summary:
+//	Unchecked reads of a gate's kind, delay, output wire, inputs, input
+//		skews, level, ID and (for gLUT) truth table entries. These sit on
+//		the compile path of every engine, so the indices are the caller's
+//		responsibility. See collapse() for skews and truth tables.
+//Returns:
+//	varies
+//========================
+gateType	Netlist::getType(int g)
+{
+	return (*gType)[g];
+}
+
+int			Netlist::getDelay(int g)
+{
+	return (*gDelay)[g];
+}
+
+int			Netlist::getOutput(int g)
+{
+	return (*gOut)[g];
+}
+
+int			Netlist::cntInputs(int g)
+{
+	return (*gInStart)[g + 1] - (*gInStart)[g];
+}
+
+int			Netlist::getInput(int g, int k)
+{
+	return (*gIn)[(*gInStart)[g] + k];
+}
+
+int			Netlist::getSkew(int g, int k)
+{
+	return (*gSkew)[(*gInStart)[g] + k];
+}
+
+int			Netlist::getLevel(int g)
+{
+	return (*gLevel)[g];
+}
+
+string		Netlist::getGateID(int g)
+{
+	return (*gIDs)[g];
+}
+
+state		Netlist::getLUT(int g, int idx)
+{
+	return (state) (*luts)[(*gTable)[g] + idx];
+}
+
+//========================
+//Netlist Wire Accessors
+//========================
+//Parameters:
+//	int	w	-	a wire index
+//	int	k	-	a fan-out index on that wire
+//Summary:
+//	Unchecked reads of a wire's driving gate (-1 when an input pad
+//		drives it), its fan-out gates, and its ID.
+//Returns:
+//	varies
+//========================
+int			Netlist::getDriver(int w)
+{
+	return (*wDriver)[w];
+}
+
+int			Netlist::cntFanout(int w)
+{
+	return (*wFanStart)[w + 1] - (*wFanStart)[w];
+}
+
+int			Netlist::getFanout(int w, int k)
+{
+	return (*wFan)[(*wFanStart)[w] + k];
+}
+
+string		Netlist::getWireID(int w)
+{
+	return (*wIDs)[w];
+}
+
+//========================
+//Netlist Pad Accessors
+//========================
+//Parameters:
+//	int	p	-	a pad index, in circuit file order
+//Summary:
+//	The wire and ID of an input or output pad.
+//Returns:
+//	varies
+//========================
+int			Netlist::getiPadWire(int p)
+{
+	return (*iWire)[p];
+}
+
+string		Netlist::getiPadID(int p)
+{
+	return (*iIDs)[p];
+}
+
+int			Netlist::getoPadWire(int p)
+{
+	return (*oWire)[p];
+}
+
+string		Netlist::getoPadID(int p)
+{
+	return (*oIDs)[p];
+}
+
+//========================
+//Netlist Match Pads
+//========================
+//Parameters:
+//	Vector				*v		-	a vector for the circuit this netlist came from
+//	vector<int>			&iIdx	-	receives netlist input pad indices
+//	vector<PadState*>	&iPS	-	receives the matching iPadStates
+//	vector<int>			&oIdx	-	receives netlist output pad indices
+//	vector<PadState*>	&oPS	-	receives the matching oPadStates
+//Summary:
+//	Pairs each of the vector's PadStates with the netlist pad of the same
+//		name, for the engines' run functions.
+//Returns:
+//	n/a
+//========================
+void		Netlist::matchPads(Vector *v, vector<int> &iIdx, vector<PadState*> &iPS,
+				vector<int> &oIdx, vector<PadState*> &oPS) throw (BasicException)
+{
+	if (v == NULL)
+		throw NullPointerException();
+
+	for (int ps = 0; ps < v->cntPadStates(); ps++)
+	{
+		PadState*	tPS = v->getPadState(ps);
+		string		tID = tPS->getLink()->getID();
+		bool		found = false;
+
+		if (dynamic_cast<iPadState*>(tPS) != NULL)
+		{
+			for (int p = 0; (p < cntiPads()) && !found; p++)
+			{
+				if (getiPadID(p) == tID)
+				{
+					iIdx.push_back(p);
+					iPS.push_back(tPS);
+					found = true;
+				}
+			}
+		}
+		else
+		{
+			for (int p = 0; (p < cntoPads()) && !found; p++)
+			{
+				if (getoPadID(p) == tID)
+				{
+					oIdx.push_back(p);
+					oPS.push_back(tPS);
+					found = true;
+				}
+			}
+		}
+
+		if (!found)
+			throw BasicException("Vector definitions do not match with circuit definitions.");
+	}
+}
+
+//========================
+//Netlist Maximum Level
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The deepest gate level; see levelize().
+//Returns:
+//	int	-	the level count
+//========================
+int			Netlist::getMaxLevel()
+{
+	return maxLevel;
+}
+
+//========================
+//Netlist Maximum Delay
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The longest single gate delay in the netlist.
+//Returns:
+//	int	-	the delay in nanoseconds
+//========================
+int			Netlist::getMaxDelay()
+{
+	int big = 0;
+
+	for (int g = 0; g < cntGates(); g++)
+	{
+		if ((*gDelay)[g] > big)
+			big = (*gDelay)[g];
+	}
+
+	return big;
+}
+
+//========================
+//Netlist Path Delay
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The longest total delay, gLUT skews included, along any path from
+//		an input pad to an output pad: how far back in time an output
+//		can see. Only defined for a netlist without feedback.
+//Returns:
+//	int	-	the delay in nanoseconds, or -1 if the netlist has feedback
+//========================
+int			Netlist::getPathDelay()
+{
+	int nG = cntGates();
+
+	vector<int>	pend(nG, 0);
+	vector<int>	arrive(cntWires(), 0);
+	vector<int>	queue;
+
+	for (int g = 0; g < nG; g++)
+	{
+		for (int k = 0; k < cntInputs(g); k++)
+		{
+			if (getDriver(getInput(g, k)) >= 0)
+				pend[g]++;
+		}
+
+		if (pend[g] == 0)
+			queue.push_back(g);
+	}
+
+	for (int head = 0; head < queue.size(); head++)
+	{
+		int g = queue[head];
+		int o = getOutput(g);
+		int late = 0;
+
+		for (int k = 0; k < cntInputs(g); k++)
+		{
+			if (arrive[getInput(g, k)] + getSkew(g, k) > late)
+				late = arrive[getInput(g, k)] + getSkew(g, k);
+		}
+
+		arrive[o] = late + getDelay(g);
+
+		for (int f = 0; f < cntFanout(o); f++)
+		{
+			int r = getFanout(o, f);
+
+			for (int k = 0; k < cntInputs(r); k++)
+			{
+				if ((getInput(r, k) == o) && (--pend[r] == 0))
+					queue.push_back(r);
+			}
+		}
+	}
+
+	if (queue.size() < nG) // some gate waits on itself.
+		return -1;
+
+	int big = 0;
+
+	for (int p = 0; p < cntoPads(); p++)
+	{
+		if (arrive[getoPadWire(p)] > big)
+			big = arrive[getoPadWire(p)];
+	}
+
+	return big;
+}
+
+//========================
+//Netlist Reorder
+//========================
+//Parameters:
+//	orderType	o	-	the ordering to apply
+//Summary:
+//	Renumbers the gates (and with them the wires) into the given order:
+//		oFile	-	circuit file order
+//		oLevel	-	by level, so every gate follows its fan-ins
+//		oDFS	-	depth-first from the output pads, so each gate
+//					directly follows the cone that feeds it
+//		oRCM	-	reverse Cuthill-McKee, minimizing the spread of
+//					gate-to-gate connections
+//		oBest	-	whichever of the above gives the smallest average
+//					gate distance for this netlist
+//Returns:
+//	n/a
+//========================
+void		Netlist::reorder(orderType o)
+{
+	if (o == oBest)
+	{
+		orderType	cand[4] = {oFile, oLevel, oDFS, oRCM};
+		orderType	best = oFile;
+		double		bDist = -1;
+
+		for (int c = 0; c < 4; c++)
+		{
+			reorder(cand[c]);
+
+			double d = avgGateDistance();
+
+			if ((bDist < 0) || (d < bDist))
+			{
+				best = cand[c];
+				bDist = d;
+			}
+		}
+
+		reorder(best);
+		return;
+	}
+
+	vector<int> perm;
+
+	if (o == oLevel)
+		orderLevel(perm);
+	else if (o == oDFS)
+		orderDFS(perm);
+	else if (o == oRCM)
+		orderRCM(perm);
+	else
+	{
+		perm.resize(cntGates());
+
+		for (int g = 0; g < cntGates(); g++)
+			perm[(*gFile)[g]] = g;
+	}
+
+	renumber(perm);
+
+	order = o;
+}
+
+//========================
+//Netlist Get Order
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The ordering most recently applied.
+//Returns:
+//	orderType	-	the current ordering
+//========================
+orderType	Netlist::getOrder()
+{
+	return order;
+}
+
+//========================
+//Netlist Collapse
+//========================
+//Parameters:
+//	int	k	-	the most inputs a lookup table gate may have, 2 to 8
+//Summary:
+//	Replaces fanout-free cones with gLUT gates. Working back from the
+//		outputs, each gate that has not been swallowed yet becomes a root
+//		and absorbs the gates feeding it as long as the absorbed gate
+//		drives nothing else (no other gate, no output pad) and the cone
+//		keeps at most k distinct inputs.
+//		An input is a (wire, path delay) pair, the path delay being the
+//		sum of gate delays from that wire to the root's output, so a wire
+//		reaching the root along two paths of different length counts as
+//		two inputs. The gLUT's delay is the shortest path delay and each
+//		input's skew is how much longer its own path is; the Engine
+//		delays each input by its skew, so every path keeps its total delay
+//		and waveforms do not change.
+//		The ternary truth table, 3^n entries for n inputs with input 0
+//		least significant, is found by evaluating the original gates on
+//		every input combination, so X handling is exactly the gates'.
+//		Internal wires of a cone disappear, and the netlist returns to
+//		circuit file order.
+//Returns:
+//	int	-	the number of gates removed
+//========================
+int			Netlist::collapse(int k) throw (BasicException)
+{
+	if ((k < 2) || (k > 8))
+		throw BasicException("Lookup table size must be from 2 to 8 inputs.");
+
+	int nG = cntGates();
+
+	vector<bool> oWired(cntWires(), false);
+
+	for (int op = 0; op < cntoPads(); op++)
+		oWired[getoPadWire(op)] = true;
+
+	vector<int> todo;
+
+	orderLevel(todo);
+	reverse(todo.begin(), todo.end());	// readers before the gates they read.
+
+	vector<int>				owner(nG, -1);	// the root that absorbed each gate.
+
+	vector<gateType>		tType;
+	vector<int>				tDelay;
+	vector<int>				tOut;
+	vector<int>				tInStart;
+	vector<int>				tIn;
+	vector<int>				tSkew;
+	vector<string>			tIDs;
+	vector<int>				tFile;
+	vector<int>				tTable;
+	vector<unsigned char>	tLuts;
+
+	tInStart.push_back(0);
+
+	for (int r = 0; r < nG; r++)
+	{
+		int g = todo[r];
+
+		if (owner[g] != -1)
+			continue;
+
+		owner[g] = g;
+
+		vector<int> lw;		// cone inputs: the wire,
+		vector<int> ld;		// and its path delay to g's output.
+		vector<int> cone(1, g);
+
+		for (int j = 0; j < cntInputs(g); j++)
+			addLeaf(lw, ld, getInput(g, j), getDelay(g));
+
+		bool grown = (getType(g) != gLUT);
+
+		while (grown)
+		{
+			grown = false;
+
+			for (int l = 0; (l < lw.size()) && !grown; l++)
+			{
+				int d = getDriver(lw[l]);
+
+				if ((d < 0) || (owner[d] != -1) || (getType(d) == gLUT))
+					continue;
+
+				if ((cntFanout(lw[l]) != 1) || oWired[lw[l]])
+					continue;
+
+				vector<int> nw;
+				vector<int> nd;
+
+				for (int m = 0; m < lw.size(); m++)
+				{
+					if (m != l)
+						addLeaf(nw, nd, lw[m], ld[m]);
+				}
+
+				for (int j = 0; j < cntInputs(d); j++)
+					addLeaf(nw, nd, getInput(d, j), ld[l] + getDelay(d));
+
+				if (nw.size() <= k)
+				{
+					owner[d] = g;
+					cone.push_back(d);
+					lw = nw;
+					ld = nd;
+					grown = true;
+				}
+			}
+		}
+
+		tOut.push_back(getOutput(g));
+		tFile.push_back((*gFile)[g]);
+
+		if (cone.size() == 1) // nothing to collapse; keep the gate.
+		{
+			tType.push_back(getType(g));
+			tDelay.push_back(getDelay(g));
+			tIDs.push_back(getGateID(g));
+
+			for (int j = 0; j < cntInputs(g); j++)
+			{
+				tIn.push_back(getInput(g, j));
+				tSkew.push_back(getSkew(g, j));
+			}
+
+			if (getType(g) == gLUT)
+			{
+				int size = 1;
+
+				for (int j = 0; j < cntInputs(g); j++)
+					size *= 3;
+
+				tTable.push_back(tLuts.size());
+
+				for (int idx = 0; idx < size; idx++)
+					tLuts.push_back(getLUT(g, idx));
+			}
+			else
+				tTable.push_back(-1);
+		}
+		else
+		{
+			int dMin = ld[0];
+
+			for (int l = 1; l < ld.size(); l++)
+			{
+				if (ld[l] < dMin)
+					dMin = ld[l];
+			}
+
+			tType.push_back(gLUT);
+			tDelay.push_back(dMin);
+			tIDs.push_back(string("LUT").append(getGateID(g)));
+
+			for (int l = 0; l < lw.size(); l++)
+			{
+				tIn.push_back(lw[l]);
+				tSkew.push_back(ld[l] - dMin);
+			}
+
+			tTable.push_back(tLuts.size());
+
+			int				size = 1;
+			vector<state>	v(lw.size(), low);
+
+			for (int l = 0; l < lw.size(); l++)
+				size *= 3;
+
+			for (int idx = 0; idx < size; idx++)
+			{
+				int rest = idx;
+
+				for (int l = 0; l < lw.size(); l++)
+				{
+					v[l] = (state) (rest % 3);
+					rest /= 3;
+				}
+
+				tLuts.push_back(coneState(g, getDelay(g), owner, lw, ld, v));
+			}
+		}
+
+		tInStart.push_back(tIn.size());
+	}
+
+	// Back to circuit file order: rank the surviving gates' file positions.
+	vector< pair<int, int> > rank;
+
+	for (int g = 0; g < tFile.size(); g++)
+		rank.push_back(pair<int, int>(tFile[g], g));
+
+	sort(rank.begin(), rank.end());
+
+	for (int rk = 0; rk < rank.size(); rk++)
+		tFile[rank[rk].second] = rk;
+
+	*gType = tType;
+	*gDelay = tDelay;
+	*gOut = tOut;
+	*gInStart = tInStart;
+	*gIn = tIn;
+	*gSkew = tSkew;
+	*gIDs = tIDs;
+	*gFile = tFile;
+	*gTable = tTable;
+	*luts = tLuts;
+
+	gLevel->assign(tType.size(), 0);
+
+	reorder(oFile);
+	levelize();
+
+	return nG - cntGates();
+}
+
+//========================
+//Netlist Cone State
+//========================
+//Parameters:
+//	int				g		-	a gate in a cone being collapsed
+//	int				p		-	path delay from g's inputs to the root's output
+//	vector<int>		&owner	-	the root that absorbed each gate
+//	vector<int>		&lw		-	the cone's input wires
+//	vector<int>		&ld		-	and their path delays
+//	vector<state>	&v		-	a value for each cone input
+//Summary:
+//	Evaluates g, recursing into any fan-in gate of the same cone and
+//		taking cone inputs from v, matched by wire and path delay.
+//Returns:
+//	state	-	g's output for this combination
+//========================
+state		Netlist::coneState(int g, int p, vector<int> &owner, vector<int> &lw, vector<int> &ld, vector<state> &v)
+{
+	vector<state> in(cntInputs(g), indet);
+
+	for (int j = 0; j < cntInputs(g); j++)
+	{
+		int w = getInput(g, j);
+		int d = getDriver(w);
+
+		if ((d >= 0) && (d != owner[g]) && (owner[d] == owner[g]))
+			in[j] = coneState(d, p + getDelay(d), owner, lw, ld, v);
+		else
+		{
+			for (int l = 0; l < lw.size(); l++)
+			{
+				if ((lw[l] == w) && (ld[l] == p))
+					in[j] = v[l];
+			}
+		}
+	}
+
+	return evalType(getType(g), in);
+}
+
+//========================
+//Netlist Optimize
+//========================
+//Parameters:
+//	bool	functional	-	whether only settled 0/1 outputs need be kept
+//Summary:
+//	Removes gates the output pads cannot tell apart from others, in
+//		passes over the gates in level order until one changes nothing:
+//		- an AND, OR, NAND or NOR reading a wire twice reads it once,
+//			and one left with a single input becomes a buffer (kept as
+//			AND with the input twice) or a NOT;
+//		- a NOT or buffer whose input comes from another, which nothing
+//			else reads, absorbs it: the two delays add up and two NOTs
+//			make a buffer;
+//		- gates of the same type and delay reading the same wires are
+//			merged, their readers and pads moved to the one kept;
+//		- gates with no path to an output pad are dropped.
+//		None of these changes any output pad's waveform, X included,
+//		so they are safe with feedback. A "constant" such as XOR(a, a)
+//		is X until a settles, so it is left alone.
+//		With functional set, the netlist need only settle to the same
+//		0/1 outputs, and delays may change: XOR(a, a), AND(a, NOT a) and
+//		their kin are constants and fold into their readers, buffers
+//		and NOT(NOT(a)) are bypassed, and merging ignores delay. A
+//		constant gate still read is rebuilt as XOR (or XNOR) of the first
+//		input pad with itself. This needs a netlist without feedback.
+//		gLUT gates are only merged or dropped. The netlist returns to
+//		circuit file order.
+//Returns:
+//	int	-	the number of gates removed
+//========================
+int			Netlist::optimize(bool functional) throw (BasicException)
+{
+	if (functional && (getPathDelay() < 0))
+		throw BasicException("Functional optimization needs a circuit without feedback.");
+
+	int nG = cntGates();
+	int nW = cntWires();
+
+	vector<gateType>		tType(nG);
+	vector<int>				tDelay(nG);
+	vector< vector<int> >	tIn(nG);
+	vector< vector<int> >	tSkew(nG);
+	vector<bool>			alive(nG, true);
+	vector<int>				repl(nW);		// the wire that now stands for each wire.
+	vector<int>				cval(nW, -1);	// functional: 0 or 1 if the wire is constant.
+	vector<int>				todo;
+
+	for (int g = 0; g < nG; g++)
+	{
+		tType[g] = getType(g);
+		tDelay[g] = getDelay(g);
+
+		for (int k = 0; k < cntInputs(g); k++)
+		{
+			tIn[g].push_back(getInput(g, k));
+			tSkew[g].push_back(getSkew(g, k));
+		}
+	}
+
+	for (int w = 0; w < nW; w++)
+		repl[w] = w;
+
+	orderLevel(todo);
+
+	bool changed = true;
+
+	while (changed)
+	{
+		changed = false;
+
+		map< vector<int>, int > seen;
+
+		for (int r = 0; r < nG; r++)
+		{
+			int g = todo[r];
+
+			if (!alive[g])
+				continue;
+
+			vector<int>& in = tIn[g];
+
+			for (int k = 0; k < in.size(); k++)
+				in[k] = resolve(repl, in[k]);
+
+			int o = getOutput(g);
+
+			if (cval[o] >= 0)
+				continue;
+
+			gateType	t = tType[g];
+			int			was = in.size();
+			int			c = -1;
+
+			if (t != gLUT)
+			{
+				bool inv = ((t == gNOT) || (t == gNAND) || (t == gNOR) || (t == gXNOR));
+				bool xr = ((t == gXOR) || (t == gXNOR));
+				int stop = ((t == gOR) || (t == gNOR)) ? 1 : 0;	// the input value that decides.
+
+				vector<int> ins;
+
+				for (int k = 0; k < in.size(); k++)
+				{
+					int w = in[k];
+
+					if (functional && (cval[w] >= 0) && (t != gNOT))
+					{
+						if (xr)
+							inv = (inv != (cval[w] == 1));
+						else if (cval[w] == stop)
+							c = (stop == 1) != inv;
+
+						continue;
+					}
+
+					if (functional && (t == gNOT) && (cval[w] >= 0))
+						c = 1 - cval[w];
+
+					ins.push_back(w);
+				}
+
+				sort(ins.begin(), ins.end());
+
+				if (!xr)
+					ins.erase(unique(ins.begin(), ins.end()), ins.end());
+				else if (functional)
+				{
+					vector<int> odd;
+
+					for (int k = 0; k < ins.size(); k++)
+					{
+						if ((k + 1 < ins.size()) && (ins[k] == ins[k + 1]))
+							k++;	// a ^ a = 0.
+						else
+							odd.push_back(ins[k]);
+					}
+
+					ins = odd;
+				}
+
+				if (functional && (c < 0))
+				{
+					for (int a = 0; a < ins.size(); a++)
+					{
+						int d = (ins[a] < 0) ? -1 : getDriver(ins[a]);
+
+						if ((d < 0) || !alive[d] || (tType[d] != gNOT))
+							continue;
+
+						int neg = resolve(repl, tIn[d][0]);
+
+						for (int b = 0; b < ins.size(); b++)
+						{
+							if ((ins[b] != neg) || (b == a) || (ins[a] < 0))
+								continue;
+
+							if (xr)
+							{
+								inv = !inv;	// a ^ ~a = 1.
+								ins[a] = -1;
+								ins[b] = -1;
+							}
+							else
+								c = (stop == 0) == inv;
+						}
+					}
+
+					ins.erase(remove(ins.begin(), ins.end(), -1), ins.end());
+
+					if ((c < 0) && ins.empty())
+						c = (xr ? 0 : 1 - stop) != inv;
+				}
+
+				if (c >= 0)
+				{
+					int a = (cntiPads() > 0) ? getiPadWire(0) : in[0];
+
+					cval[o] = c;
+					tType[g] = (c == 1) ? gXNOR : gXOR;
+					in.assign(2, a);
+					tSkew[g].assign(2, 0);
+					changed = true;
+					continue;
+				}
+
+				if (ins.size() == 1)
+					t = inv ? gNOT : gAND;
+				else if (xr)
+					t = inv ? gXNOR : gXOR;
+
+				if ((t != tType[g]) || (ins.size() != was))
+					changed = true;
+
+				tType[g] = t;
+				in = ins;
+				tSkew[g].assign(in.size(), 0);
+
+				if (functional && (t == gAND) && (in.size() == 1))
+				{
+					repl[o] = in[0];
+					alive[g] = false;
+					changed = true;
+					continue;
+				}
+
+				if (functional && (t == gNOT))
+				{
+					int d = getDriver(in[0]);
+
+					if ((d >= 0) && alive[d] && (tType[d] == gNOT))
+					{
+						repl[o] = resolve(repl, tIn[d][0]);
+						alive[g] = false;
+						changed = true;
+						continue;
+					}
+				}
+			}
+
+			vector<int> key;
+
+			key.push_back(t);
+			key.push_back(functional ? 0 : tDelay[g]);
+
+			for (int k = 0; k < in.size(); k++)
+			{
+				key.push_back(in[k]);
+				key.push_back(tSkew[g][k]);
+			}
+
+			if (t == gLUT)
+			{
+				int size = 1;
+
+				for (int k = 0; k < in.size(); k++)
+					size *= 3;
+
+				for (int idx = 0; idx < size; idx++)
+					key.push_back(getLUT(g, idx));
+			}
+
+			map< vector<int>, int >::iterator it = seen.find(key);
+
+			if (it == seen.end())
+				seen[key] = g;
+			else
+			{
+				repl[o] = getOutput(it->second);
+				alive[g] = false;
+				changed = true;
+			}
+		}
+
+		vector<int>		readers(nW, 0);
+		vector<bool>	oWired(nW, false);
+		vector<bool>	live(nG, false);
+		vector<int>		stack;
+
+		for (int g = 0; g < nG; g++)
+		{
+			if (!alive[g])
+				continue;
+
+			for (int k = 0; k < tIn[g].size(); k++)
+			{
+				tIn[g][k] = resolve(repl, tIn[g][k]);
+
+				if ((k == 0) || (tIn[g][k] != tIn[g][k - 1]))
+					readers[tIn[g][k]]++;
+			}
+		}
+
+		for (int op = 0; op < cntoPads(); op++)
+		{
+			oWired[resolve(repl, getoPadWire(op))] = true;
+			stack.push_back(resolve(repl, getoPadWire(op)));
+		}
+
+		for (int r = 0; !functional && (r < nG); r++)
+		{
+			int g = todo[r];
+
+			if (!alive[g] || (tType[g] == gLUT) || (tIn[g].size() != 1))
+				continue;
+
+			int w = tIn[g][0];
+			int u = getDriver(w);
+
+			if ((u < 0) || (u == g) || !alive[u] || (tType[u] == gLUT) || (tIn[u].size() != 1))
+				continue;
+
+			if (oWired[w] || (readers[w] != 1))
+				continue;
+
+			tIn[g][0] = tIn[u][0];
+			tDelay[g] += tDelay[u];
+			tType[g] = ((tType[g] == gNOT) != (tType[u] == gNOT)) ? gNOT : gAND;
+			alive[u] = false;
+			changed = true;
+		}
+
+		while (!stack.empty())
+		{
+			int d = getDriver(stack.back());
+
+			stack.pop_back();
+
+			if ((d < 0) || !alive[d] || live[d])
+				continue;
+
+			live[d] = true;
+
+			for (int k = 0; k < tIn[d].size(); k++)
+				stack.push_back(tIn[d][k]);
+		}
+
+		for (int g = 0; g < nG; g++)
+		{
+			if (alive[g] && !live[g])
+			{
+				alive[g] = false;
+				changed = true;
+			}
+		}
+	}
+
+	vector<gateType>		nType;
+	vector<int>				nDelay;
+	vector<int>				nOut;
+	vector<int>				nInStart;
+	vector<int>				nIn;
+	vector<int>				nSkew;
+	vector<string>			nIDs;
+	vector<int>				nFile;
+	vector<int>				nTable;
+	vector<unsigned char>	nLuts;
+
+	nInStart.push_back(0);
+
+	for (int g = 0; g < nG; g++)
+	{
+		if (!alive[g])
+			continue;
+
+		nType.push_back(tType[g]);
+		nDelay.push_back(tDelay[g]);
+		nOut.push_back(getOutput(g));
+		nIDs.push_back(getGateID(g));
+		nFile.push_back((*gFile)[g]);
+
+		for (int k = 0; k < tIn[g].size(); k++)
+		{
+			nIn.push_back(tIn[g][k]);
+			nSkew.push_back(tSkew[g][k]);
+		}
+
+		if ((tType[g] == gAND) && (tIn[g].size() == 1)) // a buffer.
+		{
+			nIn.push_back(tIn[g][0]);
+			nSkew.push_back(0);
+		}
+
+		if (tType[g] == gLUT)
+		{
+			int size = 1;
+
+			for (int k = 0; k < tIn[g].size(); k++)
+				size *= 3;
+
+			nTable.push_back(nLuts.size());
+
+			for (int idx = 0; idx < size; idx++)
+				nLuts.push_back(getLUT(g, idx));
+		}
+		else
+			nTable.push_back(-1);
+
+		nInStart.push_back(nIn.size());
+	}
+
+	for (int op = 0; op < cntoPads(); op++)
+		(*oWire)[op] = resolve(repl, (*oWire)[op]);
+
+	vector< pair<int, int> > rank;
+
+	for (int g = 0; g < nFile.size(); g++)
+		rank.push_back(pair<int, int>(nFile[g], g));
+
+	sort(rank.begin(), rank.end());
+
+	for (int rk = 0; rk < rank.size(); rk++)
+		nFile[rank[rk].second] = rk;
+
+	*gType = nType;
+	*gDelay = nDelay;
+	*gOut = nOut;
+	*gInStart = nInStart;
+	*gIn = nIn;
+	*gSkew = nSkew;
+	*gIDs = nIDs;
+	*gFile = nFile;
+	*gTable = nTable;
+	*luts = nLuts;
+
+	gLevel->assign(nType.size(), 0);
+
+	reorder(oFile);
+	levelize();
+
+	return nG - cntGates();
+}
+
+//========================
+//Netlist Average Gate Distance
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Over every gate-to-gate connection, the mean distance between the
+//		index of the driving gate and the index of the reading gate.
+//		Small numbers mean a gate's fan-ins were evaluated recently and
+//		are still in cache.
+//Returns:
+//	double	-	the mean distance, in gates
+//========================
+double		Netlist::avgGateDistance()
+{
+	double	sum = 0;
+	int		cnt = 0;
+
+	for (int g = 0; g < cntGates(); g++)
+	{
+		for (int k = 0; k < cntInputs(g); k++)
+		{
+			int d = getDriver(getInput(g, k));
+
+			if (d >= 0)
+			{
+				sum += (d > g) ? d - g : g - d;
+				cnt++;
+			}
+		}
+	}
+
+	return (cnt == 0) ? 0 : sum / cnt;
+}
+
+//========================
+//Netlist Average Wire Distance
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Over every gate input, the mean distance between the input wire's
+//		index and the gate's output wire index -- how far apart the reads
+//		and the write of one evaluation land in the wire state array.
+//Returns:
+//	double	-	the mean distance, in wires
+//========================
+double		Netlist::avgWireDistance()
+{
+	double	sum = 0;
+	int		cnt = 0;
+
+	for (int g = 0; g < cntGates(); g++)
+	{
+		int o = getOutput(g);
+
+		for (int k = 0; k < cntInputs(g); k++)
+		{
+			int i = getInput(g, k);
+
+			sum += (i > o) ? i - o : o - i;
+			cnt++;
+		}
+	}
+
+	return (cnt == 0) ? 0 : sum / cnt;
+}
+
+//========================
+//Netlist Percent Near
+//========================
+//Parameters:
+//	int	span	-	a distance, in gates
+//Summary:
+//	The share of gate-to-gate connections whose endpoints lie within
+//		span gates of each other. With one state byte per wire, a span
+//		of 64 is about a cache line of wire states.
+//Returns:
+//	double	-	a percentage, 0 to 100
+//========================
+double		Netlist::pctNear(int span)
+{
+	int	near = 0;
+	int	cnt = 0;
+
+	for (int g = 0; g < cntGates(); g++)
+	{
+		for (int k = 0; k < cntInputs(g); k++)
+		{
+			int d = getDriver(getInput(g, k));
+
+			if (d >= 0)
+			{
+				if (((d > g) ? d - g : g - d) <= span)
+					near++;
+
+				cnt++;
+			}
+		}
+	}
+
+	return (cnt == 0) ? 100 : (100.0 * near) / cnt;
+}
+
+//========================
+//Netlist Renumber
+//========================
+//Parameters:
+//	vector<int>	&perm	-	perm[new gate index] = old gate index
+//Summary:
+//	Moves every gate to its new index, then renumbers the wires: input
+//		pad wires first, then each gate's output wire in the new gate order.
+//		Fan-in lists, pad wires and wire fan-outs are rewritten to match,
+//		and wires that no gate or pad touches any more are dropped.
+//Returns:
+//	n/a
+//========================
+void		Netlist::renumber(vector<int> &perm)
+{
+	int nG = perm.size();
+	int nW = wIDs->size();
+	int nw = 0;
+
+	vector<int>		wMap(nW, -1);
+	vector<bool>	used(nW, false);
+
+	for (int k = 0; k < gIn->size(); k++)
+		used[(*gIn)[k]] = true;
+
+	for (int op = 0; op < cntoPads(); op++)
+		used[(*oWire)[op]] = true;
+
+	for (int ip = 0; ip < cntiPads(); ip++)
+	{
+		if (wMap[(*iWire)[ip]] == -1)
+			wMap[(*iWire)[ip]] = nw++;
+	}
+
+	for (int ng = 0; ng < nG; ng++)
+	{
+		if (wMap[(*gOut)[perm[ng]]] == -1)
+			wMap[(*gOut)[perm[ng]]] = nw++;
+	}
+
+	for (int w = 0; w < nW; w++)
+	{
+		if ((wMap[w] == -1) && used[w]) // undriven; validate rejects these.
+			wMap[w] = nw++;
+	}
+
+	vector<gateType>	tType;
+	vector<int>			tDelay;
+	vector<int>			tOut;
+	vector<int>			tInStart;
+	vector<int>			tIn;
+	vector<int>			tSkew;
+	vector<int>			tLevel;
+	vector<string>		tIDs;
+	vector<int>			tFile;
+	vector<int>			tTable;
+
+	tInStart.push_back(0);
+
+	for (int ng = 0; ng < nG; ng++)
+	{
+		int og = perm[ng];
+
+		tType.push_back((*gType)[og]);
+		tDelay.push_back((*gDelay)[og]);
+		tOut.push_back(wMap[(*gOut)[og]]);
+		tLevel.push_back((*gLevel)[og]);
+		tIDs.push_back((*gIDs)[og]);
+		tFile.push_back((*gFile)[og]);
+		tTable.push_back((*gTable)[og]);
+
+		for (int k = (*gInStart)[og]; k < (*gInStart)[og + 1]; k++)
+		{
+			tIn.push_back(wMap[(*gIn)[k]]);
+			tSkew.push_back((*gSkew)[k]);
+		}
+
+		tInStart.push_back(tIn.size());
+	}
+
+	vector<string> tWIDs(nw);
+
+	for (int w = 0; w < nW; w++)
+	{
+		if (wMap[w] != -1) // wires nothing touches any more are dropped.
+			tWIDs[wMap[w]] = (*wIDs)[w];
+	}
+
+	*gType = tType;
+	*gDelay = tDelay;
+	*gOut = tOut;
+	*gInStart = tInStart;
+	*gIn = tIn;
+	*gSkew = tSkew;
+	*gLevel = tLevel;
+	*gIDs = tIDs;
+	*gFile = tFile;
+	*gTable = tTable;
+	*wIDs = tWIDs;
+
+	for (int ip = 0; ip < cntiPads(); ip++)
+		(*iWire)[ip] = wMap[(*iWire)[ip]];
+
+	for (int op = 0; op < cntoPads(); op++)
+		(*oWire)[op] = wMap[(*oWire)[op]];
+
+	linkWires(nw);
+}
+
+//========================
+//Netlist Link Wires
+//========================
+//Parameters:
+//	int	nWires	-	the number of wires
+//Summary:
+//	Rebuilds each wire's driver and fan-out list from the gates. A gate
+//		that reads the same wire twice appears once in its fan-out.
+//Returns:
+//	n/a
+//========================
+void		Netlist::linkWires(int nWires)
+{
+	wDriver->assign(nWires, -1);
+	wFanStart->assign(nWires + 1, 0);
+	wFan->clear();
+
+	for (int g = 0; g < cntGates(); g++)
+		(*wDriver)[(*gOut)[g]] = g;
+
+	vector< vector<int> > fan(nWires);
+
+	for (int g = 0; g < cntGates(); g++)
+	{
+		for (int k = 0; k < cntInputs(g); k++)
+		{
+			int w = getInput(g, k);
+
+			if (fan[w].empty() || (fan[w].back() != g))
+				fan[w].push_back(g);
+		}
+	}
+
+	for (int w = 0; w < nWires; w++)
+	{
+		wFan->insert(wFan->end(), fan[w].begin(), fan[w].end());
+		(*wFanStart)[w + 1] = wFan->size();
+	}
+}
+
+//========================
+//Netlist Levelize
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Gives each gate a level one past the deepest gate that feeds it;
+//		gates fed only by input pads are level 1. Feedback loops (latches
+//		and flip-flops) have no such ordering, so when every remaining
+//		gate waits on a loop, the lowest numbered one is cut loose and
+//		levelled from whatever fan-ins are already done.
+//Returns:
+//	n/a
+//========================
+void		Netlist::levelize()
+{
+	int nG = cntGates();
+
+	vector<int>		pend(nG, 0);	// fan-ins from gates not yet levelled.
+	vector<bool>	done(nG, false);
+	vector<bool>	queued(nG, false);
+	vector<int>		queue;
+
+	for (int g = 0; g < nG; g++)
+	{
+		for (int k = 0; k < cntInputs(g); k++)
+		{
+			if (getDriver(getInput(g, k)) >= 0)
+				pend[g]++;
+		}
+
+		if (pend[g] == 0)
+		{
+			queue.push_back(g);
+			queued[g] = true;
+		}
+	}
+
+	int head = 0;
+	int cut = 0;
+
+	maxLevel = 0;
+
+	while (head < nG)
+	{
+		if (head == queue.size()) // stuck on feedback; cut the loop.
+		{
+			while (queued[cut])
+				cut++;
+
+			queue.push_back(cut);
+			queued[cut] = true;
+		}
+
+		int g = queue[head++];
+		int lv = 0;
+
+		for (int k = 0; k < cntInputs(g); k++)
+		{
+			int d = getDriver(getInput(g, k));
+
+			if ((d >= 0) && done[d] && ((*gLevel)[d] > lv))
+				lv = (*gLevel)[d];
+		}
+
+		(*gLevel)[g] = lv + 1;
+		done[g] = true;
+
+		if (lv + 1 > maxLevel)
+			maxLevel = lv + 1;
+
+		int o = getOutput(g);
+
+		for (int f = 0; f < cntFanout(o); f++)
+		{
+			int r = getFanout(o, f);
+
+			for (int k = 0; k < cntInputs(r); k++)
+			{
+				if (getInput(r, k) == o)
+					pend[r]--;
+			}
+
+			if ((pend[r] == 0) && !queued[r])
+			{
+				queue.push_back(r);
+				queued[r] = true;
+			}
+		}
+	}
+}
+
+//========================
+//Netlist Level Order
+//========================
+//Parameters:
+//	vector<int>	&perm	-	receives the new order
+//Summary:
+//	Gates sorted by level, keeping their current relative order within
+//		a level.
+//Returns:
+//	n/a
+//========================
+void		Netlist::orderLevel(vector<int> &perm)
+{
+	perm.clear();
+
+	vector< vector<int> > byLevel(maxLevel + 1);
+
+	for (int g = 0; g < cntGates(); g++)
+		byLevel[getLevel(g)].push_back(g);
+
+	for (int lv = 0; lv <= maxLevel; lv++)
+		perm.insert(perm.end(), byLevel[lv].begin(), byLevel[lv].end());
+}
+
+//========================
+//Netlist Depth-First Order
+//========================
+//Parameters:
+//	vector<int>	&perm	-	receives the new order
+//Summary:
+//	Post-order depth-first walk back from each output pad through the
+//		gates that drive it, so a gate lands right after its fan-in cone.
+//		Gates that reach no output pad are walked afterward in their
+//		current order. The walk keeps its own stack; deep circuits would
+//		otherwise overflow the call stack.
+//Returns:
+//	n/a
+//========================
+void		Netlist::orderDFS(vector<int> &perm)
+{
+	int nG = cntGates();
+
+	perm.clear();
+
+	vector<bool>	seen(nG, false);
+	vector<int>		roots;
+	vector<int>		stk;
+	vector<int>		pos;
+
+	for (int op = 0; op < cntoPads(); op++)
+	{
+		if (getDriver(getoPadWire(op)) >= 0)
+			roots.push_back(getDriver(getoPadWire(op)));
+	}
+
+	for (int g = 0; g < nG; g++)
+		roots.push_back(g);
+
+	for (int r = 0; r < roots.size(); r++)
+	{
+		if (seen[roots[r]])
+			continue;
+
+		seen[roots[r]] = true;
+		stk.push_back(roots[r]);
+		pos.push_back(0);
+
+		while (!stk.empty())
+		{
+			int g = stk.back();
+			int k = pos.back();
+
+			if (k < cntInputs(g))
+			{
+				pos.back()++;
+
+				int d = getDriver(getInput(g, k));
+
+				if ((d >= 0) && !seen[d])
+				{
+					seen[d] = true;
+					stk.push_back(d);
+					pos.push_back(0);
+				}
+			}
+			else
+			{
+				perm.push_back(g);
+				stk.pop_back();
+				pos.pop_back();
+			}
+		}
+	}
+}
+
+//========================
+//Netlist Reverse Cuthill-McKee Order
+//========================
+//Parameters:
+//	vector<int>	&perm	-	receives the new order
+//Summary:
+//	Treats gate-to-gate connections as an undirected graph and numbers
+//		it breadth-first from a least connected gate, visiting neighbours
+//		least connected first, then reverses the result. This keeps the
+//		largest distance between connected gates (the bandwidth) small.
+//Returns:
+//	n/a
+//========================
+void		Netlist::orderRCM(vector<int> &perm)
+{
+	int nG = cntGates();
+
+	perm.clear();
+
+	vector< vector<int> > adj(nG);
+
+	for (int g = 0; g < nG; g++)
+	{
+		for (int k = 0; k < cntInputs(g); k++)
+		{
+			int d = getDriver(getInput(g, k));
+
+			if ((d >= 0) && (d != g))
+			{
+				adj[g].push_back(d);
+				adj[d].push_back(g);
+			}
+		}
+	}
+
+	for (int g = 0; g < nG; g++)
+	{
+		sort(adj[g].begin(), adj[g].end());
+		adj[g].erase(unique(adj[g].begin(), adj[g].end()), adj[g].end());
+	}
+
+	byDegree cmp;
+	cmp.adj = &adj;
+
+	vector<int> starts(nG);
+
+	for (int g = 0; g < nG; g++)
+		starts[g] = g;
+
+	stable_sort(starts.begin(), starts.end(), cmp);
+
+	vector<bool>	seen(nG, false);
+	int				s = 0;
+
+	while (perm.size() < nG)
+	{
+		while (seen[starts[s]])
+			s++;
+
+		int head = perm.size();
+
+		perm.push_back(starts[s]);
+		seen[starts[s]] = true;
+
+		while (head < perm.size())
+		{
+			int g = perm[head++];
+
+			vector<int> nb;
+
+			for (int a = 0; a < adj[g].size(); a++)
+			{
+				if (!seen[adj[g][a]])
+				{
+					seen[adj[g][a]] = true;
+					nb.push_back(adj[g][a]);
+				}
+			}
+
+			stable_sort(nb.begin(), nb.end(), cmp);
+
+			perm.insert(perm.end(), nb.begin(), nb.end());
+		}
+	}
+
+	reverse(perm.begin(), perm.end());
+}
@@ -0,0 +1,140 @@
+#ifndef NETLIST_H
+#define NETLIST_H
+
+//================================================================
+//Filename:		Compiled Netlist Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of the Netlist, a flat,
+//					index-based copy of a validated Circuit that the
+//					compiled simulation engines run from, along with
+//					the gate orderings it can be renumbered into.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+
+using namespace std;
+
+// Gate orderings the Netlist can be renumbered into. See Netlist::reorder().
+enum orderType {oFile, oLevel, oDFS, oRCM, oBest};
+
+// See Implementation
+orderType	parseOrder(string tO) throw (BasicException);
+
+// See Implementation
+string		orderName(orderType o);
+
+// See Implementation
+state		evalType(gateType t, vector<state> &v);
+
+//==================================
+//Class:	Netlist
+//Parent:	n/a
+//==================================
+//Description:
+//	The Netlist is a flattened copy of a Circuit. Gates and wires become
+//		integer indices, each gate's fan-ins are packed back to back, and
+//		each wire knows its driving gate and its fan-out gates. Wires are
+//		numbered input pad wires first, then gate outputs in gate order,
+//		so renumbering the gates renumbers the wires with them.
+//		Gates start in circuit file order; reorder() moves them into level,
+//		depth-first, or reverse Cuthill-McKee order so that a gate and its
+//		fan-ins sit close together in memory, and the distance functions
+//		report how close. collapse() replaces fanout-free cones of gates
+//		with single lookup table gates, and optimize() removes gates that
+//		do nothing the outputs can see.
+//==================================
+class Netlist
+{
+public:
+				Netlist(Circuit *crc) throw (NullPointerException);
+
+				~Netlist();
+
+	int			cntGates();
+	int			cntWires();
+	int			cntiPads();
+	int			cntoPads();
+
+	gateType	getType(int g);
+	int			getDelay(int g);
+	int			getOutput(int g);
+	int			cntInputs(int g);
+	int			getInput(int g, int k);
+	int			getSkew(int g, int k);
+	int			getLevel(int g);
+	string		getGateID(int g);
+	state		getLUT(int g, int idx);
+
+	int			getDriver(int w);
+	int			cntFanout(int w);
+	int			getFanout(int w, int k);
+	string		getWireID(int w);
+
+	int			getiPadWire(int p);
+	string		getiPadID(int p);
+	int			getoPadWire(int p);
+	string		getoPadID(int p);
+	void		matchPads(Vector *v, vector<int> &iIdx, vector<PadState*> &iPS,
+					vector<int> &oIdx, vector<PadState*> &oPS) throw (BasicException);
+
+	int			getMaxLevel();
+	int			getMaxDelay();
+	int			getPathDelay();
+
+	void		reorder(orderType o);
+	orderType	getOrder();
+
+	int			collapse(int k) throw (BasicException);
+	int			optimize(bool functional) throw (BasicException);
+
+	double		avgGateDistance();
+	double		avgWireDistance();
+	double		pctNear(int span);
+
+private:
+
+	void		renumber(vector<int> &perm);
+	void		linkWires(int nWires);
+	void		levelize();
+	state		coneState(int g, int p, vector<int> &owner, vector<int> &lw, vector<int> &ld, vector<state> &v);
+
+	void		orderLevel(vector<int> &perm);
+	void		orderDFS(vector<int> &perm);
+	void		orderRCM(vector<int> &perm);
+
+	orderType			order;
+	int					maxLevel;
+
+	vector<gateType>*	gType;
+	vector<int>*		gDelay;
+	vector<int>*		gOut;
+	vector<int>*		gInStart;
+	vector<int>*		gIn;
+	vector<int>*		gLevel;
+	vector<string>*		gIDs;
+	vector<int>*		gFile;
+	vector<int>*		gSkew;
+	vector<int>*		gTable;
+	vector<unsigned char>*	luts;
+
+	vector<int>*		wDriver;
+	vector<int>*		wFanStart;
+	vector<int>*		wFan;
+	vector<string>*		wIDs;
+
+	vector<int>*		iWire;
+	vector<string>*		iIDs;
+	vector<int>*		oWire;
+	vector<string>*		oIDs;
+};
+
+#endif //NETLIST_H
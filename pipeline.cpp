@@ -0,0 +1,447 @@
+//================================================================
+//Filename:		Streaming Pipeline Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the Pipeline's three
+//					stages.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <map>
+#include <string>
+#include <iostream>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "loader.h"
+#include "netlist.h"
+#include "engine.h"
+#include "binVector.h"
+#include "pipeline.h"
+
+using namespace std;
+
+// Ints per record in a batch: time, pad, state.
+#define REC_TIME	0
+#define REC_PAD		1
+#define REC_STATE	2
+#define REC_LEN		3
+
+//========================
+//Pipeline Constructor
+//========================
+//Parameters:
+//	Netlist	*n		-	the netlist to simulate
+//	int		tl		-	how long to run past the last input change
+//	int		batch	-	records per batch
+//	int		depth	-	batches each ring holds
+//Summary:
+//	Sets up the pad name lookups and the two rings. tl is the longest
+//		path trace of the circuit, the part of Vector::trace that does not
+//		depend on the vector, so the run ends where Engine::run's would.
+//========================
+Pipeline::Pipeline(Netlist *n, int tl, int batch, int depth) throw (NullPointerException, BasicException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	if (batch < 1)
+		throw BasicException("Batch must hold at least one record.");
+
+	net = n;
+	tail = tl;
+	batchLen = batch;
+	tEnd = 0;
+	vin = NULL;
+	vout = NULL;
+
+	iPads = new map<string, int>();
+	oPads = new map<string, int>();
+
+	for (int p = 0; p < n->cntiPads(); p++)
+		(*iPads)[n->getiPadID(p)] = p;
+
+	for (int p = 0; p < n->cntoPads(); p++)
+		(*oPads)[n->getoPadID(p)] = p;
+
+	parsed = new BatchRing(depth);
+	changes = new BatchRing(depth);
+}
+
+//========================
+//Pipeline Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the lookups and rings. The netlist is not deleted.
+//========================
+Pipeline::~Pipeline()
+{
+	delete iPads;
+	delete oPads;
+	delete parsed;
+	delete changes;
+}
+
+//========================
+//Pipeline Parser
+//========================
+//Parameters:
+//	void	*arg	-	the Pipeline
+//Summary:
+//	Thread entry point for the parse stage.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		Pipeline::parser(void *arg)
+{
+	((Pipeline*) arg)->parse();
+
+	return NULL;
+}
+
+//========================
+//Pipeline Writer
+//========================
+//Parameters:
+//	void	*arg	-	the Pipeline
+//Summary:
+//	Thread entry point for the write stage.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		Pipeline::writer(void *arg)
+{
+	((Pipeline*) arg)->write();
+
+	return NULL;
+}
+
+//========================
+//Pipeline Parse
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The parse stage. Reads the vector file as loadVector does, but turns
+//		each INPUT line for an input pad into a (time, pad, state) record
+//		instead of a PadState entry. A batch is only cut where the time
+//		changes, so a batch always holds every record for the times it
+//		covers. Lines for output pads are skipped, as a run overwrites
+//		them. On an error, the message is kept for run() and the stream
+//		ends early.
+//Returns:
+//	n/a
+//========================
+void		Pipeline::parse()
+{
+	vector<int>*	b = new vector<int>();
+	string			CMD;
+	bool			named = false;
+	int				last = 0;
+
+	try
+	{
+		if (isBinaryVector(*vin))
+		{
+			parseBinary(b);	// reads to the end of the file.
+			named = true;
+		}
+
+		while (!(vin->eof()))
+		{
+			CMD = "";
+
+			*vin >> CMD;
+
+			if ((CMD == "") || (vin->eof()))
+				break;
+
+			if (CMD == "VECTOR")
+			{
+				string tID;
+
+				*vin >> tID;
+
+				if (tID == "")
+					throw NullIDException();
+
+				if (named)
+					throw BasicException("Only one VECTOR may be streamed.");
+
+				named = true;
+			}
+			else if (CMD == "INPUT")
+			{
+				string tID;
+				string tdly;
+				string State;
+
+				*vin >> tID >> tdly >> State;
+
+				int tdly2 = parseTime(tdly);
+
+				if (tdly2 < 0) // avoid invalid delay.
+					tdly2 = 0;
+
+				state State2 = parseState(State);
+
+				if (!named)
+					throw NullPointerException();
+
+				if (tdly2 < last)
+					throw BasicException("Vector file is not sorted by time.");
+
+				if (iPads->count(tID) == 0)
+				{
+					if (oPads->count(tID) == 0)
+						throw BasicException("Vector definitions do not match with circuit definitions.");
+
+					continue;
+				}
+
+				if ((b->size() >= batchLen * REC_LEN) && (tdly2 != last))
+				{
+					parsed->put(b);
+					b = new vector<int>();
+				}
+
+				b->push_back(tdly2);
+				b->push_back((*iPads)[tID]);
+				b->push_back(State2);
+
+				last = tdly2;
+			}
+			else
+				throw BasicException("Unrecognized vector file command.");
+		}
+
+		if (!named)
+			throw BasicException("Vector is undefined.");
+	}
+	catch(BasicException e)
+	{
+		error = e.getMessage();
+	}
+
+	if (!b->empty())
+		parsed->put(b);
+	else
+		delete b;
+
+	parsed->put(NULL);
+}
+
+//========================
+//Pipeline Parse Binary
+//========================
+//Parameters:
+//	vector<int>*	&b	-	the batch being filled; replaced as batches fill
+//Summary:
+//	The parse stage for a binary vector file. Each frame becomes one
+//		record per changed input pad, so there is no text to scan and no
+//		pad name to look up past the header. Batches are cut between
+//		frames.
+//Returns:
+//	n/a
+//========================
+void		Pipeline::parseBinary(vector<int>* &b) throw (BasicException)
+{
+	BinVectorReader	rd(*vin);
+	vector<int>		pad(rd.cntPads());
+
+	for (int p = 0; p < rd.cntPads(); p++)
+	{
+		if (iPads->count(rd.getPadID(p)) == 0)
+			throw BasicException("Vector definitions do not match with circuit definitions.");
+
+		pad[p] = (*iPads)[rd.getPadID(p)];
+	}
+
+	while (rd.next())
+	{
+		if (b->size() >= batchLen * REC_LEN)
+		{
+			parsed->put(b);
+			b = new vector<int>();
+		}
+
+		for (int k = 0; k < rd.cntChanges(); k++)
+		{
+			b->push_back(rd.getTime());
+			b->push_back(pad[rd.getPad(k)]);
+			b->push_back(rd.getState(k));
+		}
+	}
+}
+
+//========================
+//Pipeline Simulate
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The simulate stage. Steps the Engine through every time a parsed
+//		batch covers, applying each record at its time, and batches up
+//		a (time, pad, state) record whenever an output pad changes (all
+//		of them at time 0). Once the parser is done, the run goes on to
+//		the end time: one past the last input change, plus tail.
+//Returns:
+//	n/a
+//========================
+void		Pipeline::simulate()
+{
+	Engine			sim(net);
+	vector<int>		out(net->cntoPads(), -1);
+	vector<int>*	b;
+	vector<int>*	c = new vector<int>();
+	int				ct = 0;
+	int				lastIn = -1;
+
+	sim.reset();
+
+	for (;;)
+	{
+		b = parsed->take();
+
+		int through = (b == NULL) ? tEnd : (*b)[b->size() - REC_LEN + REC_TIME];
+		int r = 0;
+
+		if (b == NULL)
+		{
+			if (error != "")
+				break;
+
+			tEnd = lastIn + 1 + tail;
+			through = tEnd;
+
+			if (tEnd < 1)
+			{
+				error = "Time to run is zero or negative. INVALID!";
+				break;
+			}
+		}
+		else
+			lastIn = through;
+
+		for (; ct <= through; ct++)
+		{
+			for (; (b != NULL) && (r < b->size()) && ((*b)[r + REC_TIME] == ct); r += REC_LEN)
+				sim.setInput((*b)[r + REC_PAD], (state) (*b)[r + REC_STATE]);
+
+			sim.step();
+
+			for (int op = 0; op < out.size(); op++)
+			{
+				if (sim.getOutput(op) != out[op])
+				{
+					out[op] = sim.getOutput(op);
+
+					c->push_back(ct);
+					c->push_back(op);
+					c->push_back(out[op]);
+				}
+			}
+
+			if (c->size() >= batchLen * REC_LEN)
+			{
+				changes->put(c);
+				c = new vector<int>();
+			}
+		}
+
+		if (b == NULL)
+			break;
+
+		delete b;
+	}
+
+	if (!c->empty())
+		changes->put(c);
+	else
+		delete c;
+
+	changes->put(NULL);
+}
+
+//========================
+//Pipeline Write
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The write stage. Prints each output change record as an OUTPUT line,
+//		in the same pad, time, state layout as a vector file's INPUT lines.
+//Returns:
+//	n/a
+//========================
+void		Pipeline::write()
+{
+	vector<int>* c;
+
+	while ((c = changes->take()) != NULL)
+	{
+		for (int r = 0; r < c->size(); r += REC_LEN)
+		{
+			*vout << "OUTPUT\t" << net->getoPadID((*c)[r + REC_PAD]) << "\t"
+				<< (*c)[r + REC_TIME] << "\t" << (*c)[r + REC_STATE] << "\n";
+		}
+
+		delete c;
+	}
+
+	vout->flush();
+}
+
+//========================
+//Pipeline Run
+//========================
+//Parameters:
+//	istream	&in		-	an open vector file, sorted by time
+//	ostream	&out	-	where to write output changes
+//Summary:
+//	Starts the parse and write stages on their own threads, simulates on
+//		this one, and waits for both. If the writer cannot be started,
+//		the parser's batches are thrown away until it ends.
+//Returns:
+//	int	-	the end time of the run
+//========================
+int			Pipeline::run(istream &in, ostream &out) throw (BasicException)
+{
+	pthread_t	pt;
+	pthread_t	wt;
+
+	vin = &in;
+	vout = &out;
+	error = "";
+
+	if (pthread_create(&pt, NULL, parser, this) != 0)
+		throw BasicException("Unable to start the parse stage's thread.");
+
+	if (pthread_create(&wt, NULL, writer, this) != 0)
+	{
+		vector<int>* b;
+
+		while ((b = parsed->take()) != NULL)	// let the parser run out.
+			delete b;
+
+		pthread_join(pt, NULL);
+
+		throw BasicException("Unable to start the write stage's thread.");
+	}
+
+	simulate();
+
+	pthread_join(pt, NULL);
+	pthread_join(wt, NULL);
+
+	if (error != "")
+		throw BasicException(error);
+
+	return tEnd;
+}
@@ -0,0 +1,83 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+//================================================================
+//Filename:		Streaming Pipeline Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of the Pipeline, which
+//					parses, simulates and writes a vector on three
+//					threads joined by Rings.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <map>
+#include <string>
+#include <iostream>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "engine.h"
+#include "ring.h"
+
+using namespace std;
+
+// Batches (vectors of ints) between the pipeline's stages. See Ring.
+typedef Ring<vector<int> >	BatchRing;
+
+//==================================
+//Class:	Pipeline
+//Parent:	n/a
+//==================================
+//Description:
+//	The Pipeline streams a vector file through an Engine. A parser thread
+//		reads INPUT lines and hands them on in batches, each holding every
+//		line for the times it covers; the calling thread steps the Engine
+//		through those times and batches up output pad changes; a writer
+//		thread prints them as OUTPUT lines. Each stage only waits when the
+//		ring ahead of it is full or the ring behind it is empty, so a run
+//		takes about as long as its slowest stage, and the vector is never
+//		held in memory whole. The vector file must list its INPUT lines in
+//		time order; a binary vector file (see BinVectorReader) always does.
+//==================================
+class Pipeline
+{
+public:
+				Pipeline(Netlist *n, int tl, int batch = 4096, int depth = 16) throw (NullPointerException, BasicException);
+
+				~Pipeline();
+
+	int			run(istream &in, ostream &out) throw (BasicException);
+
+private:
+
+	void		parse();
+	void		parseBinary(vector<int>* &b) throw (BasicException);
+	void		simulate();
+	void		write();
+
+static void*	parser(void *arg);
+static void*	writer(void *arg);
+
+	Netlist*			net;
+	int					tail;
+	int					batchLen;
+	int					tEnd;
+
+	map<string, int>*	iPads;
+	map<string, int>*	oPads;
+
+	BatchRing*			parsed;
+	BatchRing*			changes;
+
+	istream*			vin;
+	ostream*			vout;
+	string				error;
+};
+
+#endif //PIPELINE_H
@@ -0,0 +1,364 @@
+//================================================================
+//Filename:		Batch Regression Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the Regression: the
+//					shared mapping, the worker processes, and the
+//					merged report.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "loader.h"
+#include "netlist.h"
+#include "engine.h"
+#include "regress.h"
+#include "zipStream.h"
+
+using namespace std;
+
+// Layout of the shared mapping, in longs: the next unclaimed shard, the
+// results area bytes taken, then one record per shard.
+#define RG_NEXT		0
+#define RG_USED		1
+#define RG_SHARDS	2
+
+// A shard record: its state, the worker that claimed it, its run time,
+// and where its waveforms start in the results area.
+#define SH_STATE	0
+#define SH_PID		1
+#define SH_TRACE	2
+#define SH_OFFSET	3
+#define SH_LEN		4
+
+// Shard states.
+#define SH_PENDING	0
+#define SH_CLAIMED	1
+#define SH_DONE		2
+#define SH_FAILED	3
+
+// Bytes set aside for each shard's message.
+#define MSG_LEN		128
+
+//========================
+//Regression Constructor
+//========================
+//Parameters:
+//	Circuit			*c		-	a loaded, validated circuit
+//	Netlist			*n		-	its netlist, collapsed and ordered as wanted
+//	vector<string>	&vecs	-	the vector files to run
+//	long			bytes	-	size of the shared results area
+//Summary:
+//	Maps the shared memory the workers will use: shard records, messages
+//		and the results area. The circuit and netlist are not copied.
+//========================
+Regression::Regression(Circuit *c, Netlist *n, vector<string> &vecs, long bytes) throw (NullPointerException, BasicException)
+{
+	if ((c == NULL) || (n == NULL))
+		throw NullPointerException();
+
+	if (bytes < 1)
+		throw BasicException("Results area must not be empty.");
+
+	crc = c;
+	net = n;
+	files = new vector<string>(vecs);
+	arenaSize = bytes;
+
+	long head = (RG_SHARDS + SH_LEN * files->size()) * sizeof(long);
+
+	mapSize = head + MSG_LEN * files->size() + arenaSize;
+
+	void* m = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+	if (m == MAP_FAILED)
+		throw BasicException("Unable to map shared results area.");
+
+	memset(m, 0, head + MSG_LEN * files->size());
+
+	shm = (long*) m;
+	msgs = ((char*) m) + head;
+	arena = (unsigned char*) (msgs + MSG_LEN * files->size());
+}
+
+//========================
+//Regression Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Unmaps the shared memory. The circuit and netlist are not deleted.
+//========================
+Regression::~Regression()
+{
+	munmap(shm, mapSize);
+
+	delete files;
+}
+
+//========================
+//Regression Shard Count
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How many vector files the regression runs.
+//Returns:
+//	int	-	the shard count
+//========================
+int			Regression::cntShards()
+{
+	return files->size();
+}
+
+//========================
+//Regression Failed Count
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How many shards did not finish.
+//Returns:
+//	int	-	the failed shard count
+//========================
+int			Regression::cntFailed()
+{
+	int bad = 0;
+
+	for (int s = 0; s < files->size(); s++)
+	{
+		if (shm[RG_SHARDS + SH_LEN * s + SH_STATE] != SH_DONE)
+			bad++;
+	}
+
+	return bad;
+}
+
+//========================
+//Regression Run
+//========================
+//Parameters:
+//	int	procs	-	how many worker processes to fork
+//Summary:
+//	Forks the workers and waits for all of them. A shard still marked
+//		claimed afterwards belonged to a worker that died, and is marked
+//		failed.
+//Returns:
+//	n/a
+//========================
+void		Regression::run(int procs) throw (BasicException)
+{
+	if (procs < 1)
+		throw BasicException("Process count must be at least 1.");
+
+	cout.flush();
+
+	vector<pid_t> kids;
+
+	for (int k = 0; k < procs; k++)
+	{
+		pid_t pid = fork();
+
+		if (pid < 0)
+			break;
+
+		if (pid == 0)
+		{
+			work();
+			_exit(0);
+		}
+
+		kids.push_back(pid);
+	}
+
+	if (kids.empty())
+		throw BasicException("Unable to start worker processes.");
+
+	for (int k = 0; k < kids.size(); k++)
+		waitpid(kids[k], NULL, 0);
+
+	for (int s = 0; s < files->size(); s++)
+	{
+		long* rec = shm + RG_SHARDS + SH_LEN * s;
+
+		if (rec[SH_STATE] == SH_CLAIMED)
+		{
+			rec[SH_STATE] = SH_FAILED;
+			strncpy(msgs + MSG_LEN * s, "Worker process died.", MSG_LEN - 1);
+		}
+		else if (rec[SH_STATE] == SH_PENDING)
+		{
+			rec[SH_STATE] = SH_FAILED;
+			strncpy(msgs + MSG_LEN * s, "Never run.", MSG_LEN - 1);
+		}
+	}
+}
+
+//========================
+//Regression Work
+//========================
+//Parameters:
+//	none
+//Summary:
+//	A worker process's life: compile one Engine, then claim and run
+//		shards until none are left.
+//Returns:
+//	n/a
+//========================
+void		Regression::work()
+{
+	Engine sim(net);
+
+	for (;;)
+	{
+		int s = (int) __sync_fetch_and_add(&shm[RG_NEXT], 1);
+
+		if (s >= files->size())
+			return;
+
+		long* rec = shm + RG_SHARDS + SH_LEN * s;
+
+		rec[SH_PID] = getpid();
+		rec[SH_STATE] = SH_CLAIMED;
+
+		rec[SH_STATE] = shard(s, &sim) ? SH_DONE : SH_FAILED;
+	}
+}
+
+//========================
+//Regression Shard
+//========================
+//Parameters:
+//	int		s	-	the shard to run
+//	Engine	*sim	-	this worker's Engine
+//Summary:
+//	Loads shard s's vector into this worker's copy of the circuit, runs
+//		it, and packs each output pad's waveform, four states to a byte,
+//		into space taken from the results area. Problems are written to
+//		the shard's message.
+//Returns:
+//	bool	-	true if the shard finished
+//========================
+bool		Regression::shard(int s, Engine *sim)
+{
+	long*	rec = shm + RG_SHARDS + SH_LEN * s;
+	char*	msg = msgs + MSG_LEN * s;
+
+	ZipIn fvec((*files)[s]);
+
+	if (fvec.good() == 0)
+	{
+		strncpy(msg, "Unable to open vector file.", MSG_LEN - 1);
+		return false;
+	}
+
+	try
+	{
+		Vector* last = crc->getVector();
+
+		loadVector(crc, fvec);
+
+		if ((last != NULL) && (last != crc->getVector()))
+			delete last; // the previous shard's.
+
+		int trace = crc->getVector()->trace();
+
+		vector<int>			iIdx;
+		vector<PadState*>	iPS;
+		vector<int>			oIdx;
+		vector<PadState*>	oPS;
+
+		net->matchPads(crc->getVector(), iIdx, iPS, oIdx, oPS);
+
+		sim->run(crc->getVector(), trace);
+
+		long row = (trace + 4) / 4;
+		long off = __sync_fetch_and_add(&shm[RG_USED], row * oPS.size());
+
+		if (off + row * oPS.size() > arenaSize)
+		{
+			strncpy(msg, "Results area is full; use a larger -results.", MSG_LEN - 1);
+			return false;
+		}
+
+		for (int op = 0; op < oPS.size(); op++)
+		{
+			unsigned char* bits = arena + off + row * op;
+
+			memset(bits, 0, row);
+
+			for (int ct = 0; ct <= trace; ct++)
+				bits[ct >> 2] |= oPS[op]->getState(ct) << ((ct & 3) * 2);
+		}
+
+		rec[SH_TRACE] = trace;
+		rec[SH_OFFSET] = off;
+	}
+	catch(BasicException e)
+	{
+		strncpy(msg, e.getMessage().c_str(), MSG_LEN - 1);
+		return false;
+	}
+
+	return true;
+}
+
+//========================
+//Regression Report
+//========================
+//Parameters:
+//	ostream	&out	-	where to print
+//Summary:
+//	Prints each shard in order: its file and run time, then each output
+//		pad's waveform the way digibatch run prints it, or the reason
+//		the shard failed. Output pads are listed in circuit order.
+//Returns:
+//	int	-	0 if every shard finished, 1 otherwise
+//========================
+int			Regression::report(ostream &out)
+{
+	for (int s = 0; s < files->size(); s++)
+	{
+		long* rec = shm + RG_SHARDS + SH_LEN * s;
+
+		out << "== " << (*files)[s] << endl;
+
+		if (rec[SH_STATE] != SH_DONE)
+		{
+			out << "Failed: " << (msgs + MSG_LEN * s) << endl;
+			continue;
+		}
+
+		int		trace = (int) rec[SH_TRACE];
+		long	row = (trace + 4) / 4;
+
+		out << "Circuit Run Time: " << trace << "ns" << endl;
+
+		for (int op = 0; op < crc->cntoPads(); op++)
+		{
+			unsigned char* bits = arena + rec[SH_OFFSET] + row * op;
+
+			out << crc->getoPad(op)->getID() << ": ";
+
+			for (int ct = 0; ct <= trace; ct++)
+				out << ((bits[ct >> 2] >> ((ct & 3) * 2)) & 3);
+
+			out << endl;
+		}
+	}
+
+	return (cntFailed() > 0) ? 1 : 0;
+}
@@ -0,0 +1,73 @@
+#ifndef REGRESS_H
+#define REGRESS_H
+
+//================================================================
+//Filename:		Batch Regression Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of the Regression, which
+//					runs many vector files against one compiled
+//					circuit in forked worker processes that share a
+//					work queue and a results area in memory.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "engine.h"
+
+using namespace std;
+
+//==================================
+//Class:	Regression
+//Parent:	n/a
+//==================================
+//Description:
+//	A Regression holds one loaded Circuit, its compiled Netlist, and a
+//		list of vector files (the shards). run() forks worker processes
+//		after everything is loaded and compiled, so every worker starts
+//		with the same read-only copy of the circuit and netlist without
+//		reading or compiling them again. The workers claim shards from
+//		a counter in a shared memory mapping, simulate them, and pack
+//		each output pad's waveform at two bits per nanosecond into a
+//		results area in the same mapping. A worker that crashes only
+//		loses the shard it was on. report() prints every shard's output
+//		pads in the order the vector files were given.
+//==================================
+class Regression
+{
+public:
+				Regression(Circuit *c, Netlist *n, vector<string> &vecs, long bytes) throw (NullPointerException, BasicException);
+
+				~Regression();
+
+	void		run(int procs) throw (BasicException);
+	int			report(ostream &out);
+
+	int			cntShards();
+	int			cntFailed();
+
+private:
+
+	void		work();
+	bool		shard(int s, Engine *sim);
+
+	Circuit*		crc;
+	Netlist*		net;
+	vector<string>*	files;
+
+	long*			shm;		// the shared mapping: counters, then shard records.
+	char*			msgs;		// one message per shard, in the mapping.
+	unsigned char*	arena;		// packed waveforms, in the mapping.
+	long			arenaSize;
+	long			mapSize;
+};
+
+#endif //REGRESS_H
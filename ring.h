@@ -0,0 +1,146 @@
+#ifndef RING_H
+#define RING_H
+
+//================================================================
+//Filename:		Ring Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains Ring, the bounded single producer, single
+//					consumer queue of pointers that joins the threads
+//					of the streaming pipeline and the compressed file
+//					streams.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <sched.h>
+#include "logicException.h"
+
+using namespace std;
+
+//==================================
+//Class:	Ring
+//Parent:	n/a
+//==================================
+//Description:
+//	A Ring passes pointers to T from exactly one thread to exactly one
+//		other through a fixed number of slots. Only the producer moves
+//		head and only the consumer moves tail, so no lock is needed; a
+//		memory barrier orders each slot's contents before the index that
+//		publishes it. put() waits while the ring is full and take() while
+//		it is empty, which is the backpressure between stages. A NULL
+//		marks the end of the stream. Whatever is still in the ring when
+//		it is destroyed is deleted with it.
+//==================================
+template <class T>
+class Ring
+{
+public:
+				Ring(int n) throw (BasicException);
+
+				~Ring();
+
+	void		put(T *b);
+	T*			take();
+
+private:
+
+	vector<T*>*		slots;
+	int				size;
+	volatile int	head;	// next slot to fill.
+	volatile int	tail;	// next slot to empty.
+};
+
+//========================
+//Ring Constructor
+//========================
+//Parameters:
+//	int	n	-	how many entries the ring holds
+//Summary:
+//	Creates an empty ring.
+//========================
+template <class T>
+Ring<T>::Ring(int n) throw (BasicException)
+{
+	if (n < 1)
+		throw BasicException("Ring must hold at least one entry.");
+
+	size = n + 1; // one slot stays empty to tell full from empty.
+	slots = new vector<T*>(size, (T*) NULL);
+	head = 0;
+	tail = 0;
+}
+
+//========================
+//Ring Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Deletes any entries still in the ring.
+//========================
+template <class T>
+Ring<T>::~Ring()
+{
+	for (; tail != head; tail = (tail + 1) % size)
+		delete (*slots)[tail];
+
+	delete slots;
+}
+
+//========================
+//Ring Put
+//========================
+//Parameters:
+//	T	*b	-	an entry, or NULL to end the stream
+//Summary:
+//	Producer side: waits for a free slot, then publishes b. The ring
+//		owns b until it is taken.
+//Returns:
+//	n/a
+//========================
+template <class T>
+void		Ring<T>::put(T *b)
+{
+	int next = (head + 1) % size;
+
+	while (next == tail)
+		sched_yield();
+
+	(*slots)[head] = b;
+
+	__sync_synchronize(); // the slot before the index that publishes it.
+
+	head = next;
+}
+
+//========================
+//Ring Take
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Consumer side: waits for an entry, then removes it. The caller owns
+//		the entry.
+//Returns:
+//	T*	-	the entry, or NULL at the end of the stream
+//========================
+template <class T>
+T*			Ring<T>::take()
+{
+	while (tail == head)
+		sched_yield();
+
+	__sync_synchronize(); // the index before the slot it published.
+
+	T* b = (*slots)[tail];
+
+	__sync_synchronize(); // done with the slot before handing it back.
+
+	tail = (tail + 1) % size;
+
+	return b;
+}
+
+#endif //RING_H
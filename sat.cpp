@@ -0,0 +1,909 @@
+//================================================================
+//Filename:		SAT Solver Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for Sat: propagation over
+//					watched literals, conflict analysis, the decision
+//					heap, restarts and learned clause reduction.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include "logicException.h"
+#include "sat.h"
+
+using namespace std;
+
+// Conflicts in the shortest restart; the Luby sequence scales it.
+#define RESTART_BASE	100
+
+// Learned clauses kept before the first reduction, and its growth after.
+#define LEARNT_START	5000
+#define LEARNT_GROWTH	1.1
+
+// Activity decay per conflict.
+#define VAR_DECAY		0.95
+
+// Orders learned clauses worst first for reduce(): most levels, then oldest.
+struct byLbd
+{
+	vector<int>*	arena;
+
+	bool operator() (int a, int b) const
+	{
+		if ((*arena)[a + 2] != (*arena)[b + 2])
+			return (*arena)[a + 2] > (*arena)[b + 2];
+
+		return a < b;
+	}
+};
+
+// The x'th term of the Luby sequence 1 1 2 1 1 2 4 1 1 2 ...
+static long	luby(int x)
+{
+	int size = 1;
+	int seq = 0;
+
+	while (size < x + 1)
+	{
+		seq++;
+		size = 2 * size + 1;
+	}
+
+	while (size - 1 != x)
+	{
+		size = (size - 1) >> 1;
+		seq--;
+		x = x % size;
+	}
+
+	return 1L << seq;
+}
+
+//========================
+//Sat Constructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	An empty problem with no variables.
+//========================
+Sat::Sat()
+{
+	nVars = 0;
+	broken = false;
+
+	arena = new vector<int>();
+	originals = new vector<int>();
+	learnts = new vector<int>();
+	watches = new vector< vector<int> >();
+
+	assign = new vector<unsigned char>();
+	phase = new vector<unsigned char>();
+	model = new vector<unsigned char>();
+	level = new vector<int>();
+	reason = new vector<int>();
+	trail = new vector<int>();
+	trailLim = new vector<int>();
+	qhead = 0;
+
+	activity = new vector<double>();
+	varInc = 1.0;
+	heap = new vector<int>();
+	heapPos = new vector<int>();
+	seen = new vector<unsigned char>();
+
+	conflicts = 0;
+	decisions = 0;
+	propagations = 0;
+	maxLearnts = LEARNT_START;
+}
+
+//========================
+//Sat Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the clauses and assignments.
+//========================
+Sat::~Sat()
+{
+	delete arena;
+	delete originals;
+	delete learnts;
+	delete watches;
+	delete assign;
+	delete phase;
+	delete model;
+	delete level;
+	delete reason;
+	delete trail;
+	delete trailLim;
+	delete activity;
+	delete heap;
+	delete heapPos;
+	delete seen;
+}
+
+//========================
+//Sat New Variable
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Adds a variable, unset, with no activity.
+//Returns:
+//	int	-	its number
+//========================
+int			Sat::newVar()
+{
+	int v = nVars++;
+
+	watches->push_back(vector<int>());
+	watches->push_back(vector<int>());
+	assign->push_back(2);
+	phase->push_back(0);
+	model->push_back(0);
+	level->push_back(0);
+	reason->push_back(-1);
+	activity->push_back(0.0);
+	heapPos->push_back(-1);
+	seen->push_back(0);
+
+	heapPush(v);
+
+	return v;
+}
+
+//========================
+//Sat Accessors
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Variables, problem and learned clauses now held (after any units
+//		and clauses true for good are dropped), and the conflicts,
+//		decisions and propagated assignments so far.
+//Returns:
+//	int or long	-	the count
+//========================
+int			Sat::cntVars()
+{
+	return nVars;
+}
+
+int			Sat::cntClauses()
+{
+	return originals->size();
+}
+
+int			Sat::cntLearnts()
+{
+	return learnts->size();
+}
+
+long		Sat::cntConflicts()
+{
+	return conflicts;
+}
+
+long		Sat::cntDecisions()
+{
+	return decisions;
+}
+
+long		Sat::cntPropagations()
+{
+	return propagations;
+}
+
+//========================
+//Sat Value
+//========================
+//Parameters:
+//	int	lit	-	a literal
+//Summary:
+//	The literal's value under the current assignment.
+//Returns:
+//	int	-	0, 1, or 2 for unset
+//========================
+int			Sat::value(int lit)
+{
+	int a = (*assign)[lit >> 1];
+
+	return (a == 2) ? 2 : (a ^ (lit & 1));
+}
+
+//========================
+//Sat Get Value
+//========================
+//Parameters:
+//	int	v	-	a variable
+//Summary:
+//	The variable's value in the solution the last SAT_TRUE solve() found.
+//Returns:
+//	bool	-	the value
+//========================
+bool		Sat::getValue(int v)
+{
+	return (*model)[v] == 1;
+}
+
+//========================
+//Sat Enqueue
+//========================
+//Parameters:
+//	int	lit		-	a literal now unset
+//	int	from	-	the clause forcing it, or -1 for a decision
+//Summary:
+//	Makes lit true at the current level.
+//Returns:
+//	n/a
+//========================
+void		Sat::enqueue(int lit, int from)
+{
+	int v = lit >> 1;
+
+	(*assign)[v] = (lit & 1) ^ 1;
+	(*level)[v] = trailLim->size();
+	(*reason)[v] = from;
+	trail->push_back(lit);
+}
+
+//========================
+//Sat Attach
+//========================
+//Parameters:
+//	vector<int>	&lits		-	two or more literals, the first two unset
+//							or, for a learned clause, first the one to
+//							assert
+//	bool		learnt		-	whether the clause was learned
+//	int			lbd			-	its decision levels, if learned
+//Summary:
+//	Stores a clause and watches its first two literals.
+//Returns:
+//	int	-	its offset in the arena
+//========================
+int			Sat::attach(vector<int> &lits, bool learnt, int lbd)
+{
+	int cr = arena->size();
+
+	arena->push_back(lits.size());
+	arena->push_back(learnt ? 1 : 0);
+	arena->push_back(lbd);
+	arena->insert(arena->end(), lits.begin(), lits.end());
+
+	(*watches)[lits[0] ^ 1].push_back(cr);
+	(*watches)[lits[0] ^ 1].push_back(lits[1]);
+	(*watches)[lits[1] ^ 1].push_back(cr);
+	(*watches)[lits[1] ^ 1].push_back(lits[0]);
+
+	if (learnt)
+		learnts->push_back(cr);
+	else
+		originals->push_back(cr);
+
+	return cr;
+}
+
+//========================
+//Sat Add Clause
+//========================
+//Parameters:
+//	vector<int>	&lits	-	the literals, any of which may be true
+//Summary:
+//	Adds a clause between solve() calls. Repeats and literals false for
+//		good are dropped; a clause that always holds is not kept, and
+//		one literal is simply made true.
+//Returns:
+//	bool	-	false once the clauses can no longer all hold
+//========================
+bool		Sat::addClause(vector<int> &lits)
+{
+	if (broken)
+		return false;
+
+	vector<int> c(lits);
+
+	sort(c.begin(), c.end());
+
+	int j = 0;
+
+	for (int i = 0; i < c.size(); i++)
+	{
+		if (value(c[i]) == 1)
+			return true;
+
+		if ((i + 1 < c.size()) && (c[i + 1] == (c[i] ^ 1)))
+			return true;
+
+		if ((value(c[i]) == 2) && ((j == 0) || (c[j - 1] != c[i])))
+			c[j++] = c[i];
+	}
+
+	c.resize(j);
+
+	if (c.empty())
+		broken = true;
+	else if (c.size() == 1)
+	{
+		enqueue(c[0], -1);
+
+		if (propagate() >= 0)
+			broken = true;
+	}
+	else
+		attach(c, false, 0);
+
+	return !broken;
+}
+
+//========================
+//Sat Propagate
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Carries out every assignment the clauses force, visiting for each
+//		literal made true only the clauses watching its negation. A
+//		clause whose other watched literal (its blocker) is true is
+//		passed over; otherwise it moves its watch to a literal not false,
+//		or if none, forces its other watched literal or is a conflict.
+//Returns:
+//	int	-	the conflicting clause, or -1
+//========================
+int			Sat::propagate()
+{
+	int confl = -1;
+
+	while ((confl < 0) && (qhead < trail->size()))
+	{
+		int				p = (*trail)[qhead++];
+		int				fl = p ^ 1;
+		vector<int>&	ws = (*watches)[p];
+		int				i = 0;
+		int				j = 0;
+		int				n = ws.size();
+
+		propagations++;
+
+		while (i < n)
+		{
+			int cr = ws[i];
+			int blk = ws[i + 1];
+
+			i += 2;
+
+			if (value(blk) == 1)
+			{
+				ws[j++] = cr;
+				ws[j++] = blk;
+				continue;
+			}
+
+			int*	c = &(*arena)[cr + 3];
+			int		sz = (*arena)[cr];
+
+			if (c[0] == fl)
+			{
+				c[0] = c[1];
+				c[1] = fl;
+			}
+
+			int first = c[0];
+
+			if ((first != blk) && (value(first) == 1))
+			{
+				ws[j++] = cr;
+				ws[j++] = first;
+				continue;
+			}
+
+			bool moved = false;
+
+			for (int k = 2; k < sz; k++)
+			{
+				if (value(c[k]) != 0)
+				{
+					c[1] = c[k];
+					c[k] = fl;
+					(*watches)[c[1] ^ 1].push_back(cr);
+					(*watches)[c[1] ^ 1].push_back(first);
+					moved = true;
+					break;
+				}
+			}
+
+			if (moved)
+				continue;
+
+			ws[j++] = cr;
+			ws[j++] = first;
+
+			if (value(first) == 0)
+			{
+				confl = cr;
+				qhead = trail->size();
+
+				while (i < n)
+					ws[j++] = ws[i++];
+			}
+			else
+				enqueue(first, cr);
+		}
+
+		ws.resize(j);
+	}
+
+	return confl;
+}
+
+//========================
+//Sat Analyze
+//========================
+//Parameters:
+//	int			confl	-	a clause false under the assignment
+//	vector<int>	&learnt	-	receives the learned clause, asserting first
+//	int			&back	-	receives the level to jump back to
+//	int			&lbd	-	receives the clause's count of levels
+//Summary:
+//	Resolves the conflict clause with the reasons of its literals set at
+//		the current level, latest first, until one such literal is left
+//		(the first unique implication point); its negation and the other
+//		literals, less any whose reason the rest already imply, are the
+//		learned clause. Every variable met gains activity.
+//Returns:
+//	n/a
+//========================
+void		Sat::analyze(int confl, vector<int> &learnt, int &back, int &lbd)
+{
+	int pathC = 0;
+	int p = -1;
+	int idx = trail->size() - 1;
+	int top = trailLim->size();
+
+	learnt.clear();
+	learnt.push_back(-1);
+
+	do
+	{
+		int*	c = &(*arena)[confl + 3];
+		int		sz = (*arena)[confl];
+
+		for (int k = (p < 0) ? 0 : 1; k < sz; k++)
+		{
+			int q = c[k];
+			int v = q >> 1;
+
+			if ((*seen)[v] || ((*level)[v] == 0))
+				continue;
+
+			(*seen)[v] = 1;
+			bump(v);
+
+			if ((*level)[v] >= top)
+				pathC++;
+			else
+				learnt.push_back(q);
+		}
+
+		while (!(*seen)[(*trail)[idx] >> 1])
+			idx--;
+
+		p = (*trail)[idx--];
+		confl = (*reason)[p >> 1];
+		(*seen)[p >> 1] = 0;
+		pathC--;
+	}
+	while (pathC > 0);
+
+	learnt[0] = p ^ 1;
+
+	vector<int>	all(learnt);
+	int			j = 1;
+
+	for (int i = 1; i < learnt.size(); i++)
+	{
+		int r = (*reason)[learnt[i] >> 1];
+		bool keep = (r < 0);
+
+		for (int k = 1; !keep && (k < (*arena)[r]); k++)
+		{
+			int v = (*arena)[r + 3 + k] >> 1;
+
+			keep = !(*seen)[v] && ((*level)[v] > 0);
+		}
+
+		if (keep)
+			learnt[j++] = learnt[i];
+	}
+
+	learnt.resize(j);
+
+	for (int i = 1; i < all.size(); i++)
+		(*seen)[all[i] >> 1] = 0;
+
+	back = 0;
+
+	if (learnt.size() > 1)
+	{
+		int m = 1;
+
+		for (int i = 2; i < learnt.size(); i++)
+		{
+			if ((*level)[learnt[i] >> 1] > (*level)[learnt[m] >> 1])
+				m = i;
+		}
+
+		std::swap(learnt[1], learnt[m]);
+		back = (*level)[learnt[1] >> 1];
+	}
+
+	vector<int> lvs;
+
+	for (int i = 0; i < learnt.size(); i++)
+		lvs.push_back((*level)[learnt[i] >> 1]);
+
+	sort(lvs.begin(), lvs.end());
+	lbd = unique(lvs.begin(), lvs.end()) - lvs.begin();
+}
+
+//========================
+//Sat Cancel
+//========================
+//Parameters:
+//	int	lv	-	the level to go back to
+//Summary:
+//	Unsets everything assigned above lv, saving each value as the
+//		variable's phase and returning it to the heap.
+//Returns:
+//	n/a
+//========================
+void		Sat::cancel(int lv)
+{
+	if (trailLim->size() <= lv)
+		return;
+
+	for (int i = trail->size() - 1; i >= (*trailLim)[lv]; i--)
+	{
+		int v = (*trail)[i] >> 1;
+
+		(*phase)[v] = (*assign)[v];
+		(*assign)[v] = 2;
+		(*reason)[v] = -1;
+
+		if ((*heapPos)[v] < 0)
+			heapPush(v);
+	}
+
+	trail->resize((*trailLim)[lv]);
+	trailLim->resize(lv);
+	qhead = trail->size();
+}
+
+//========================
+//Sat Reduce
+//========================
+//Parameters:
+//	none
+//Summary:
+//	At level 0, throws away the worse half of the learned clauses (those
+//		of two levels are always kept), drops clauses already true and
+//		literals already false, and rebuilds the arena and watches.
+//Returns:
+//	n/a
+//========================
+void		Sat::reduce()
+{
+	byLbd cmp;
+
+	cmp.arena = arena;
+	sort(learnts->begin(), learnts->end(), cmp);
+
+	vector<int>	keepL;
+	int			drop = learnts->size() / 2;
+
+	for (int k = 0; k < learnts->size(); k++)
+	{
+		int cr = (*learnts)[k];
+
+		if ((k >= drop) || ((*arena)[cr + 2] <= 2))
+			keepL.push_back(cr);
+	}
+
+	vector<int>*	old = arena;
+	vector<int>		keepO(*originals);
+
+	arena = new vector<int>();
+	originals->clear();
+	learnts->clear();
+
+	for (int l = 0; l < watches->size(); l++)
+		(*watches)[l].clear();
+
+	for (int i = 0; i < trail->size(); i++)
+		(*reason)[(*trail)[i] >> 1] = -1;
+
+	for (int pass = 0; pass < 2; pass++)
+	{
+		vector<int>& list = (pass == 0) ? keepO : keepL;
+
+		for (int k = 0; k < list.size(); k++)
+		{
+			int			cr = list[k];
+			int			sz = (*old)[cr];
+			vector<int>	c;
+			bool		sat = false;
+
+			for (int i = 0; (i < sz) && !sat; i++)
+			{
+				int q = (*old)[cr + 3 + i];
+
+				if (value(q) == 1)
+					sat = true;
+				else if (value(q) == 2)
+					c.push_back(q);
+			}
+
+			if (sat)
+				continue;
+
+			if (c.size() == 1)
+				enqueue(c[0], -1);
+			else if (c.size() > 1)
+				attach(c, pass == 1, (*old)[cr + 2]);
+		}
+	}
+
+	delete old;
+}
+
+//========================
+//Sat Solve
+//========================
+//Parameters:
+//	vector<int>	&assume	-	literals to hold true for this call only
+//	long		limit	-	conflicts allowed, or -1 for no limit
+//Summary:
+//	Searches for a setting that makes every clause and assumption true.
+//		The assumptions are decided first, one level each. Learned
+//		clauses stay for later calls.
+//Returns:
+//	int	-	SAT_TRUE (see getValue), SAT_FALSE, or SAT_UNKNOWN past the
+//				limit
+//========================
+int			Sat::solve(vector<int> &assume, long limit)
+{
+	if (broken)
+		return SAT_FALSE;
+
+	if (maxLearnts < originals->size() / 3)
+		maxLearnts = originals->size() / 3;
+
+	long		start = conflicts;
+	int			restarts = 0;
+	long		sinceRestart = 0;
+	long		nextRestart = RESTART_BASE;
+	int			result = SAT_UNKNOWN;
+	vector<int>	learnt;
+
+	while (true)
+	{
+		int confl = propagate();
+
+		if (confl >= 0)
+		{
+			conflicts++;
+			sinceRestart++;
+
+			if (trailLim->empty())
+			{
+				broken = true;
+				result = SAT_FALSE;
+				break;
+			}
+
+			int back;
+			int lbd;
+
+			analyze(confl, learnt, back, lbd);
+			cancel(back);
+
+			if (learnt.size() == 1)
+				enqueue(learnt[0], -1);
+			else
+				enqueue(learnt[0], attach(learnt, true, lbd));
+
+			varInc /= VAR_DECAY;
+			continue;
+		}
+
+		if ((limit >= 0) && (conflicts - start >= limit))
+			break;
+
+		if (sinceRestart >= nextRestart)
+		{
+			cancel(0);
+			sinceRestart = 0;
+			nextRestart = RESTART_BASE * luby(++restarts);
+
+			if (learnts->size() >= maxLearnts)
+			{
+				reduce();
+				maxLearnts = (int) (maxLearnts * LEARNT_GROWTH);
+			}
+
+			continue;
+		}
+
+		int next = -1;
+
+		while (trailLim->size() < assume.size())
+		{
+			int a = assume[trailLim->size()];
+
+			if (value(a) == 1)
+				trailLim->push_back(trail->size());	// already true: an empty level.
+			else if (value(a) == 0)
+			{
+				result = SAT_FALSE;
+				break;
+			}
+			else
+			{
+				next = a;
+				break;
+			}
+		}
+
+		if (result == SAT_FALSE)
+			break;
+
+		if (next < 0)
+		{
+			while (!heap->empty() && ((*assign)[(*heap)[0]] != 2))
+				heapPop();
+
+			if (heap->empty())
+			{
+				for (int v = 0; v < nVars; v++)
+					(*model)[v] = (*assign)[v];
+
+				result = SAT_TRUE;
+				break;
+			}
+
+			int v = heapPop();
+
+			next = 2 * v + ((*phase)[v] ? 0 : 1);
+		}
+
+		decisions++;
+		trailLim->push_back(trail->size());
+		enqueue(next, -1);
+	}
+
+	cancel(0);
+
+	return result;
+}
+
+//========================
+//Sat Bump
+//========================
+//Parameters:
+//	int	v	-	a variable met in a conflict
+//Summary:
+//	Raises v's activity, scaling every activity down when they grow too
+//		large. Later conflicts count for more, since the increment grows.
+//Returns:
+//	n/a
+//========================
+void		Sat::bump(int v)
+{
+	if (((*activity)[v] += varInc) > 1e100)
+	{
+		for (int k = 0; k < nVars; k++)
+			(*activity)[k] *= 1e-100;
+
+		varInc *= 1e-100;
+	}
+
+	if ((*heapPos)[v] >= 0)
+		heapUp((*heapPos)[v]);
+}
+
+//========================
+//Sat Prefer
+//========================
+//Parameters:
+//	int	v	-	a variable
+//Summary:
+//	Makes v the most active variable, so it is the next decided.
+//Returns:
+//	n/a
+//========================
+void		Sat::prefer(int v)
+{
+	double top = heap->empty() ? 0.0 : (*activity)[(*heap)[0]];
+
+	(*activity)[v] = max(top, (*activity)[v]);
+	bump(v);
+}
+
+//========================
+//Sat Heap
+//========================
+//Parameters:
+//	int	i	-	a place in the heap
+//	int	v	-	a variable not in the heap
+//Summary:
+//	A binary heap of variables, most active at the top: sift a place up
+//		or down, add a variable, or take the top one.
+//Returns:
+//	int	-	heapPop() returns the variable taken
+//========================
+void		Sat::heapUp(int i)
+{
+	int v = (*heap)[i];
+
+	while ((i > 0) && ((*activity)[(*heap)[(i - 1) / 2]] < (*activity)[v]))
+	{
+		(*heap)[i] = (*heap)[(i - 1) / 2];
+		(*heapPos)[(*heap)[i]] = i;
+		i = (i - 1) / 2;
+	}
+
+	(*heap)[i] = v;
+	(*heapPos)[v] = i;
+}
+
+void		Sat::heapDown(int i)
+{
+	int v = (*heap)[i];
+	int n = heap->size();
+
+	while (2 * i + 1 < n)
+	{
+		int c = 2 * i + 1;
+
+		if ((c + 1 < n) && ((*activity)[(*heap)[c + 1]] > (*activity)[(*heap)[c]]))
+			c++;
+
+		if ((*activity)[(*heap)[c]] <= (*activity)[v])
+			break;
+
+		(*heap)[i] = (*heap)[c];
+		(*heapPos)[(*heap)[i]] = i;
+		i = c;
+	}
+
+	(*heap)[i] = v;
+	(*heapPos)[v] = i;
+}
+
+void		Sat::heapPush(int v)
+{
+	heap->push_back(v);
+	heapUp(heap->size() - 1);
+}
+
+int			Sat::heapPop()
+{
+	int v = (*heap)[0];
+
+	(*heapPos)[v] = -1;
+	(*heap)[0] = heap->back();
+	heap->pop_back();
+
+	if (!heap->empty())
+		heapDown(0);
+
+	return v;
+}
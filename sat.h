@@ -0,0 +1,118 @@
+#ifndef SAT_H
+#define SAT_H
+
+//================================================================
+//Filename:		SAT Solver Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of Sat, a conflict driven
+//					clause learning solver for clauses over boolean
+//					variables.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+
+using namespace std;
+
+// solve() results.
+#define SAT_TRUE		0
+#define SAT_FALSE		1
+#define SAT_UNKNOWN		2
+
+//==================================
+//Class:	Sat
+//Parent:	n/a
+//==================================
+//Description:
+//	Sat decides whether a set of clauses can all be made true at once,
+//		and if so gives a setting that does. Variables are numbered from
+//		0 by newVar(); a literal is 2 * variable for the variable, plus 1
+//		for its negation, so lit ^ 1 negates a literal.
+//		The search is conflict driven clause learning. Each clause watches
+//		two of its literals, so an assignment only visits the clauses
+//		watching the literal it falsifies. A decision picks the unset
+//		variable most active in recent conflicts, with the value it last
+//		had. When a clause becomes false, the conflict is traced back
+//		through the clauses that forced each assignment to the first
+//		point where one assignment at the latest decision level explains
+//		it all; the clause learned from there is added, and the search
+//		jumps back to the level where it forces something new. Restarts
+//		follow the Luby sequence; at a restart, if the learned clauses
+//		have grown too many, the half with the most decision levels among
+//		their literals is thrown away and clauses true for good are
+//		dropped.
+//		Clauses may be added between calls, and a call can assume
+//		literals true for that call only, so one Sat can answer many
+//		related questions and keep what it learns.
+//==================================
+class Sat
+{
+public:
+				Sat();
+
+				~Sat();
+
+	int			newVar();
+	int			cntVars();
+	int			cntClauses();
+	int			cntLearnts();
+	long		cntConflicts();
+	long		cntDecisions();
+	long		cntPropagations();
+
+	bool		addClause(vector<int> &lits);
+	int			solve(vector<int> &assume, long limit = -1);
+	bool		getValue(int v);
+	void		prefer(int v);
+
+private:
+
+	int			value(int lit);
+	void		enqueue(int lit, int from);
+	int			propagate();
+	void		analyze(int confl, vector<int> &learnt, int &back, int &lbd);
+	void		cancel(int lv);
+	int			attach(vector<int> &lits, bool learnt, int lbd);
+	void		reduce();
+	void		bump(int v);
+	void		heapUp(int i);
+	void		heapDown(int i);
+	void		heapPush(int v);
+	int			heapPop();
+
+	int						nVars;
+	bool					broken;		// a clause false with nothing assumed.
+
+	vector<int>*			arena;		// per clause: size, learnt, lbd, literals.
+	vector<int>*			originals;	// clause offsets in the arena.
+	vector<int>*			learnts;
+	vector< vector<int> >*	watches;	// per literal: clause, blocker pairs for
+										//   clauses whose first two hold its negation.
+
+	vector<unsigned char>*	assign;		// per variable: 0, 1, or 2 for unset.
+	vector<unsigned char>*	phase;		// per variable: the value it last had.
+	vector<unsigned char>*	model;		// per variable: the last solution.
+	vector<int>*			level;
+	vector<int>*			reason;		// per variable: the clause that set it, or -1.
+	vector<int>*			trail;
+	vector<int>*			trailLim;	// per level: where its part of the trail starts.
+	int						qhead;
+
+	vector<double>*			activity;
+	double					varInc;
+	vector<int>*			heap;		// unset variables, most active first.
+	vector<int>*			heapPos;	// per variable: its place in the heap, or -1.
+	vector<unsigned char>*	seen;
+
+	long					conflicts;
+	long					decisions;
+	long					propagations;
+	int						maxLearnts;
+};
+
+#endif //SAT_H
@@ -0,0 +1,506 @@
+//================================================================
+//Filename:		Random Stimulus Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for Xoshiro and for
+//					RandomRuns: the pad constraints, the per-run
+//					streams, and the threads that run them.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "engine.h"
+#include "stimulus.h"
+
+using namespace std;
+
+// FNV-1a, 64 bit.
+#define FNV_START	14695981039346656037ULL
+#define FNV_PRIME	1099511628211ULL
+
+// Rotates x left by k bits.
+static inline unsigned long long	rotl(unsigned long long x, int k)
+{
+	return (x << k) | (x >> (64 - k));
+}
+
+// Converts a chance from 0 to 1 into a threshold for a 32-bit draw.
+static unsigned int	chance(double p)
+{
+	if (p <= 0)
+		return 0;
+
+	if (p >= 1)
+		return 0xffffffffU;
+
+	return (unsigned int) (p * 4294967296.0);
+}
+
+//========================
+//Xoshiro Constructor
+//========================
+//Parameters:
+//	unsigned long long	seed	-	any value
+//Summary:
+//	Fills the state with four splitmix64 draws from seed, which never
+//		gives the all-zero state xoshiro cannot leave.
+//========================
+Xoshiro::Xoshiro(unsigned long long seed)
+{
+	for (int k = 0; k < 4; k++)
+	{
+		unsigned long long z = (seed += 0x9e3779b97f4a7c15ULL);
+
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		s[k] = z ^ (z >> 31);
+	}
+}
+
+//========================
+//Xoshiro Next
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Draws the next 64 random bits.
+//Returns:
+//	unsigned long long	-	the draw
+//========================
+unsigned long long	Xoshiro::next()
+{
+	unsigned long long result = rotl(s[1] * 5, 7) * 9;
+	unsigned long long t = s[1] << 17;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = rotl(s[3], 45);
+
+	return result;
+}
+
+//========================
+//Xoshiro Jump
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Moves the generator as far as 2^128 calls to next() would, using the
+//		published jump polynomial.
+//Returns:
+//	n/a
+//========================
+void		Xoshiro::jump()
+{
+	static const unsigned long long JUMP[4] =
+	{
+		0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+		0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+	};
+
+	unsigned long long t[4] = {0, 0, 0, 0};
+
+	for (int k = 0; k < 4; k++)
+	{
+		for (int b = 0; b < 64; b++)
+		{
+			if (JUMP[k] & (1ULL << b))
+			{
+				for (int j = 0; j < 4; j++)
+					t[j] ^= s[j];
+			}
+
+			next();
+		}
+	}
+
+	for (int j = 0; j < 4; j++)
+		s[j] = t[j];
+}
+
+//========================
+//RandomRuns Constructor
+//========================
+//Parameters:
+//	Netlist				*n		-	the netlist to simulate
+//	unsigned long long	seed	-	seeds every run
+//	int					nt		-	how many threads, each with an Engine
+//Summary:
+//	Compiles one Engine per thread and gives every input pad a toggle
+//		rate of 1/10, no X and a hold time of 1ns. The netlist must
+//		outlive the RandomRuns and must not change while it is in use.
+//========================
+RandomRuns::RandomRuns(Netlist *n, unsigned long long seed, int nt) throw (NullPointerException, BasicException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	if (nt < 1)
+		throw BasicException("Thread count must be at least 1.");
+
+	net = n;
+	nThreads = nt;
+	tStop = 0;
+	nRuns = 0;
+	nextRun = 0;
+	seat = 0;
+
+	toggles = new vector<unsigned int>(net->cntiPads(), chance(0.1));
+	xrates = new vector<unsigned int>(net->cntiPads(), 0);
+	holds = new vector<int>(net->cntiPads(), 1);
+	streams = new vector<Xoshiro>(1, Xoshiro(seed));
+	hashes = new vector<unsigned long long>();
+	engines = new vector<Engine*>(nThreads, (Engine*) NULL);
+	threads = new pthread_t[nThreads];
+
+	for (int c = 0; c < nThreads; c++)
+		(*engines)[c] = new Engine(n);
+}
+
+//========================
+//RandomRuns Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the Engines and results. The netlist is not deleted.
+//========================
+RandomRuns::~RandomRuns()
+{
+	for (int c = 0; c < nThreads; c++)
+		delete (*engines)[c];
+
+	delete [] threads;
+
+	delete toggles;
+	delete xrates;
+	delete holds;
+	delete streams;
+	delete hashes;
+	delete engines;
+}
+
+//========================
+//RandomRuns Set Pad
+//========================
+//Parameters:
+//	int		p		-	an input pad index, or -1 for every input pad
+//	double	toggle	-	chance per ns of changing between 0 and 1
+//	double	xrate	-	chance per ns of changing to X
+//	int		hold	-	fewest ns a state lasts, at least 1
+//Summary:
+//	Sets the constraints a pad's random input obeys.
+//Returns:
+//	n/a
+//========================
+void		RandomRuns::setPad(int p, double toggle, double xrate, int hold) throw (BasicException)
+{
+	if ((toggle < 0) || (xrate < 0) || (toggle + xrate > 1))
+		throw BasicException("Toggle and X rates must be chances that add up to at most 1.");
+
+	if (hold < 1)
+		throw BasicException("Hold time must be at least 1ns.");
+
+	if ((p < -1) || (p >= net->cntiPads()))
+		throw BasicException("No such input pad.");
+
+	for (int ip = 0; ip < net->cntiPads(); ip++)
+	{
+		if ((p != -1) && (ip != p))
+			continue;
+
+		(*toggles)[ip] = chance(toggle);
+		(*xrates)[ip] = chance(xrate);
+		(*holds)[ip] = hold;
+	}
+}
+
+//========================
+//RandomRuns Thread Count
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How many threads share the runs.
+//Returns:
+//	int	-	the thread count
+//========================
+int			RandomRuns::cntThreads()
+{
+	return nThreads;
+}
+
+//========================
+//RandomRuns Stimulate
+//========================
+//Parameters:
+//	Xoshiro			&rng	-	the run's generator
+//	int				t		-	the time being generated
+//	unsigned char	*cur	-	each input pad's state; updated
+//	int				*age	-	ns each pad has held its state; updated
+//Summary:
+//	Generates one nanosecond of input. At time 0 every pad gets a fresh
+//		state; after that, a pad that has held its state long enough
+//		draws once: below its X rate it goes to X, below X rate plus
+//		toggle rate it changes between 0 and 1 (from X, to either).
+//Returns:
+//	n/a
+//========================
+void		RandomRuns::stimulate(Xoshiro &rng, int t, unsigned char *cur, int *age)
+{
+	for (int p = 0; p < net->cntiPads(); p++)
+	{
+		if ((t > 0) && (age[p] < (*holds)[p]))
+		{
+			age[p]++;
+			continue;
+		}
+
+		unsigned long long	r = rng.next();
+		unsigned int		u = (unsigned int) (r >> 32);
+		unsigned int		x = (*xrates)[p];
+		state				s = (state) cur[p];
+
+		if ((t == 0) || (s == indet))
+			s = ((r & 1) ? high : low);
+		else
+			s = ((s == high) ? low : high);
+
+		if (u < x)
+			s = indet;
+		else if ((t > 0) && (u - x >= (*toggles)[p]))
+			s = (state) cur[p];
+
+		if ((t == 0) || (s != cur[p]))
+			age[p] = 1;
+		else
+			age[p]++;
+
+		cur[p] = s;
+	}
+}
+
+//========================
+//RandomRuns Simulate
+//========================
+//Parameters:
+//	Engine				*sim	-	the Engine to use
+//	int					r		-	which run
+//	int					tEnd	-	the last time to simulate
+//	vector<PadState*>	*iPS	-	if not NULL, records each input pad
+//	vector<PadState*>	*oPS	-	if not NULL, records each output pad
+//Summary:
+//	Runs one random run from time 0 through tEnd, the stimulus going
+//		straight into the Engine's input pads as it is drawn.
+//Returns:
+//	unsigned long long	-	FNV-1a hash of every output pad at every step
+//========================
+unsigned long long	RandomRuns::simulate(Engine *sim, int r, int tEnd, vector<PadState*> *iPS, vector<PadState*> *oPS)
+{
+	Xoshiro				rng = (*streams)[r];
+	vector<unsigned char>	cur(net->cntiPads() + 1, indet);
+	vector<int>			age(net->cntiPads() + 1, 0);
+	unsigned long long	h = FNV_START;
+
+	sim->reset();
+
+	for (int ct = 0; ct <= tEnd; ct++)
+	{
+		stimulate(rng, ct, &cur[0], &age[0]);
+
+		for (int ip = 0; ip < net->cntiPads(); ip++)
+		{
+			sim->setInput(ip, (state) cur[ip]);
+
+			if (iPS != NULL)
+				(*iPS)[ip]->addState((state) cur[ip], ct);
+		}
+
+		sim->step();
+
+		for (int op = 0; op < net->cntoPads(); op++)
+		{
+			state s = sim->getOutput(op);
+
+			h = (h ^ s) * FNV_PRIME;
+
+			if (oPS != NULL)
+				(*oPS)[op]->addState(s, ct);
+		}
+	}
+
+	return h;
+}
+
+//========================
+//RandomRuns Worker
+//========================
+//Parameters:
+//	void	*arg	-	the RandomRuns
+//Summary:
+//	Thread entry point: takes a seat, and with it an Engine, and works.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		RandomRuns::worker(void *arg)
+{
+	RandomRuns* rr = (RandomRuns*) arg;
+
+	rr->work(__sync_fetch_and_add(&rr->seat, 1));
+
+	return NULL;
+}
+
+//========================
+//RandomRuns Work
+//========================
+//Parameters:
+//	int	c	-	a seat, which picks the Engine
+//Summary:
+//	Takes runs until none are left.
+//Returns:
+//	n/a
+//========================
+void		RandomRuns::work(int c)
+{
+	while (true)
+	{
+		int r = __sync_fetch_and_add(&nextRun, 1);
+
+		if (r >= nRuns)
+			break;
+
+		(*hashes)[r] = simulate((*engines)[c], r, tStop, NULL, NULL);
+	}
+}
+
+//========================
+//RandomRuns Run
+//========================
+//Parameters:
+//	int	runs	-	how many runs
+//	int	tEnd	-	the last time of each run
+//Summary:
+//	Works out every run's starting generator, one jump apart, then does
+//		the runs on the threads.
+//Returns:
+//	n/a
+//========================
+void		RandomRuns::run(int runs, int tEnd) throw (BasicException)
+{
+	if (tEnd < 1)
+		throw BasicException("Time to run is zero or negative. INVALID!");
+
+	if (runs < 1)
+		throw BasicException("Run count must be at least 1.");
+
+	while (streams->size() < runs)
+	{
+		streams->push_back(streams->back());
+		streams->back().jump();
+	}
+
+	nRuns = runs;
+	tStop = tEnd;
+	nextRun = 0;
+	seat = 0;
+	hashes->assign(runs, 0);
+
+	int started = 0;
+
+	while ((started < nThreads) && (pthread_create(&threads[started], NULL, worker, this) == 0))
+		started++;
+
+	if (started < nThreads)
+	{
+		char buf[80];
+
+		for (int c = 0; c < started; c++)
+			pthread_join(threads[c], NULL);
+
+		sprintf(buf, "Unable to start random run thread %d of %d.", started + 1, nThreads);
+		throw BasicException(buf);
+	}
+
+	for (int c = 0; c < nThreads; c++)
+		pthread_join(threads[c], NULL);
+}
+
+//========================
+//RandomRuns Get Hash
+//========================
+//Parameters:
+//	int	r	-	a run of the last run() call
+//Summary:
+//	The run's output hash. Two runs with the same hash saw the same
+//		output waveforms, barring a collision.
+//Returns:
+//	unsigned long long	-	the hash
+//========================
+unsigned long long	RandomRuns::getHash(int r)
+{
+	return (*hashes)[r];
+}
+
+//========================
+//RandomRuns Record
+//========================
+//Parameters:
+//	int		r		-	a run
+//	int		tEnd	-	the last time to simulate
+//	Vector	*v		-	receives the run's input and output waveforms
+//Summary:
+//	Repeats run r on the first Engine, writing its stimulus into the
+//		Vector's input PadStates and its results into the output ones.
+//		Saving the input PadStates as a vector file reproduces the run
+//		with any engine.
+//Returns:
+//	n/a
+//========================
+void		RandomRuns::record(int r, int tEnd, Vector *v) throw (BasicException)
+{
+	if (v == NULL)
+		throw NullPointerException();
+
+	if (tEnd < 1)
+		throw BasicException("Time to run is zero or negative. INVALID!");
+
+	if (r < 0)
+		throw BasicException("Run count must be at least 1.");
+
+	while (streams->size() <= r)
+	{
+		streams->push_back(streams->back());
+		streams->back().jump();
+	}
+
+	vector<int>			iIdx;
+	vector<PadState*>	iPS;
+	vector<int>			oIdx;
+	vector<PadState*>	oPS;
+	vector<PadState*>	iByPad(net->cntiPads(), (PadState*) NULL);
+	vector<PadState*>	oByPad(net->cntoPads(), (PadState*) NULL);
+
+	net->matchPads(v, iIdx, iPS, oIdx, oPS);
+
+	for (int ip = 0; ip < iPS.size(); ip++)
+		iByPad[iIdx[ip]] = iPS[ip];
+
+	for (int op = 0; op < oPS.size(); op++)
+		oByPad[oIdx[op]] = oPS[op];
+
+	simulate((*engines)[0], r, tEnd, &iByPad, &oByPad);
+}
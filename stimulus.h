@@ -0,0 +1,112 @@
+#ifndef STIMULUS_H
+#define STIMULUS_H
+
+//================================================================
+//Filename:		Random Stimulus Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definitions of Xoshiro, a small
+//					seeded random number generator, and RandomRuns,
+//					which drives Engines with constrained random
+//					input instead of a vector file.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "engine.h"
+
+using namespace std;
+
+//==================================
+//Class:	Xoshiro
+//Parent:	n/a
+//==================================
+//Description:
+//	xoshiro256**, a 256-bit state generator that is fast, passes the usual
+//		statistical tests, and can jump 2^128 draws ahead, which splits one
+//		seed into as many independent streams as needed. The state is
+//		filled from the seed by splitmix64.
+//==================================
+class Xoshiro
+{
+public:
+				Xoshiro(unsigned long long seed = 0);
+
+	unsigned long long	next();
+	void		jump();
+
+private:
+
+	unsigned long long	s[4];
+};
+
+//==================================
+//Class:	RandomRuns
+//Parent:	n/a
+//==================================
+//Description:
+//	RandomRuns runs a Netlist on random input generated as it goes, so no
+//		vector file is read or written. Each input pad has a toggle rate
+//		(the chance, each nanosecond, of changing to the other state), an
+//		X rate (the chance of going to X instead) and a hold time (the
+//		fewest nanoseconds a state lasts before it may change); a pad
+//		leaving X goes to 0 or 1 at random. At time 0 every pad starts at
+//		a random 0 or 1, or X at its X rate.
+//		Run r draws from the seed's stream jumped r times, so a run's
+//		stimulus depends only on the seed, r and the pad settings, never
+//		on which thread ran it or what ran before. Each thread owns an
+//		Engine and takes runs in turn. A run is summed up by a hash of
+//		its output pads at every step; record() replays one run into a
+//		Vector to see or save it.
+//==================================
+class RandomRuns
+{
+public:
+				RandomRuns(Netlist *n, unsigned long long seed, int nt = 1) throw (NullPointerException, BasicException);
+
+				~RandomRuns();
+
+	void		setPad(int p, double toggle, double xrate, int hold) throw (BasicException);
+	int			cntThreads();
+
+	void		run(int runs, int tEnd) throw (BasicException);
+	unsigned long long	getHash(int r);
+
+	void		record(int r, int tEnd, Vector *v) throw (BasicException);
+
+private:
+
+	void		stimulate(Xoshiro &rng, int t, unsigned char *cur, int *age);
+	unsigned long long	simulate(Engine *sim, int r, int tEnd, vector<PadState*> *iPS, vector<PadState*> *oPS);
+	void		work(int c);
+
+static void*	worker(void *arg);
+
+	Netlist*				net;
+	int						nThreads;
+	int						tStop;
+	int						nRuns;
+	int						nextRun;
+
+	vector<unsigned int>*	toggles;	// per input pad, toggle chance in 2^-32.
+	vector<unsigned int>*	xrates;		// per input pad, X chance in 2^-32.
+	vector<int>*			holds;		// per input pad, minimum ns per state.
+
+	vector<Xoshiro>*		streams;	// starting generator of each run.
+	vector<unsigned long long>*	hashes;	// result of each run.
+	vector<Engine*>*		engines;
+
+	pthread_t*				threads;
+	int						seat;
+};
+
+#endif //STIMULUS_H
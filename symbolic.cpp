@@ -0,0 +1,277 @@
+//================================================================
+//Filename:		Symbolic Simulator Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for Symbolic: the level
+//					order pass that builds each wire's function.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "bdd.h"
+#include "symbolic.h"
+
+using namespace std;
+
+//========================
+//Symbolic Constructor
+//========================
+//Parameters:
+//	Netlist		*n		-	the netlist, without feedback
+//	Bdd			*b		-	the Bdd to build in
+//	vector<int>	&vars	-	per input pad, the variable standing for it
+//Summary:
+//	Checks the netlist and the variables. Both n and b must outlive the
+//		Symbolic.
+//========================
+Symbolic::Symbolic(Netlist *n, Bdd *b, vector<int> &vars) throw (NullPointerException, BasicException)
+{
+	if ((n == NULL) || (b == NULL))
+		throw NullPointerException();
+
+	if (n->getPathDelay() < 0)
+		throw BasicException("Symbolic simulation needs a circuit without feedback.");
+
+	if (vars.size() != n->cntiPads())
+		throw BasicException("Symbolic simulation needs a variable for every input pad.");
+
+	for (int ip = 0; ip < vars.size(); ip++)
+	{
+		if ((vars[ip] < 0) || (vars[ip] >= b->cntVars()))
+			throw BasicException("Symbolic simulation was given a variable the BDD lacks.");
+	}
+
+	net = n;
+	bdd = b;
+	padVar = new vector<int>(vars);
+	wFunc = new vector<int>(net->cntWires(), -1);
+	outs = new vector<int>();
+}
+
+//========================
+//Symbolic Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Lets go of the output functions.
+//========================
+Symbolic::~Symbolic()
+{
+	for (int op = 0; op < outs->size(); op++)
+		drop((*outs)[op]);
+
+	delete padVar;
+	delete wFunc;
+	delete outs;
+}
+
+//========================
+//Symbolic Hold and Drop
+//========================
+//Parameters:
+//	int	f	-	a function
+//Summary:
+//	Keeps f through the Bdd's collections, or stops keeping it.
+//Returns:
+//	int	-	hold() returns f
+//========================
+int			Symbolic::hold(int f)
+{
+	bdd->ref(f);
+
+	return f;
+}
+
+void		Symbolic::drop(int f)
+{
+	bdd->deref(f);
+}
+
+//========================
+//Symbolic Run
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Gives each input pad's wire its variable, then evaluates the gates in
+//		level order, dropping each wire's function after its last reader.
+//		Output pads keep theirs until the Symbolic goes.
+//Returns:
+//	n/a
+//========================
+void		Symbolic::run() throw (BasicException)
+{
+	int				nW = net->cntWires();
+	vector<int>		readers(nW, 0);
+	vector<bool>	isOut(nW, false);
+
+	for (int op = 0; op < outs->size(); op++)
+		drop((*outs)[op]);
+
+	outs->clear();
+	wFunc->assign(nW, -1);
+
+	for (int g = 0; g < net->cntGates(); g++)
+	{
+		for (int k = 0; k < net->cntInputs(g); k++)
+			readers[net->getInput(g, k)]++;
+	}
+
+	for (int op = 0; op < net->cntoPads(); op++)
+		isOut[net->getoPadWire(op)] = true;
+
+	for (int ip = 0; ip < net->cntiPads(); ip++)
+	{
+		int w = net->getiPadWire(ip);
+
+		(*wFunc)[w] = hold(bdd->getVar((*padVar)[ip]));
+
+		if ((readers[w] == 0) && !isOut[w])
+			drop((*wFunc)[w]);
+	}
+
+	vector<pair<int, int> > lv;
+
+	for (int g = 0; g < net->cntGates(); g++)
+		lv.push_back(make_pair(net->getLevel(g), g));
+
+	sort(lv.begin(), lv.end());
+
+	for (int k = 0; k < lv.size(); k++)
+	{
+		int g = lv[k].second;
+		int o = net->getOutput(g);
+
+		(*wFunc)[o] = gate(g);
+
+		for (int j = 0; j < net->cntInputs(g); j++)
+		{
+			int w = net->getInput(g, j);
+
+			if ((--readers[w] == 0) && !isOut[w])
+				drop((*wFunc)[w]);
+		}
+
+		if ((readers[o] == 0) && !isOut[o])
+			drop((*wFunc)[o]);
+	}
+
+	for (int op = 0; op < net->cntoPads(); op++)
+	{
+		int f = (*wFunc)[net->getoPadWire(op)];
+
+		if (f < 0)
+			throw BasicException("Symbolic simulation found an output pad nothing drives.");
+
+		outs->push_back(hold(f));
+	}
+
+	for (int w = 0; w < nW; w++)
+	{
+		if (isOut[w] && ((*wFunc)[w] >= 0))
+			drop((*wFunc)[w]);
+	}
+}
+
+//========================
+//Symbolic Output
+//========================
+//Parameters:
+//	int	op	-	an output pad
+//Summary:
+//	The output pad's function of the input variables, after run().
+//Returns:
+//	int	-	the function
+//========================
+int			Symbolic::getOutput(int op)
+{
+	return (*outs)[op];
+}
+
+//========================
+//Symbolic Gate
+//========================
+//Parameters:
+//	int	g	-	a gate whose inputs have functions
+//Summary:
+//	Folds g's inputs' functions with its AND, OR or XOR, then inverts
+//		for NOT, NAND, NOR and XNOR, the way the gate folds states.
+//Returns:
+//	int	-	g's output function, held
+//========================
+int			Symbolic::gate(int g) throw (BasicException)
+{
+	gateType	type = net->getType(g);
+	int			nin = net->cntInputs(g);
+
+	if (type == gLUT)
+		return table(g, 0, 0, 1);
+
+	int acc = hold((*wFunc)[net->getInput(g, 0)]);
+
+	for (int k = 1; k < nin; k++)
+	{
+		int in = (*wFunc)[net->getInput(g, k)];
+		int f;
+
+		if ((type == gAND) || (type == gNAND))
+			f = hold(bdd->AND(acc, in));
+		else if ((type == gOR) || (type == gNOR))
+			f = hold(bdd->OR(acc, in));
+		else
+			f = hold(bdd->XOR(acc, in));
+
+		drop(acc);
+		acc = f;
+	}
+
+	if ((type == gNOT) || (type == gNAND) || (type == gNOR) || (type == gXNOR))
+	{
+		int f = hold(bdd->NOT(acc));
+
+		drop(acc);
+		acc = f;
+	}
+
+	return acc;
+}
+
+//========================
+//Symbolic Table
+//========================
+//Parameters:
+//	int	g		-	a gLUT gate
+//	int	k		-	the first input not yet split on
+//	int	idx		-	the table index the earlier inputs give
+//	int	step	-	3^k, the weight of input k in the index
+//Summary:
+//	Builds a gLUT's function by Shannon expansion on its inputs, from
+//		its binary rows: input k's function chooses between the rows
+//		with k at 1 and at 0.
+//Returns:
+//	int	-	the function of inputs k and up, held
+//========================
+int			Symbolic::table(int g, int k, int idx, int step) throw (BasicException)
+{
+	if (k == net->cntInputs(g))
+		return hold((net->getLUT(g, idx) == high) ? 1 : 0);
+
+	int lo = table(g, k + 1, idx, step * 3);
+	int hi = table(g, k + 1, idx + step, step * 3);
+	int f = hold(bdd->ITE((*wFunc)[net->getInput(g, k)], hi, lo));
+
+	drop(lo);
+	drop(hi);
+
+	return f;
+}
@@ -0,0 +1,66 @@
+#ifndef SYMBOLIC_H
+#define SYMBOLIC_H
+
+//================================================================
+//Filename:		Symbolic Simulator Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of Symbolic, which
+//					evaluates a circuit's gates over BDDs to get each
+//					output pad as a function of all its inputs.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "bdd.h"
+
+using namespace std;
+
+//==================================
+//Class:	Symbolic
+//Parent:	n/a
+//==================================
+//Description:
+//	Symbolic simulation settles a circuit without feedback once for every
+//		input setting at the same time: each input pad is a Bdd variable,
+//		and each gate, in level order, applies AND, OR, XOR or NOT to its
+//		inputs' functions rather than to states, so each output pad ends
+//		up as a canonical function of the inputs. Two circuits built in
+//		one Bdd, their pads given the same variables, compute the same
+//		output exactly when it is the same function. A gLUT is built from
+//		its table's binary rows. A wire's function is let go once its last
+//		reader has been evaluated, so the Bdd can collect it.
+//==================================
+class Symbolic
+{
+public:
+				Symbolic(Netlist *n, Bdd *b, vector<int> &vars) throw (NullPointerException, BasicException);
+
+				~Symbolic();
+
+	void		run() throw (BasicException);
+	int			getOutput(int op);
+
+private:
+
+	int			gate(int g) throw (BasicException);
+	int			table(int g, int k, int idx, int step) throw (BasicException);
+	int			hold(int f);
+	void		drop(int f);
+
+	Netlist*		net;
+	Bdd*			bdd;
+	vector<int>*	padVar;		// per input pad: its variable.
+	vector<int>*	wFunc;		// per wire: its function, or -1.
+	vector<int>*	outs;		// per output pad: its function, held.
+};
+
+#endif //SYMBOLIC_H
@@ -0,0 +1,325 @@
+//================================================================
+//Filename:		Testability Analysis Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for Testability: the
+//					controllability passes from the inputs and the
+//					observability passes back from the outputs.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "testability.h"
+
+using namespace std;
+
+// Adds two costs, stopping at SCOAP_INF.
+static int	cost(int a, int b)
+{
+	return (a + b >= SCOAP_INF) ? SCOAP_INF : a + b;
+}
+
+// Orders gates by level, ties by index.
+struct byLevel
+{
+	Netlist*	net;
+
+	bool operator() (int a, int b) const
+	{
+		if (net->getLevel(a) != net->getLevel(b))
+			return net->getLevel(a) < net->getLevel(b);
+
+		return a < b;
+	}
+};
+
+//========================
+//Testability Constructor
+//========================
+//Parameters:
+//	Netlist	*n	-	the netlist to measure
+//Summary:
+//	Works out CC0 and CC1 gate by gate from the inputs, in level order,
+//		then CO gate by gate from the outputs, in reverse level order.
+//		Without feedback one pass of each is exact. With it, a loop's
+//		wires start out impossible and each pass can only lower them,
+//		so the passes repeat until one changes nothing. The netlist
+//		must not change while the Testability is in use.
+//========================
+Testability::Testability(Netlist *n) throw (NullPointerException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	net = n;
+
+	cc0 = new vector<int>(net->cntWires(), SCOAP_INF);
+	cc1 = new vector<int>(net->cntWires(), SCOAP_INF);
+	co = new vector<int>(net->cntWires(), SCOAP_INF);
+
+	vector<int>	order(net->cntGates());
+	byLevel		cmp;
+	bool		loops = (net->getPathDelay() < 0);
+	bool		moved = true;
+
+	cmp.net = net;
+
+	for (int g = 0; g < net->cntGates(); g++)
+		order[g] = g;
+
+	sort(order.begin(), order.end(), cmp);
+
+	for (int ip = 0; ip < net->cntiPads(); ip++)
+	{
+		(*cc0)[net->getiPadWire(ip)] = 1;
+		(*cc1)[net->getiPadWire(ip)] = 1;
+	}
+
+	for (ccPasses = 0; moved; ccPasses++)
+	{
+		moved = false;
+
+		for (int k = 0; k < order.size(); k++)
+			moved = control(order[k]) || moved;
+
+		moved = moved && loops;
+	}
+
+	for (int op = 0; op < net->cntoPads(); op++)
+		(*co)[net->getoPadWire(op)] = 0;
+
+	moved = true;
+
+	for (coPasses = 0; moved; coPasses++)
+	{
+		moved = false;
+
+		for (int k = order.size() - 1; k >= 0; k--)
+			moved = observe(order[k]) || moved;
+
+		moved = moved && loops;
+	}
+}
+
+//========================
+//Testability Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the measures. The netlist is not deleted.
+//========================
+Testability::~Testability()
+{
+	delete cc0;
+	delete cc1;
+	delete co;
+}
+
+//========================
+//Testability Accessors
+//========================
+//Parameters:
+//	int		w	-	a wire
+//	state	s	-	low or high
+//Summary:
+//	A wire's CC0, CC1, CC0 or CC1 by state, and CO. SCOAP_INF means
+//		impossible.
+//Returns:
+//	int	-	the measure
+//========================
+int			Testability::getCC0(int w)
+{
+	return (*cc0)[w];
+}
+
+int			Testability::getCC1(int w)
+{
+	return (*cc1)[w];
+}
+
+int			Testability::getCC(int w, state s)
+{
+	return (s == high) ? (*cc1)[w] : (*cc0)[w];
+}
+
+int			Testability::getCO(int w)
+{
+	return (*co)[w];
+}
+
+//========================
+//Testability Pass Counts
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How many passes the controllability and the observability took to
+//		settle: 1 each without feedback.
+//Returns:
+//	int	-	the count
+//========================
+int			Testability::cntCCPasses()
+{
+	return ccPasses;
+}
+
+int			Testability::cntCOPasses()
+{
+	return coPasses;
+}
+
+//========================
+//Testability Control
+//========================
+//Parameters:
+//	int	g	-	a gate whose inputs are measured
+//Summary:
+//	Sets the CC0 and CC1 of g's output. An XOR folds its inputs a pair
+//		at a time; a gLUT takes its cheapest table row for each value.
+//Returns:
+//	bool	-	true if either changed
+//========================
+bool		Testability::control(int g)
+{
+	gateType	type = net->getType(g);
+	int			nin = net->cntInputs(g);
+	int			c0 = 0;
+	int			c1 = 0;
+
+	if (type == gLUT)
+	{
+		int size = 1 << nin;
+		int idx3;
+
+		c0 = SCOAP_INF;
+		c1 = SCOAP_INF;
+
+		for (int r = 0; r < size; r++)
+		{
+			int sum = 0;
+
+			idx3 = 0;
+
+			for (int k = nin - 1; k >= 0; k--)
+			{
+				int bit = (r >> k) & 1;
+
+				idx3 = idx3 * 3 + bit;
+				sum = cost(sum, bit ? (*cc1)[net->getInput(g, k)] : (*cc0)[net->getInput(g, k)]);
+			}
+
+			if ((net->getLUT(g, idx3) == low) && (sum < c0))
+				c0 = sum;
+			else if ((net->getLUT(g, idx3) == high) && (sum < c1))
+				c1 = sum;
+		}
+	}
+	else
+	{
+		int w = net->getInput(g, 0);
+
+		c0 = (*cc0)[w];
+		c1 = (*cc1)[w];
+
+		for (int k = 1; k < nin; k++)
+		{
+			int b0 = (*cc0)[net->getInput(g, k)];
+			int b1 = (*cc1)[net->getInput(g, k)];
+
+			if ((type == gAND) || (type == gNAND))
+			{
+				c0 = min(c0, b0);
+				c1 = cost(c1, b1);
+			}
+			else if ((type == gOR) || (type == gNOR))
+			{
+				c0 = cost(c0, b0);
+				c1 = min(c1, b1);
+			}
+			else
+			{
+				int t1 = min(cost(c1, b0), cost(c0, b1));
+
+				c0 = min(cost(c0, b0), cost(c1, b1));
+				c1 = t1;
+			}
+		}
+
+		if ((type == gNOT) || (type == gNAND) || (type == gNOR) || (type == gXNOR))
+			swap(c0, c1);
+	}
+
+	int o = net->getOutput(g);
+
+	c0 = cost(c0, 1);
+	c1 = cost(c1, 1);
+
+	if ((c0 == (*cc0)[o]) && (c1 == (*cc1)[o]))
+		return false;
+
+	(*cc0)[o] = c0;
+	(*cc1)[o] = c1;
+
+	return true;
+}
+
+//========================
+//Testability Observe
+//========================
+//Parameters:
+//	int	g	-	a gate whose output's CO is final
+//Summary:
+//	Lowers the CO of each of g's inputs to what observing it through g
+//		costs: g's output CO, plus 1, plus setting the other inputs to
+//		the value that lets it through (1 for AND and NAND, 0 for OR and
+//		NOR, whichever is cheaper for XOR, XNOR and gLUT).
+//Returns:
+//	bool	-	true if any input's CO fell
+//========================
+bool		Testability::observe(int g)
+{
+	gateType	type = net->getType(g);
+	int			nin = net->cntInputs(g);
+	int			o = (*co)[net->getOutput(g)];
+	bool		moved = false;
+
+	for (int k = 0; k < nin; k++)
+	{
+		int c = cost(o, 1);
+
+		for (int j = 0; j < nin; j++)
+		{
+			int w = net->getInput(g, j);
+
+			if (j == k)
+				continue;
+
+			if ((type == gAND) || (type == gNAND))
+				c = cost(c, (*cc1)[w]);
+			else if ((type == gOR) || (type == gNOR))
+				c = cost(c, (*cc0)[w]);
+			else
+				c = cost(c, min((*cc0)[w], (*cc1)[w]));
+		}
+
+		int w = net->getInput(g, k);
+
+		if (c < (*co)[w])
+		{
+			(*co)[w] = c;
+			moved = true;
+		}
+	}
+
+	return moved;
+}
@@ -0,0 +1,78 @@
+#ifndef TESTABILITY_H
+#define TESTABILITY_H
+
+//================================================================
+//Filename:		Testability Analysis Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of Testability, the SCOAP
+//					controllability and observability of every wire
+//					in a Netlist.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+
+using namespace std;
+
+// Cost of a value no input setting can produce, or a wire no output sees.
+#define SCOAP_INF	100000000
+
+//==================================
+//Class:	Testability
+//Parent:	n/a
+//==================================
+//Description:
+//	SCOAP measures for each wire of a Netlist: CC0 and CC1, roughly how
+//		many wires must be set to put a 0 or a 1 on it, and CO, roughly
+//		how many must be set to see it at an output pad. An input pad
+//		costs 1 to control and an output pad's wire 0 to observe. A gate
+//		adds 1 to the cheapest way of getting its output from its inputs
+//		(for an AND's 0, the easiest input's CC0; for its 1, every input's
+//		CC1), and a gate input's CO is the output's CO plus 1 plus what it
+//		costs to set every other input so the output follows this one. A
+//		wire read in several places takes its easiest reader's CO. ATPG
+//		uses the measures to pick which input to chase.
+//		Through feedback, a wire's cost depends on itself; every measure
+//		starts at SCOAP_INF and passes over the gates lower them until
+//		nothing changes, which leaves each loop wire at its cheapest way
+//		in from outside the loop. A wire still at SCOAP_INF after that,
+//		like a latch with no reset, can never be set or seen.
+//==================================
+class Testability
+{
+public:
+				Testability(Netlist *n) throw (NullPointerException);
+
+				~Testability();
+
+	int			getCC0(int w);
+	int			getCC1(int w);
+	int			getCC(int w, state s);
+	int			getCO(int w);
+	int			cntCCPasses();
+	int			cntCOPasses();
+
+private:
+
+	bool		control(int g);
+	bool		observe(int g);
+
+	Netlist*		net;
+
+	vector<int>*	cc0;
+	vector<int>*	cc1;
+	vector<int>*	co;
+	int				ccPasses;
+	int				coPasses;
+};
+
+#endif //TESTABILITY_H
@@ -0,0 +1,563 @@
+//================================================================
+//Filename:		Exhaustive Truth Table Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the TruthTable:
+//					compiling the netlist, generating the input
+//					combinations 64 at a time, and hashing the rows.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "truthTable.h"
+
+using namespace std;
+
+// Words of 64 rows a thread takes at a time.
+#define CHUNK_WORDS	1024
+
+// The most rows a kept table may hold.
+#define KEEP_ROWS	(1ULL << 28)
+
+// FNV-1a, 64 bit.
+#define FNV_START	14695981039346656037ULL
+#define FNV_PRIME	1099511628211ULL
+
+// Row bit patterns of the six inputs that change within a word.
+static const lanes	lowInputs[6] =
+{
+	0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+	0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL
+};
+
+// Folds the 8 bytes of v into an FNV-1a hash, low byte first.
+static unsigned long long	fnv(unsigned long long h, unsigned long long v)
+{
+	for (int b = 0; b < 8; b++)
+	{
+		h ^= (v >> (b * 8)) & 0xff;
+		h *= FNV_PRIME;
+	}
+
+	return h;
+}
+
+//========================
+//TruthTable Constructor
+//========================
+//Parameters:
+//	Netlist	*n	-	the netlist to enumerate; put into level order
+//	bool	x	-	whether X is a third input state
+//	int		nt	-	how many threads to enumerate on
+//Summary:
+//	Counts the rows and compiles the netlist, in level order, into a
+//		program of (type, output wire, input count, input wires) records,
+//		plus the table offset for gLUT gates. The netlist must outlive the
+//		TruthTable.
+//========================
+TruthTable::TruthTable(Netlist *n, bool x, int nt) throw (NullPointerException, BasicException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	if (nt < 1)
+		throw BasicException("Thread count must be at least 1.");
+
+	if (n->getPathDelay() < 0)
+		throw BasicException("Truth tables need a circuit without feedback.");
+
+	if (n->cntiPads() > (x ? 25 : 40))
+		throw BasicException("Too many input pads to enumerate.");
+
+	net = n;
+	ternary = x;
+	rails = (x ? 2 : 1);
+	nThreads = nt;
+	keeping = false;
+
+	rows = 1;
+
+	for (int p = 0; p < net->cntiPads(); p++)
+		rows *= (ternary ? 3 : 2);
+
+	words = (rows + 63) / 64;
+	chunks = (long) ((words + CHUNK_WORDS - 1) / CHUNK_WORDS);
+	nextChunk = 0;
+
+	net->reorder(oLevel);
+
+	prog = new vector<int>();
+	tables = new vector<unsigned char>();
+	table = new vector<lanes>();
+	chunkHash = new vector<unsigned long long>();
+	threads = new pthread_t[nThreads];
+
+	for (int g = 0; g < net->cntGates(); g++)
+	{
+		prog->push_back(net->getType(g));
+		prog->push_back(net->getOutput(g));
+		prog->push_back(net->cntInputs(g));
+
+		for (int k = 0; k < net->cntInputs(g); k++)
+			prog->push_back(net->getInput(g, k));
+
+		if (net->getType(g) == gLUT)
+		{
+			int size = 1;
+
+			for (int k = 0; k < net->cntInputs(g); k++)
+				size *= 3;
+
+			prog->push_back(tables->size());
+
+			for (int idx = 0; idx < size; idx++)
+				tables->push_back(net->getLUT(g, idx));
+		}
+	}
+}
+
+//========================
+//TruthTable Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the program and results. The netlist is not deleted.
+//========================
+TruthTable::~TruthTable()
+{
+	delete [] threads;
+
+	delete prog;
+	delete tables;
+	delete table;
+	delete chunkHash;
+}
+
+//========================
+//TruthTable Accessors
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The thread count, and the number of rows: 2^n, or 3^n with X, for
+//		n input pads.
+//Returns:
+//	varies
+//========================
+int			TruthTable::cntThreads()
+{
+	return nThreads;
+}
+
+unsigned long long	TruthTable::cntRows()
+{
+	return rows;
+}
+
+//========================
+//TruthTable Inputs
+//========================
+//Parameters:
+//	lanes				*v	-	the wire words to fill
+//	unsigned long long	w	-	which word of 64 rows
+//Summary:
+//	Sets each input pad's wire to its states in rows 64w through 64w+63.
+//		In binary, input p < 6 has the same pattern in every word and
+//		input p >= 6 is all 1s or all 0s, bit p - 6 of w. With X, the rows'
+//		ternary digits are counted up lane by lane from row 64w.
+//Returns:
+//	n/a
+//========================
+void		TruthTable::inputs(lanes *v, unsigned long long w)
+{
+	int nI = net->cntiPads();
+
+	if (!ternary)
+	{
+		for (int p = 0; p < nI; p++)
+		{
+			int wire = net->getiPadWire(p);
+
+			if (p < 6)
+				v[wire] = lowInputs[p];
+			else
+				v[wire] = (((w >> (p - 6)) & 1) ? ~0ULL : 0ULL);
+		}
+
+		return;
+	}
+
+	vector<int>			digit(nI + 1, 0);
+	unsigned long long	r = w * 64;
+
+	for (int p = 0; p < nI; p++)
+	{
+		digit[p] = (int) (r % 3);
+		r /= 3;
+		v[2 * net->getiPadWire(p)] = 0;
+		v[2 * net->getiPadWire(p) + 1] = 0;
+	}
+
+	for (int l = 0; l < 64; l++)
+	{
+		for (int p = 0; p < nI; p++)
+		{
+			if (digit[p] == high)
+				v[2 * net->getiPadWire(p)] |= 1ULL << l;
+			else if (digit[p] == low)
+				v[2 * net->getiPadWire(p) + 1] |= 1ULL << l;
+		}
+
+		for (int p = 0; p < nI; p++) // next row.
+		{
+			if (++digit[p] < 3)
+				break;
+
+			digit[p] = 0;
+		}
+	}
+}
+
+//========================
+//TruthTable Evaluate
+//========================
+//Parameters:
+//	lanes	*v	-	the wire words, inputs set
+//Summary:
+//	Runs the program once, level by level, filling in every gate output.
+//		In binary, a wire is one word of 1 bits. With X, it is a word of
+//		rows where it is 1 followed by a word of rows where it is 0:
+//		AND is 1 where both are 1 and 0 where either is 0, OR the reverse,
+//		XOR is known only where both inputs are, and NOT swaps the words.
+//		A gLUT gate ORs together the rows matching each table entry that
+//		gives 1 (and, with X, each that gives 0).
+//Returns:
+//	n/a
+//========================
+void		TruthTable::eval(lanes *v)
+{
+	int*			p = &(*prog)[0];
+	int*			end = p + prog->size();
+	unsigned char*	tb = (tables->empty() ? NULL : &(*tables)[0]);
+
+	while (p < end)
+	{
+		int		type = p[0];
+		int		out = p[1];
+		int		nin = p[2];
+		int*	in = p + 3;
+
+		p += 3 + nin;
+
+		if (type == gLUT)
+		{
+			unsigned char*	lut = tb + *p++;
+			int				size = 1;
+			lanes			one = 0;
+			lanes			zero = 0;
+
+			for (int k = 0; k < nin; k++)
+				size *= (ternary ? 3 : 2);
+
+			for (int idx = 0; idx < size; idx++)
+			{
+				int		rest = idx;
+				int		entry = 0;
+				int		place = 1;
+				lanes	m = ~0ULL;
+
+				for (int k = 0; k < nin; k++)
+				{
+					int d = rest % (ternary ? 3 : 2);
+
+					rest /= (ternary ? 3 : 2);
+					entry += d * place;
+					place *= 3;
+
+					if (!ternary)
+						m &= (d == high ? v[in[k]] : ~v[in[k]]);
+					else if (d == high)
+						m &= v[2 * in[k]];
+					else if (d == low)
+						m &= v[2 * in[k] + 1];
+					else
+						m &= ~(v[2 * in[k]] | v[2 * in[k] + 1]);
+				}
+
+				if (lut[entry] == high)
+					one |= m;
+				else if (lut[entry] == low)
+					zero |= m;
+			}
+
+			v[rails * out] = one;
+
+			if (ternary)
+				v[2 * out + 1] = zero;
+
+			continue;
+		}
+
+		bool invert = ((type == gNOT) || (type == gNAND) || (type == gNOR) || (type == gXNOR));
+
+		if (!ternary)
+		{
+			lanes s = v[in[0]];
+
+			for (int k = 1; k < nin; k++)
+			{
+				if ((type == gAND) || (type == gNAND))
+					s &= v[in[k]];
+				else if ((type == gOR) || (type == gNOR))
+					s |= v[in[k]];
+				else
+					s ^= v[in[k]];
+			}
+
+			v[out] = (invert ? ~s : s);
+			continue;
+		}
+
+		lanes one = v[2 * in[0]];
+		lanes zero = v[2 * in[0] + 1];
+
+		for (int k = 1; k < nin; k++)
+		{
+			lanes bOne = v[2 * in[k]];
+			lanes bZero = v[2 * in[k] + 1];
+
+			if ((type == gAND) || (type == gNAND))
+			{
+				one &= bOne;
+				zero |= bZero;
+			}
+			else if ((type == gOR) || (type == gNOR))
+			{
+				one |= bOne;
+				zero &= bZero;
+			}
+			else
+			{
+				lanes tOne = (one & bZero) | (zero & bOne);
+
+				zero = (one & bOne) | (zero & bZero);
+				one = tOne;
+			}
+		}
+
+		v[2 * out] = (invert ? zero : one);
+		v[2 * out + 1] = (invert ? one : zero);
+	}
+}
+
+//========================
+//TruthTable Worker
+//========================
+//Parameters:
+//	void	*arg	-	the TruthTable
+//Summary:
+//	Thread entry point.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		TruthTable::worker(void *arg)
+{
+	((TruthTable*) arg)->work();
+
+	return NULL;
+}
+
+//========================
+//TruthTable Work
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Takes chunks until none are left. Each word of a chunk gets its
+//		inputs and one pass of the program, then each output pad's word(s),
+//		with rows past the end cleared, go into that chunk's hash and, if
+//		kept, into the table.
+//Returns:
+//	n/a
+//========================
+void		TruthTable::work()
+{
+	int				nO = net->cntoPads();
+	vector<lanes>	v(net->cntWires() * rails + 1, 0);
+
+	while (true)
+	{
+		long c = __sync_fetch_and_add(&nextChunk, 1);
+
+		if (c >= chunks)
+			break;
+
+		unsigned long long	from = (unsigned long long) c * CHUNK_WORDS;
+		unsigned long long	to = from + CHUNK_WORDS;
+		vector<unsigned long long>	h(nO, FNV_START);
+
+		if (to > words)
+			to = words;
+
+		for (unsigned long long w = from; w < to; w++)
+		{
+			inputs(&v[0], w);
+			eval(&v[0]);
+
+			lanes valid = ~0ULL;
+
+			if (rows - w * 64 < 64)
+				valid = (1ULL << (rows - w * 64)) - 1;
+
+			for (int op = 0; op < nO; op++)
+			{
+				int wire = net->getoPadWire(op);
+
+				for (int r = 0; r < rails; r++)
+				{
+					lanes o = v[rails * wire + r] & valid;
+
+					h[op] = fnv(h[op], o);
+
+					if (keeping)
+						(*table)[((unsigned long long) op * words + w) * rails + r] = o;
+				}
+			}
+		}
+
+		for (int op = 0; op < nO; op++)
+			(*chunkHash)[(unsigned long long) c * nO + op] = h[op];
+	}
+}
+
+//========================
+//TruthTable Run
+//========================
+//Parameters:
+//	bool	keep	-	whether to keep every row for getState
+//Summary:
+//	Enumerates every row on the threads. A kept table is limited to 2^28
+//		rows; beyond that, only the hashes are available.
+//Returns:
+//	n/a
+//========================
+void		TruthTable::run(bool keep) throw (BasicException)
+{
+	if (keep && (rows > KEEP_ROWS))
+		throw BasicException("Truth table too large to keep; hash it instead.");
+
+	int nO = net->cntoPads();
+
+	keeping = keep;
+	nextChunk = 0;
+	chunkHash->assign((unsigned long long) chunks * nO, 0);
+	table->assign(keep ? (unsigned long long) nO * words * rails : 0, 0);
+
+	int started = 1;
+
+	while ((started < nThreads) && (pthread_create(&threads[started], NULL, worker, this) == 0))
+		started++;
+
+	if (started < nThreads)
+	{
+		char buf[80];
+
+		for (int c = 1; c < started; c++)
+			pthread_join(threads[c], NULL);
+
+		sprintf(buf, "Unable to start enumeration thread %d of %d.", started + 1, nThreads);
+		throw BasicException(buf);
+	}
+
+	work();
+
+	for (int c = 1; c < nThreads; c++)
+		pthread_join(threads[c], NULL);
+}
+
+//========================
+//TruthTable Evaluate Word
+//========================
+//Parameters:
+//	lanes				*v	-	cntWires() words, twice that with X
+//	unsigned long long	w	-	which word of 64 rows
+//Summary:
+//	Fills v with every wire's states in rows 64w through 64w+63, laid
+//		out as eval() leaves them, for callers that test the rows some
+//		other way than hashing. Only reads the program, so threads may
+//		call it at once with their own v.
+//Returns:
+//	n/a
+//========================
+void		TruthTable::evaluate(lanes *v, unsigned long long w)
+{
+	inputs(v, w);
+	eval(v);
+}
+
+//========================
+//TruthTable Get State
+//========================
+//Parameters:
+//	int					op	-	an output pad index
+//	unsigned long long	row	-	a row, below cntRows()
+//Summary:
+//	An output pad's state in a row of a kept table.
+//Returns:
+//	state	-	the output's settled state
+//========================
+state		TruthTable::getState(int op, unsigned long long row)
+{
+	unsigned long long	at = ((unsigned long long) op * words + row / 64) * rails;
+	lanes				bit = 1ULL << (row % 64);
+
+	if ((*table)[at] & bit)
+		return high;
+
+	if (!ternary || ((*table)[at + 1] & bit))
+		return low;
+
+	return indet;
+}
+
+//========================
+//TruthTable Get Hash
+//========================
+//Parameters:
+//	int	op	-	an output pad index
+//Summary:
+//	The FNV-1a hash of the chunk hashes of an output pad's column, or,
+//		with no pad given, of every pad's column hash in order.
+//Returns:
+//	unsigned long long	-	the hash
+//========================
+unsigned long long	TruthTable::getHash(int op)
+{
+	unsigned long long h = FNV_START;
+
+	for (long c = 0; c < chunks; c++)
+		h = fnv(h, (*chunkHash)[(unsigned long long) c * net->cntoPads() + op]);
+
+	return h;
+}
+
+unsigned long long	TruthTable::getHash()
+{
+	unsigned long long h = FNV_START;
+
+	for (int op = 0; op < net->cntoPads(); op++)
+		h = fnv(h, getHash(op));
+
+	return h;
+}
@@ -0,0 +1,91 @@
+#ifndef TRUTHTABLE_H
+#define TRUTHTABLE_H
+
+//================================================================
+//Filename:		Exhaustive Truth Table Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of the TruthTable, which
+//					applies every input combination to a circuit
+//					without feedback, 64 combinations at a time.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+
+using namespace std;
+
+// 64 one-bit lanes, one input combination per bit.
+typedef unsigned long long	lanes;
+
+//==================================
+//Class:	TruthTable
+//Parent:	n/a
+//==================================
+//Description:
+//	The TruthTable finds the settled output of every output pad for every
+//		combination of input pad states: 2^n rows for n input pads, or 3^n
+//		with X as a third state. Row r gives input pad p the p'th binary
+//		(or ternary) digit of r, so input pad 0 changes fastest. Once a
+//		circuit without feedback settles its outputs depend only on its
+//		inputs, not on delays, so the netlist is evaluated once per row in
+//		level order. Each wire is a 64-bit word with one row per bit, so a
+//		gate evaluation is one AND, OR or XOR for 64 rows. With X, each wire
+//		is two words, the rows where it is 1 and the rows where it is 0, and
+//		rows in neither are X; the gates combine these exactly as the
+//		logic functions do. The rows are cut into chunks that threads take
+//		in turn. The table can be kept whole for printing, and is always
+//		hashed chunk by chunk, so the hash is the same for any thread count.
+//==================================
+class TruthTable
+{
+public:
+				TruthTable(Netlist *n, bool x = false, int nt = 1) throw (NullPointerException, BasicException);
+
+				~TruthTable();
+
+	int			cntThreads();
+	unsigned long long	cntRows();
+
+	void		run(bool keep) throw (BasicException);
+	void		evaluate(lanes *v, unsigned long long w);
+	state		getState(int op, unsigned long long row);
+	unsigned long long	getHash(int op);
+	unsigned long long	getHash();
+
+private:
+
+	void		work();
+	void		inputs(lanes *v, unsigned long long w);
+	void		eval(lanes *v);
+
+static void*	worker(void *arg);
+
+	Netlist*				net;
+	bool					ternary;
+	int						rails;		// words per wire: 1, or 2 with X.
+	int						nThreads;
+	bool					keeping;
+	unsigned long long		rows;
+	unsigned long long		words;
+	long					chunks;
+	long					nextChunk;
+
+	vector<int>*			prog;		// per gate: type, output wire, input count, input wires, table.
+	vector<unsigned char>*	tables;		// gLUT truth tables.
+	vector<lanes>*			table;		// output words, per output pad, when kept.
+	vector<unsigned long long>*	chunkHash;	// per chunk, per output pad.
+
+	pthread_t*				threads;
+};
+
+#endif //TRUTHTABLE_H
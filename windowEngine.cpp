@@ -0,0 +1,232 @@
+//================================================================
+//Filename:		Time Window Engine Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the WindowEngine:
+//					sizing the warm-up, splitting a run into windows
+//					and stitching their outputs back together.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "engine.h"
+#include "windowEngine.h"
+
+using namespace std;
+
+//========================
+//WindowEngine Constructor
+//========================
+//Parameters:
+//	Netlist	*n	-	the netlist to simulate
+//	int		nt	-	how many threads, and so windows
+//Summary:
+//	Finds the warm-up, the netlist's longest input to output path
+//		delay, and compiles one Engine per thread. The netlist must
+//		outlive the WindowEngine and must not change while it is in use.
+//========================
+WindowEngine::WindowEngine(Netlist *n, int nt) throw (NullPointerException, BasicException)
+{
+	if (n == NULL)
+		throw NullPointerException();
+
+	if (nt < 1)
+		throw BasicException("Thread count must be at least 1.");
+
+	warmup = n->getPathDelay();
+
+	if (warmup < 0)
+		throw BasicException("Time windows need a circuit without feedback.");
+
+	net = n;
+	nThreads = nt;
+	seat = 0;
+
+	engines = new vector<Engine*>(nThreads, (Engine*) NULL);
+	winStart = new vector<int>(nThreads + 1, 0);
+	ins = new vector<unsigned char>();
+	outs = new vector<unsigned char>();
+	threads = new pthread_t[nThreads];
+
+	for (int c = 0; c < nThreads; c++)
+		(*engines)[c] = new Engine(n);
+}
+
+//========================
+//WindowEngine Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Releases the Engines and buffers. The netlist is not deleted.
+//========================
+WindowEngine::~WindowEngine()
+{
+	for (int c = 0; c < nThreads; c++)
+		delete (*engines)[c];
+
+	delete [] threads;
+
+	delete engines;
+	delete winStart;
+	delete ins;
+	delete outs;
+}
+
+//========================
+//WindowEngine Thread Count
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How many threads, and so windows, share the run.
+//Returns:
+//	int	-	the thread count
+//========================
+int			WindowEngine::cntThreads()
+{
+	return nThreads;
+}
+
+//========================
+//WindowEngine Warm-up
+//========================
+//Parameters:
+//	none
+//Summary:
+//	How long before its window each Engine starts.
+//Returns:
+//	int	-	the warm-up in ns
+//========================
+int			WindowEngine::getWarmup()
+{
+	return warmup;
+}
+
+//========================
+//WindowEngine Worker
+//========================
+//Parameters:
+//	void	*arg	-	the WindowEngine
+//Summary:
+//	Thread entry point: takes the next window number and works it.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		WindowEngine::worker(void *arg)
+{
+	WindowEngine* eng = (WindowEngine*) arg;
+
+	eng->work(__sync_fetch_and_add(&eng->seat, 1));
+
+	return NULL;
+}
+
+//========================
+//WindowEngine Work
+//========================
+//Parameters:
+//	int	c	-	a window
+//Summary:
+//	Simulates window c on its own Engine, warm-up first.
+//Returns:
+//	n/a
+//========================
+void		WindowEngine::work(int c)
+{
+	int from = (*winStart)[c] - warmup;
+
+	if (from < 0)
+		from = 0;
+
+	if ((*winStart)[c] < (*winStart)[c + 1])
+		(*engines)[c]->runSpan(&(*ins)[0], &(*outs)[0], from, (*winStart)[c], (*winStart)[c + 1] - 1);
+}
+
+//========================
+//WindowEngine Run
+//========================
+//Parameters:
+//	Vector	*v		-	the vector whose PadStates drive and record the run
+//	int		tEnd	-	the last time increment to simulate
+//Summary:
+//	The windowed counterpart of Engine::run. Copies the input pads'
+//		states out of their PadStates, since those are not safe to read
+//		from several threads, cuts 0 through tEnd into equal windows,
+//		simulates them one per thread, and writes the stitched outputs
+//		into the oPadStates.
+//Returns:
+//	n/a
+//========================
+void		WindowEngine::run(Vector *v, int tEnd) throw (BasicException)
+{
+	if (tEnd < 1)
+		throw BasicException("Time to run is zero or negative. INVALID!");
+
+	vector<int>			iIdx;
+	vector<PadState*>	iPS;
+	vector<int>			oIdx;
+	vector<PadState*>	oPS;
+
+	net->matchPads(v, iIdx, iPS, oIdx, oPS);
+
+	int nI = net->cntiPads();
+	int nO = net->cntoPads();
+
+	ins->assign((long) (tEnd + 1) * nI, indet);
+	outs->assign((long) (tEnd + 1) * nO + 1, indet);
+
+	for (int ip = 0; ip < iPS.size(); ip++)
+	{
+		if (iPS[ip]->cntStates() == 0)
+			continue;
+
+		for (int ct = 0; ct < tEnd + 1; ct++)
+			(*ins)[(long) ct * nI + iIdx[ip]] = iPS[ip]->getState(ct);
+	}
+
+	if (ins->empty())
+		ins->push_back(indet);
+
+	for (int c = 0; c <= nThreads; c++)
+		(*winStart)[c] = (int) (((long) (tEnd + 1) * c) / nThreads);
+
+	seat = 1;
+
+	int started = 1;
+
+	while ((started < nThreads) && (pthread_create(&threads[started], NULL, worker, this) == 0))
+		started++;
+
+	if (started < nThreads)
+	{
+		char buf[80];
+
+		for (int c = 1; c < started; c++)
+			pthread_join(threads[c], NULL);
+
+		sprintf(buf, "Unable to start window thread %d of %d.", started + 1, nThreads);
+		throw BasicException(buf);
+	}
+
+	work(0);
+
+	for (int c = 1; c < nThreads; c++)
+		pthread_join(threads[c], NULL);
+
+	for (int op = 0; op < oPS.size(); op++)
+	{
+		for (int ct = 0; ct < tEnd + 1; ct++)
+			oPS[op]->addState((state) (*outs)[(long) ct * nO + oIdx[op]], ct);
+	}
+}
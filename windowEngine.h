@@ -0,0 +1,73 @@
+#ifndef WINDOWENGINE_H
+#define WINDOWENGINE_H
+
+//================================================================
+//Filename:		Time Window Engine Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definition of the WindowEngine, which
+//					cuts one long run of a feedback-free circuit into
+//					time windows and simulates them side by side.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <pthread.h>
+#include "logicException.h"
+#include "logic.h"
+#include "gate.h"
+#include "circuit.h"
+#include "netlist.h"
+#include "engine.h"
+
+using namespace std;
+
+//==================================
+//Class:	WindowEngine
+//Parent:	n/a
+//==================================
+//Description:
+//	In a circuit without feedback, an output at time t depends only on
+//		the inputs from t - getPathDelay() to t. The WindowEngine splits
+//		the run into one window of time per thread. Each window gets its
+//		own Engine, which starts from all X getPathDelay() before the
+//		window opens (the warm-up), so by the time the window opens its
+//		outputs are the same as a single run's would be. Only the window
+//		itself is recorded, and the windows are stitched back together
+//		in order. Circuits with feedback, like flipflop.txt, are refused.
+//==================================
+class WindowEngine
+{
+public:
+				WindowEngine(Netlist *n, int nt = 1) throw (NullPointerException, BasicException);
+
+				~WindowEngine();
+
+	int			cntThreads();
+	int			getWarmup();
+
+	void		run(Vector *v, int tEnd) throw (BasicException);
+
+private:
+
+	void		work(int c);
+
+static void*	worker(void *arg);
+
+	Netlist*				net;
+	int						nThreads;
+	int						warmup;
+
+	vector<Engine*>*		engines;
+	vector<int>*			winStart;	// first time of each window, plus one past the end.
+	vector<unsigned char>*	ins;		// cntiPads() states per time.
+	vector<unsigned char>*	outs;		// cntoPads() states per time.
+
+	pthread_t*				threads;
+	int						seat;
+};
+
+#endif //WINDOWENGINE_H
@@ -0,0 +1,686 @@
+//================================================================
+//Filename:		Compressed File Stream Implementations
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains implementations for the compressing and
+//					decompressing stream buffers, and the streams
+//					over them.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include <pthread.h>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+#include "logicException.h"
+#include "zipStream.h"
+
+using namespace std;
+
+// Bytes per chunk handed between threads, and chunks in flight.
+#define CHUNK		65536
+#define DEPTH		8
+
+//========================
+//Zip Kind
+//========================
+//Parameters:
+//	string	path	-	a file name
+//Summary:
+//	Names ending .gz are gzip files and .zst zstd files; anything else
+//		is plain.
+//Returns:
+//	zipType	-	the file's storage
+//========================
+zipType		zipKind(string path)
+{
+	if ((path.size() > 3) && (path.substr(path.size() - 3) == ".gz"))
+		return zGzip;
+
+	if ((path.size() > 4) && (path.substr(path.size() - 4) == ".zst"))
+		return zZstd;
+
+	return zPlain;
+}
+
+//========================
+//ZipInBuf Constructor
+//========================
+//Parameters:
+//	string	path	-	the file to read
+//Summary:
+//	Opens the file and starts the helper thread reading it. If the
+//		helper cannot be started, the buffer is left not open.
+//========================
+ZipInBuf::ZipInBuf(string path)
+{
+	kind = zipKind(path);
+	gz = NULL;
+	raw = NULL;
+	zctx = NULL;
+	zin = NULL;
+	zpos = 0;
+	zleft = 1;
+	cur = NULL;
+	done = false;
+	quit = false;
+	ring = new ChunkRing(DEPTH);
+
+	if (kind == zGzip)
+		open = ((gz = gzopen(path.c_str(), "rb")) != NULL);
+	else
+		open = ((raw = fopen(path.c_str(), "rb")) != NULL);
+
+#ifdef HAVE_ZSTD
+	if (open && (kind == zZstd))
+	{
+		zctx = ZSTD_createDCtx();
+		zin = new string();
+	}
+#else
+	if (open && (kind == zZstd)) // no zstd in this build.
+	{
+		fclose(raw);
+		raw = NULL;
+		open = false;
+	}
+#endif
+
+	setg(NULL, NULL, NULL);
+
+	if (open && (pthread_create(&helper, NULL, pumper, this) != 0))
+		open = false;	// no helper to join; the destructor closes the file.
+}
+
+//========================
+//ZipInBuf Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Stops the helper, even if the file was not read to the end, and
+//		closes the file.
+//========================
+ZipInBuf::~ZipInBuf()
+{
+	if (open)
+	{
+		quit = true;
+
+		if (!done)
+		{
+			string* c;
+
+			while ((c = ring->take()) != NULL) // the helper ends with NULL.
+				delete c;
+		}
+
+		pthread_join(helper, NULL);
+	}
+
+	if (gz != NULL)
+		gzclose(gz);
+
+	if (raw != NULL)
+		fclose(raw);
+
+#ifdef HAVE_ZSTD
+	if (zctx != NULL)
+		ZSTD_freeDCtx((ZSTD_DCtx*) zctx);
+#endif
+
+	delete zin;
+	delete cur;
+	delete ring;
+}
+
+//========================
+//ZipInBuf Is Open
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Whether the file opened (and, for .zst, whether zstd is built in).
+//Returns:
+//	bool	-	true if open
+//========================
+bool		ZipInBuf::isOpen()
+{
+	return open;
+}
+
+//========================
+//ZipInBuf Pumper
+//========================
+//Parameters:
+//	void	*arg	-	the ZipInBuf
+//Summary:
+//	Thread entry point for the helper.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		ZipInBuf::pumper(void *arg)
+{
+	((ZipInBuf*) arg)->pump();
+
+	return NULL;
+}
+
+//========================
+//ZipInBuf Pump
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The helper: reads chunks into the ring until the file ends, fails,
+//		or the reader goes away, then ends the ring with NULL.
+//Returns:
+//	n/a
+//========================
+void		ZipInBuf::pump()
+{
+	string* c;
+
+	while (!quit && ((c = readChunk()) != NULL))
+		ring->put(c);
+
+	ring->put(NULL);
+}
+
+//========================
+//ZipInBuf Read Chunk
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Reads and, if need be, decompresses up to a chunk of the file. On an
+//		error, or a gzip or zstd stream that stops short, failure says
+//		what went wrong.
+//Returns:
+//	string*	-	the chunk, or NULL at the end of the file or on an error
+//========================
+string*		ZipInBuf::readChunk()
+{
+	string* c = new string(CHUNK, '\0');
+	int		n = 0;
+
+	if (kind == zGzip)
+	{
+		int err = Z_OK;
+
+		n = gzread(gz, &(*c)[0], CHUNK);
+
+		const char* msg = gzerror(gz, &err);
+
+		if ((n < 0) || ((err != Z_OK) && (err != Z_STREAM_END)))
+		{
+			failure = string("Unable to read compressed file: ") + msg + ".";
+			n = 0;
+		}
+	}
+	else if (kind == zPlain)
+	{
+		n = fread(&(*c)[0], 1, CHUNK, raw);
+
+		if ((n == 0) && ferror(raw))
+			failure = "Unable to read file.";
+	}
+#ifdef HAVE_ZSTD
+	else
+	{
+		ZSTD_outBuffer out = {&(*c)[0], CHUNK, 0};
+
+		while (out.pos == 0)
+		{
+			if (zpos == zin->size()) // refill the compressed input.
+			{
+				zin->resize(ZSTD_DStreamInSize());
+				zin->resize(fread(&(*zin)[0], 1, zin->size(), raw));
+				zpos = 0;
+
+				if (zin->empty())
+				{
+					if (ferror(raw))
+						failure = "Unable to read file.";
+					else if (zleft != 0)
+						failure = "Unable to read compressed file: unexpected end of file.";
+					break;
+				}
+			}
+
+			ZSTD_inBuffer in = {zin->data(), zin->size(), zpos};
+
+			zleft = ZSTD_decompressStream((ZSTD_DCtx*) zctx, &out, &in);
+
+			if (ZSTD_isError(zleft))
+			{
+				failure = string("Unable to read compressed file: ") + ZSTD_getErrorName(zleft) + ".";
+				break;
+			}
+
+			zpos = in.pos;
+		}
+
+		n = (failure == "") ? out.pos : 0;
+	}
+#endif
+
+	if (n <= 0)
+	{
+		delete c;
+		return NULL;
+	}
+
+	c->resize(n);
+
+	return c;
+}
+
+//========================
+//ZipInBuf Underflow
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Moves on to the helper's next chunk once the current one is used up.
+//		If the helper stopped on an error, throws it; the istream
+//		catches it, sets badbit, and throws it on to the reader.
+//Returns:
+//	int	-	the next character, or EOF
+//========================
+int			ZipInBuf::underflow()
+{
+	if (gptr() < egptr())
+		return traits_type::to_int_type(*gptr());
+
+	if (!open || done)
+		return traits_type::eof();
+
+	delete cur;
+
+	cur = ring->take();
+
+	if (cur == NULL)
+	{
+		done = true;
+
+		if (failure != "")
+			throw BasicException(failure);
+
+		return traits_type::eof();
+	}
+
+	setg(&(*cur)[0], &(*cur)[0], &(*cur)[0] + cur->size());
+
+	return traits_type::to_int_type(*gptr());
+}
+
+//========================
+//ZipOutBuf Constructor
+//========================
+//Parameters:
+//	string	path	-	the file to write
+//Summary:
+//	Creates the file and starts the helper thread that writes it. If
+//		the helper cannot be started, the file is removed again and the
+//		buffer is left not open.
+//========================
+ZipOutBuf::ZipOutBuf(string path)
+{
+	kind = zipKind(path);
+	gz = NULL;
+	raw = NULL;
+	zctx = NULL;
+	ring = new ChunkRing(DEPTH);
+	cur = new string();
+	failed = false;
+
+	if (kind == zGzip)
+		open = ((gz = gzopen(path.c_str(), "wb")) != NULL);
+	else
+		open = ((raw = fopen(path.c_str(), "wb")) != NULL);
+
+#ifdef HAVE_ZSTD
+	if (open && (kind == zZstd))
+		zctx = ZSTD_createCCtx();
+#else
+	if (open && (kind == zZstd)) // no zstd in this build.
+	{
+		fclose(raw);
+		raw = NULL;
+		remove(path.c_str());
+		open = false;
+	}
+#endif
+
+	if (open && (pthread_create(&helper, NULL, drainer, this) != 0))
+	{
+#ifdef HAVE_ZSTD
+		if (zctx != NULL)
+			ZSTD_freeCCtx((ZSTD_CCtx*) zctx);
+
+		zctx = NULL;
+#endif
+		if (gz != NULL)
+			gzclose(gz);
+
+		if (raw != NULL)
+			fclose(raw);
+
+		gz = NULL;
+		raw = NULL;
+		remove(path.c_str());
+		open = false;
+	}
+}
+
+//========================
+//ZipOutBuf Destructor
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Finishes the file if close() has not.
+//========================
+ZipOutBuf::~ZipOutBuf()
+{
+	close();
+
+	delete cur;
+	delete ring;
+}
+
+//========================
+//ZipOutBuf Is Open
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Whether the file was created and is not yet closed.
+//Returns:
+//	bool	-	true if open
+//========================
+bool		ZipOutBuf::isOpen()
+{
+	return open;
+}
+
+//========================
+//ZipOutBuf Close
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Hands over the last partial chunk and the end of the file, then
+//		waits for the helper to write and close it.
+//Returns:
+//	bool	-	true if everything was written and the file closed cleanly
+//========================
+bool		ZipOutBuf::close()
+{
+	if (!open)
+		return !failed;
+
+	if (!cur->empty())
+	{
+		ring->put(cur);
+		cur = new string();
+	}
+
+	ring->put(NULL);
+
+	pthread_join(helper, NULL);
+
+	open = false;
+
+	return !failed;
+}
+
+//========================
+//ZipOutBuf Overflow
+//========================
+//Parameters:
+//	int	c	-	a character, or EOF
+//Summary:
+//	Adds one character to the current chunk, handing the chunk over once
+//		it is full. There is no put area, so every write comes here or
+//		to xsputn.
+//Returns:
+//	int	-	c, or EOF if the file is not open
+//========================
+int			ZipOutBuf::overflow(int c)
+{
+	if (!open)
+		return traits_type::eof();
+
+	if (c == traits_type::eof())
+		return traits_type::not_eof(c);
+
+	char ch = (char) c;
+
+	xsputn(&ch, 1);
+
+	return c;
+}
+
+//========================
+//ZipOutBuf Put String
+//========================
+//Parameters:
+//	const char	*s	-	characters to write
+//	streamsize	n	-	how many
+//Summary:
+//	Adds characters to the current chunk, handing the chunk over once
+//		it is full.
+//Returns:
+//	streamsize	-	n, or 0 if the file is not open or a write failed
+//========================
+streamsize	ZipOutBuf::xsputn(const char *s, streamsize n)
+{
+	if (!open || failed)
+		return 0;
+
+	cur->append(s, n);
+
+	if (cur->size() >= CHUNK)
+	{
+		ring->put(cur);
+		cur = new string();
+		cur->reserve(CHUNK + 256);
+	}
+
+	return n;
+}
+
+//========================
+//ZipOutBuf Sync
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Chunks are written by the helper in their own time, so this only
+//		says whether it has failed yet.
+//Returns:
+//	int	-	0, or -1 once a write has failed
+//========================
+int			ZipOutBuf::sync()
+{
+	return failed ? -1 : 0;
+}
+
+//========================
+//ZipOutBuf Drainer
+//========================
+//Parameters:
+//	void	*arg	-	the ZipOutBuf
+//Summary:
+//	Thread entry point for the helper.
+//Returns:
+//	void*	-	NULL
+//========================
+void*		ZipOutBuf::drainer(void *arg)
+{
+	((ZipOutBuf*) arg)->drain();
+
+	return NULL;
+}
+
+//========================
+//ZipOutBuf Drain
+//========================
+//Parameters:
+//	none
+//Summary:
+//	The helper: compresses and writes chunks until the end, then closes
+//		the file.
+//Returns:
+//	n/a
+//========================
+void		ZipOutBuf::drain()
+{
+	string* c;
+
+	while ((c = ring->take()) != NULL)
+	{
+		writeChunk(c);
+		delete c;
+	}
+
+	finish();
+}
+
+//========================
+//ZipOutBuf Write Chunk
+//========================
+//Parameters:
+//	string	*c	-	a chunk
+//Summary:
+//	Compresses, if need be, and writes one chunk. Once a write has
+//		failed, the rest are dropped.
+//Returns:
+//	n/a
+//========================
+void		ZipOutBuf::writeChunk(string *c)
+{
+	if (failed)
+		return;
+
+	if (kind == zGzip)
+		failed = (gzwrite(gz, c->data(), c->size()) != (int) c->size());
+	else if (kind == zPlain)
+		failed = (fwrite(c->data(), 1, c->size(), raw) != c->size());
+#ifdef HAVE_ZSTD
+	else
+	{
+		string			buf(ZSTD_CStreamOutSize(), '\0');
+		ZSTD_inBuffer	in = {c->data(), c->size(), 0};
+
+		while ((in.pos < in.size) && !failed)
+		{
+			ZSTD_outBuffer out = {&buf[0], buf.size(), 0};
+
+			failed = ZSTD_isError(ZSTD_compressStream2((ZSTD_CCtx*) zctx, &out, &in, ZSTD_e_continue))
+				|| (fwrite(buf.data(), 1, out.pos, raw) != out.pos);
+		}
+	}
+#endif
+}
+
+//========================
+//ZipOutBuf Finish
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Flushes the compressor and closes the file, noting a failure of
+//		either.
+//Returns:
+//	n/a
+//========================
+void		ZipOutBuf::finish()
+{
+#ifdef HAVE_ZSTD
+	if (kind == zZstd)
+	{
+		string			buf(ZSTD_CStreamOutSize(), '\0');
+		ZSTD_inBuffer	in = {NULL, 0, 0};
+		size_t			left = 1;
+
+		while ((left != 0) && !failed)
+		{
+			ZSTD_outBuffer out = {&buf[0], buf.size(), 0};
+
+			left = ZSTD_compressStream2((ZSTD_CCtx*) zctx, &out, &in, ZSTD_e_end);
+			failed = ZSTD_isError(left) || (fwrite(buf.data(), 1, out.pos, raw) != out.pos);
+		}
+
+		ZSTD_freeCCtx((ZSTD_CCtx*) zctx);
+		zctx = NULL;
+	}
+#endif
+
+	if ((gz != NULL) && (gzclose(gz) != Z_OK))
+		failed = true;
+
+	if ((raw != NULL) && (fclose(raw) != 0))
+		failed = true;
+
+	gz = NULL;
+	raw = NULL;
+}
+
+//========================
+//ZipIn Constructor
+//========================
+//Parameters:
+//	string	path	-	the file to read
+//Summary:
+//	Opens path for reading, decompressing .gz and .zst files.
+//========================
+ZipIn::ZipIn(string path) : istream(NULL), buf(path)
+{
+	rdbuf(&buf);
+	exceptions(ios::badbit);
+
+	if (!buf.isOpen())
+		setstate(ios::failbit);
+}
+
+//========================
+//ZipOut Constructor
+//========================
+//Parameters:
+//	string	path	-	the file to write
+//Summary:
+//	Creates path, compressing it if it ends .gz or .zst.
+//========================
+ZipOut::ZipOut(string path) : ostream(NULL), buf(path)
+{
+	rdbuf(&buf);
+
+	if (!buf.isOpen())
+		setstate(ios::failbit);
+}
+
+//========================
+//ZipOut Close
+//========================
+//Parameters:
+//	none
+//Summary:
+//	Finishes the file; nothing more can be written. Sets badbit if any
+//		of it could not be written.
+//Returns:
+//	n/a
+//========================
+void		ZipOut::close()
+{
+	if (!buf.close())
+		setstate(ios::badbit);
+}
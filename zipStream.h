@@ -0,0 +1,175 @@
+#ifndef ZIPSTREAM_H
+#define ZIPSTREAM_H
+
+//================================================================
+//Filename:		Compressed File Stream Definitions
+//Programmer:	Daniel "ProgrammerDan" Boston
+//Date:			October 18, 2026
+//Summary:		Contains the definitions of ZipIn and ZipOut, file
+//					streams that read and write .gz and .zst files
+//					(and plain ones) with the compression work done
+//					on a helper thread.
+//Revisions:
+//
+//================================================================
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include <pthread.h>
+#include <zlib.h>
+#include "logicException.h"
+#include "ring.h"
+
+using namespace std;
+
+// How a file is stored, going by its name. See zipKind().
+enum zipType {zPlain, zGzip, zZstd};
+
+// See Implementation
+zipType		zipKind(string path);
+
+// Chunks of file data between a stream and its helper thread; a NULL
+// chunk marks the end of the file. See Ring.
+typedef Ring<string>	ChunkRing;
+
+//==================================
+//Class:	ZipInBuf
+//Parent:	streambuf
+//==================================
+//Description:
+//	A ZipInBuf reads a file through a helper thread that reads and
+//		decompresses it a chunk at a time, a few chunks ahead of whatever
+//		is parsing it. Plain files are read the same way, so reading
+//		overlaps parsing for them too. A read error, or a compressed
+//		file that ends part way through, throws a BasicException from
+//		the read that reaches it, which the stream turns into badbit.
+//==================================
+class ZipInBuf : public streambuf
+{
+public:
+				ZipInBuf(string path);
+
+				~ZipInBuf();
+
+	bool		isOpen();
+
+protected:
+
+	int			underflow();
+
+private:
+
+	void		pump();
+	string*		readChunk();
+
+static void*	pumper(void *arg);
+
+	zipType			kind;
+	gzFile			gz;
+	FILE*			raw;
+	void*			zctx;		// zstd decompression context.
+	string*			zin;		// zstd input not yet consumed.
+	int				zpos;
+	size_t			zleft;		// 0 once a zstd frame is complete.
+	string			failure;	// set by the helper on an error.
+
+	ChunkRing*		ring;
+	string*			cur;
+	bool			open;
+	bool			done;
+	volatile bool	quit;
+	pthread_t		helper;
+};
+
+//==================================
+//Class:	ZipOutBuf
+//Parent:	streambuf
+//==================================
+//Description:
+//	A ZipOutBuf collects what is written to it into chunks and hands
+//		them to a helper thread that compresses and writes them, so the
+//		writing thread never waits on compression unless the helper
+//		falls a few chunks behind. The helper notes the first write or
+//		close that fails; later writes and sync() then fail, and so
+//		does close().
+//==================================
+class ZipOutBuf : public streambuf
+{
+public:
+				ZipOutBuf(string path);
+
+				~ZipOutBuf();
+
+	bool		isOpen();
+	bool		close();
+
+protected:
+
+	int			overflow(int c);
+	streamsize	xsputn(const char *s, streamsize n);
+	int			sync();
+
+private:
+
+	void		drain();
+	void		writeChunk(string *c);
+	void		finish();
+
+static void*	drainer(void *arg);
+
+	zipType			kind;
+	gzFile			gz;
+	FILE*			raw;
+	void*			zctx;		// zstd compression context.
+
+	ChunkRing*		ring;
+	string*			cur;
+	bool			open;
+	volatile bool	failed;		// set by the helper on a write error.
+	pthread_t		helper;
+};
+
+//==================================
+//Class:	ZipIn
+//Parent:	istream
+//==================================
+//Description:
+//	An input file stream over a ZipInBuf. good() is false if the file
+//		could not be opened. A read error throws the ZipInBuf's
+//		BasicException through whatever read met it, so the loaders
+//		report it instead of stopping early as if at the end.
+//==================================
+class ZipIn : public istream
+{
+public:
+				ZipIn(string path);
+
+private:
+
+	ZipInBuf	buf;
+};
+
+//==================================
+//Class:	ZipOut
+//Parent:	ostream
+//==================================
+//Description:
+//	An output file stream over a ZipOutBuf. good() is false if the file
+//		could not be created. close() (or destruction) finishes the file;
+//		good() is false after close() if any of it failed to be written.
+//==================================
+class ZipOut : public ostream
+{
+public:
+				ZipOut(string path);
+
+	void		close();
+
+private:
+
+	ZipOutBuf	buf;
+};
+
+#endif //ZIPSTREAM_H